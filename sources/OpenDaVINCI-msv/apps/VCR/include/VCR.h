@@ -25,6 +25,7 @@
 
 #include "core/SharedPointer.h"
 #include "core/base/ConferenceClientModule.h"
+#include "core/base/SharedFrameRing.h"
 #include "core/wrapper/SharedMemory.h"
 
 namespace msv {
@@ -80,6 +81,7 @@ namespace msv {
         private:
 	        bool m_hasAttachedToSharedImageMemory;
 	        core::SharedPointer<core::wrapper::SharedMemory> m_sharedImageMemory;
+	        core::SharedPointer<core::base::SharedFrameRing> m_sharedImageRing;
 	        IplImage *m_image;
             bool m_debug;
             CvVideoWriter *m_writer;
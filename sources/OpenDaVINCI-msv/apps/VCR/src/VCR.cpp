@@ -36,6 +36,7 @@ namespace msv {
     VCR::VCR(const int32_t &argc, char **argv) : ConferenceClientModule(argc, argv, "VCR"),
 	    m_hasAttachedToSharedImageMemory(false),
         m_sharedImageMemory(),
+        m_sharedImageRing(),
 	    m_image(NULL),
         m_debug(false),
         m_writer(NULL) {}
@@ -77,34 +78,29 @@ namespace msv {
 			    m_sharedImageMemory
 					    = core::wrapper::SharedMemoryFactory::attachToSharedMemory(
 							    si.getName());
+			    m_sharedImageRing = core::SharedPointer<SharedFrameRing>(new SharedFrameRing(m_sharedImageMemory));
+			    m_hasAttachedToSharedImageMemory = m_sharedImageRing->isValid();
 		    }
 
 		    // Check if we could successfully attach to the shared memory.
-		    if (m_sharedImageMemory->isValid()) {
+		    if (m_sharedImageRing.isValid() && m_sharedImageRing->isValid()) {
 			    //cerr << "Got image: LOG 0.2 " << si.toString() << endl;
 
-			    // Lock the memory region to gain exclusive access. REMEMBER!!! DO NOT FAIL WITHIN lock() / unlock(), otherwise, the image producing process would fail.
-			    m_sharedImageMemory->lock();
-			    {
-				    // Here, do something with the image. For example, we simply show the image.
-
-				    const uint32_t numberOfChannels = 3;
-				    // For example, simply show the image.
-				    if (m_image == NULL) {
-					    m_image = cvCreateImage(cvSize(si.getWidth(),
-							    si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
-				    }
-
-				    // Copying the image data is very expensive...
-				    if (m_image != NULL) {
-					    memcpy(m_image->imageData,
-							    m_sharedImageMemory->getSharedMemory(),
-							    si.getWidth() * si.getHeight() * numberOfChannels);
-				    }
+			    // Here, do something with the image. For example, we simply show the image.
+
+			    const uint32_t numberOfChannels = 3;
+			    // For example, simply show the image.
+			    if (m_image == NULL) {
+				    m_image = cvCreateImage(cvSize(si.getWidth(),
+						    si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
 			    }
 
-			    // Release the memory region so that the image produce (i.e. the camera for example) can provide the next raw image data.
-			    m_sharedImageMemory->unlock();
+			    // Copy the latest frame without blocking the image producer.
+			    uint32_t frameNumber = 0;
+			    if ( (m_image == NULL) ||
+			         !m_sharedImageRing->read(m_image->imageData, si.getWidth() * si.getHeight() * numberOfChannels, frameNumber) ) {
+				    return false;
+			    }
 
 			    // Mirror the image.
 			    cvFlip(m_image, 0, -1);
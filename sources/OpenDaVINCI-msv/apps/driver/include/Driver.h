@@ -22,6 +22,8 @@
 
 #include "core/base/ConferenceClientModule.h"
 
+#include "DriverConfiguration.h"
+
 namespace msv {
 
     using namespace std;
@@ -70,7 +72,7 @@ namespace msv {
             int state;
             int counter;
             double const SPEED;
-            bool isObject();
+            bool isObject(const DriverConfiguration &configuration);
     };
 
 } // msv
@@ -0,0 +1,70 @@
+/**
+ * driver - Sample application for calculating steering and acceleration commands.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef DRIVERCONFIGURATION_H_
+#define DRIVERCONFIGURATION_H_
+
+#include "core/base/ConfigurationValue.h"
+#include "core/base/KeyValueConfiguration.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class contains the driver's configuration resolved once
+     * when the module starts.
+     */
+    class DriverConfiguration {
+        private:
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             *
+             * @param obj Reference to an object of this class.
+             * @return Reference to this instance.
+             */
+            DriverConfiguration& operator=(const DriverConfiguration &/*obj*/);
+
+        public:
+            /**
+             * Constructor.
+             *
+             * @param kvc Configuration to resolve the values from.
+             */
+            DriverConfiguration(const core::base::KeyValueConfiguration &kvc);
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj Reference to an object of this class.
+             */
+            DriverConfiguration(const DriverConfiguration &obj);
+
+            virtual ~DriverConfiguration();
+
+        public:
+            /* Length of the vehicle in meters. */
+            const core::base::ConfigurationValue<double> carLength;
+    };
+
+} // msv
+
+#endif /*DRIVERCONFIGURATION_H_*/
@@ -58,8 +58,7 @@ namespace msv {
         // This method will do the main data processing job.
         ModuleState::MODULE_EXITCODE Driver::body() {
                 double initialTraveledPath;
-                KeyValueConfiguration kv = getKeyValueConfiguration();
-                double carLength = kv.getValue<double> ("global.carLength");
+                const DriverConfiguration configuration(getKeyValueConfiguration());
 	        while (getModuleState() == ModuleState::RUNNING) {
 
                 // Get most recent vehicle data:
@@ -102,7 +101,7 @@ namespace msv {
                         
                         counter++;
                         
-                        if (counter > 90 /*&& !isObject()*/) {
+                        if (counter > 90 /*&& !isObject(configuration)*/) {
                                 counter = 0;
                                 initialTraveledPath = vd.getAbsTraveledPath();    
                                 state = 3;
@@ -116,7 +115,7 @@ namespace msv {
                         //sd.setSpeedData(SPEED);
                         
 
-                        if ((vd.getAbsTraveledPath()-initialTraveledPath) >= carLength * 1.6 ) {
+                        if ((vd.getAbsTraveledPath()-initialTraveledPath) >= configuration.carLength * 1.6 ) {
                                 sd.setIntersectionLine(0);
                                 state = 1;
                         }
@@ -138,11 +137,10 @@ namespace msv {
         }
 
         // Checks for objects with the front-center and front-right Ultrasonics.
-        bool Driver::isObject() 
+        bool Driver::isObject(const DriverConfiguration &configuration) 
         {     
                 SensorBoardData sbd;
-                KeyValueConfiguration kv = getKeyValueConfiguration();
-                double carLength = kv.getValue<double> ("global.carLength");
+                const double carLength = configuration.carLength;
 
                 if (sbd.getValueForKey_MapOfDistances(3) > 0 && sbd.getValueForKey_MapOfDistances(3) < carLength * 3) {
                         return true;
@@ -0,0 +1,110 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef ACQUIRESTAGE_H_
+#define ACQUIRESTAGE_H_
+
+#include "core/SharedPointer.h"
+#include "core/base/KeyValueDataStore.h"
+#include "core/base/Service.h"
+#include "core/base/SharedFrameRing.h"
+#include "core/data/Container.h"
+#include "core/data/TimeStamp.h"
+#include "core/data/image/SharedImage.h"
+#include "core/wrapper/SharedMemory.h"
+
+#include "LatestFrameSlot.h"
+#include "PipelineFrame.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class is the first stage of the lane detector's pipeline:
+     * It copies every new camera frame from the shared memory into
+     * a frame of the pool and passes it to the preprocessing stage.
+     */
+    class AcquireStage : public core::base::Service {
+        private:
+	        /**
+	         * "Forbidden" copy constructor. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the copy constructor.
+	         *
+	         * @param obj Reference to an object of this class.
+	         */
+	        AcquireStage(const AcquireStage &/*obj*/);
+
+	        /**
+	         * "Forbidden" assignment operator. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the assignment operator.
+	         *
+	         * @param obj Reference to an object of this class.
+	         * @return Reference to this instance.
+	         */
+	        AcquireStage& operator=(const AcquireStage &/*obj*/);
+
+        public:
+	        /**
+	         * Constructor.
+	         *
+	         * @param keyValueDataStore Data store holding the most recent SHARED_IMAGE.
+	         * @param framePool Pool to take the frames from.
+	         * @param output Slot to pass the acquired frames to.
+	         */
+	        AcquireStage(core::base::KeyValueDataStore &keyValueDataStore, FramePool &framePool, LatestFrameSlot &output);
+
+	        virtual ~AcquireStage();
+
+        private:
+	        virtual void beforeStop();
+
+	        virtual void run();
+
+	        /**
+	         * This method copies the current frame if it was not
+	         * acquired before.
+	         *
+	         * @param frame Frame to copy into.
+	         * @return true if a new frame was copied.
+	         */
+	        bool acquire(PipelineFrame &frame);
+
+	        /**
+	         * @return true if this stage has attached to the camera's shared memory.
+	         */
+	        bool isAttached() const;
+
+        private:
+	        core::base::KeyValueDataStore &m_keyValueDataStore;
+	        FramePool &m_framePool;
+	        LatestFrameSlot &m_output;
+
+	        core::SharedPointer<core::wrapper::SharedMemory> m_sharedImageMemory;
+	        core::SharedPointer<core::base::SharedFrameRing> m_sharedImageRing;
+	        core::data::image::SharedImage m_sharedImage;
+	        uint32_t m_lastFrameNumber;
+	        core::data::TimeStamp m_lastSent;
+    };
+
+} // msv
+
+#endif /*ACQUIRESTAGE_H_*/
@@ -23,14 +23,19 @@
 #include <opencv/cv.h>
 #include "core/SharedPointer.h"
 #include "core/base/ConferenceClientModule.h"
+#include "core/base/SharedFrameRing.h"
 #include "core/wrapper/SharedMemory.h"
 
 #include "Lines.h"
+#include "Preprocessor.h"
 
 namespace msv {
 
     using namespace std;
 
+    class LaneData;
+    class SteeringData;
+
     /**
      * This class is an exemplary skeleton for processing video data.
      */
@@ -77,12 +82,77 @@ namespace msv {
 	         */
 	        bool readSharedImage(core::data::Container &c);
 
+	        /**
+	         * This method measures the lane markings in the most
+	         * recently read image.
+	         *
+	         * @param sd Steering data to be filled.
+	         * @param ld Lane data to be filled.
+	         */
+	        void measure(SteeringData &sd, LaneData &ld);
+
+	        /**
+	         * This method measures the distances to the lane markings
+	         * along all scan lines in the most recently read image. It
+	         * is the first part of measure().
+	         *
+	         * @param sd Steering data to be filled except for the heading.
+	         * @param ld Lane data to be filled.
+	         */
+	        void measureDistances(SteeringData &sd, LaneData &ld);
+
+	        /**
+	         * This method computes the heading from the distances found
+	         * by measureDistances(). It is the second part of measure().
+	         *
+	         * @param sd Steering data to set the heading for.
+	         */
+	        void measureHeading(SteeringData &sd);
+
+	        /**
+	         * This method returns the distances measured by the last call
+	         * of measureDistances(): the horizontal position of the left
+	         * and right lane marking for every scan line and the vertical
+	         * position of the two stop line scans.
+	         *
+	         * @param left Positions of the left lane marking.
+	         * @param right Positions of the right lane marking.
+	         * @param up Positions of the stop line.
+	         */
+	        void getMeasuredDistances(vector<double> &left, vector<double> &right, vector<double> &up);
+
+	        /**
+	         * This method selects the positions of the scan lines
+	         * for the camera's tilt on the vehicle (true) or in the
+	         * simulation (false).
+	         *
+	         * @param headless true if running without a display.
+	         */
+	        void setHeadless(const bool &headless);
+
+	        /**
+	         * This method configures the preprocessing of the images.
+	         *
+	         * @param top Upper border of the region of interest (fraction of the image's height).
+	         * @param bottom Lower border of the region of interest (fraction of the image's height).
+	         * @param downscale Factor to downscale the region of interest with before detecting edges.
+	         */
+	        void setPreprocessing(const double &top, const double &bottom, const uint32_t &downscale);
+
         private:
 	        bool m_hasAttachedToSharedImageMemory;
 	        core::SharedPointer<core::wrapper::SharedMemory> m_sharedImageMemory;
+	        core::SharedPointer<core::base::SharedFrameRing> m_sharedImageRing;
 	        IplImage *m_image;
 	        IplImage *merge_image;
             bool m_debug;
+            bool m_headless;
+            bool m_drawing;
+            bool m_isRotated;
+            double m_roiTop;
+            double m_roiBottom;
+            uint32_t m_downscale;
+            core::SharedPointer<Preprocessor> m_preprocessor;
 
 			/* Scans for two valid lines in a vector of lines */
 			void validLines(std::vector<Lines>& lines, int LorR);
@@ -90,6 +160,9 @@ namespace msv {
             /* Measures the distance to full-white lines */
 			double measureDistance(int yPos, int dir, IplImage* image);
 
+			/* Draws a distance measured by measureDistance into the image */
+			void drawDistance(int yPos, int dir, int distance, IplImage* image);
+
 			/* Measures the angle between delta X and delta Y */
 			double measureAngle(IplImage *image);
 
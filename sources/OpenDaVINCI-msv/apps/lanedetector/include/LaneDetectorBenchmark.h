@@ -0,0 +1,108 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef LANEDETECTORBENCHMARK_H_
+#define LANEDETECTORBENCHMARK_H_
+
+#include <ostream>
+#include <string>
+
+#include "LaneDetector.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class measures the throughput of the lane detector's image
+     * processing without a running conference: The frames are read
+     * from a recording (.rec and its .mem file) one after another and
+     * are processed by the same methods as in LaneDetector::body().
+     *
+     * Command line arguments:
+     *
+     * --cid=<id>                       Conference id (not used but required by the module).
+     * --source=<url>                   Recording to read, for example file://recorder.rec.
+     * --frames=<n>                     Number of frames to process (0 for the entire recording).
+     * --headless=<0|1>                 Scan lines as configured for global.headless.
+     * --output=<file>                  CSV file to write the measured distances and the heading for every frame to.
+     * --memorySegmentSize=<bytes>      Size of one memory segment for replaying shared images.
+     * --numberOfMemorySegments=<n>     Number of memory segments for replaying shared images.
+     *
+     * As the measurements for every frame are written to the CSV
+     * file, optimizations can be checked for unchanged results.
+     */
+    class LaneDetectorBenchmark : public LaneDetector {
+        private:
+	        /**
+	         * "Forbidden" copy constructor. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the copy constructor.
+	         *
+	         * @param obj Reference to an object of this class.
+	         */
+	        LaneDetectorBenchmark(const LaneDetectorBenchmark &/*obj*/);
+
+	        /**
+	         * "Forbidden" assignment operator. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the assignment operator.
+	         *
+	         * @param obj Reference to an object of this class.
+	         * @return Reference to this instance.
+	         */
+	        LaneDetectorBenchmark& operator=(const LaneDetectorBenchmark &/*obj*/);
+
+        public:
+	        /**
+	         * Constructor.
+	         *
+	         * @param argc Number of command line arguments.
+	         * @param argv Command line arguments.
+	         */
+	        LaneDetectorBenchmark(const int32_t &argc, char **argv);
+
+	        virtual ~LaneDetectorBenchmark();
+
+	        /**
+	         * This method processes the recording and reports the results.
+	         *
+	         * @param out Stream to write the summary to.
+	         * @return Number of processed frames.
+	         */
+	        uint32_t benchmark(ostream &out);
+
+        private:
+	        void parseAdditionalCommandLineParameters(const int &argc, char **argv);
+
+        private:
+	        string m_source;
+	        uint32_t m_frames;
+	        bool m_benchmarkHeadless;
+	        string m_output;
+	        double m_roiTop;
+	        double m_roiBottom;
+	        uint32_t m_benchmarkDownscale;
+	        uint32_t m_memorySegmentSize;
+	        uint32_t m_numberOfMemorySegments;
+    };
+
+} // msv
+
+#endif /*LANEDETECTORBENCHMARK_H_*/
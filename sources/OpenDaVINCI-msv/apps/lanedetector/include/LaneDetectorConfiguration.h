@@ -0,0 +1,82 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef LANEDETECTORCONFIGURATION_H_
+#define LANEDETECTORCONFIGURATION_H_
+
+#include "core/base/ConfigurationValue.h"
+#include "core/base/KeyValueConfiguration.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class contains the lane detector's configuration resolved
+     * once when the module starts.
+     */
+    class LaneDetectorConfiguration {
+        private:
+	        /**
+	         * "Forbidden" assignment operator. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the assignment operator.
+	         *
+	         * @param obj Reference to an object of this class.
+	         * @return Reference to this instance.
+	         */
+	        LaneDetectorConfiguration& operator=(const LaneDetectorConfiguration &/*obj*/);
+
+        public:
+	        /**
+	         * Constructor.
+	         *
+	         * @param kvc Configuration to resolve the values from.
+	         */
+	        LaneDetectorConfiguration(const core::base::KeyValueConfiguration &kvc);
+
+	        /**
+	         * Copy constructor.
+	         *
+	         * @param obj Reference to an object of this class.
+	         */
+	        LaneDetectorConfiguration(const LaneDetectorConfiguration &obj);
+
+	        virtual ~LaneDetectorConfiguration();
+
+        public:
+	        /* 1 to show the measurements. */
+	        const core::base::ConfigurationValue<int32_t> debug;
+
+	        /* 1 if running without a display. */
+	        const core::base::ConfigurationValue<uint32_t> headless;
+
+	        /* Upper border of the rows in which edges are detected. */
+	        const core::base::ConfigurationValue<double> roiTop;
+
+	        /* Lower border of the rows in which edges are detected. */
+	        const core::base::ConfigurationValue<double> roiBottom;
+
+	        /* Factor to downscale these rows with before detecting edges. */
+	        const core::base::ConfigurationValue<uint32_t> downscale;
+    };
+
+} // msv
+
+#endif /*LANEDETECTORCONFIGURATION_H_*/
@@ -0,0 +1,98 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef LATESTFRAMESLOT_H_
+#define LATESTFRAMESLOT_H_
+
+#include "core/base/Condition.h"
+
+#include "PipelineFrame.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class connects two stages of the pipeline by one single
+     * slot. A newly put frame always replaces a frame that was not
+     * taken yet; thus, a slow stage never works on stale frames and
+     * never delays fresh ones.
+     */
+    class LatestFrameSlot {
+        private:
+	        /**
+	         * "Forbidden" copy constructor. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the copy constructor.
+	         *
+	         * @param obj Reference to an object of this class.
+	         */
+	        LatestFrameSlot(const LatestFrameSlot &/*obj*/);
+
+	        /**
+	         * "Forbidden" assignment operator. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the assignment operator.
+	         *
+	         * @param obj Reference to an object of this class.
+	         * @return Reference to this instance.
+	         */
+	        LatestFrameSlot& operator=(const LatestFrameSlot &/*obj*/);
+
+        public:
+	        LatestFrameSlot();
+
+	        virtual ~LatestFrameSlot();
+
+	        /**
+	         * This method puts a frame into the slot and wakes up
+	         * the waiting stage.
+	         *
+	         * @param frame Frame to put.
+	         * @return Replaced frame that was never taken (to be returned to the FramePool) or NULL.
+	         */
+	        PipelineFrame* put(PipelineFrame *frame);
+
+	        /**
+	         * This method takes the frame from the slot.
+	         *
+	         * @param timeout Maximum time to wait for a frame in milliseconds.
+	         * @return Frame or NULL if no frame was put in time.
+	         */
+	        PipelineFrame* take(const uint32_t &timeout);
+
+	        /**
+	         * This method wakes up a stage waiting in take().
+	         */
+	        void interrupt();
+
+	        /**
+	         * @return Number of frames that were replaced before being taken.
+	         */
+	        uint32_t getNumberOfDroppedFrames() const;
+
+        private:
+	        mutable core::base::Condition m_condition;
+	        PipelineFrame *m_frame;
+	        uint32_t m_numberOfDroppedFrames;
+    };
+
+} // msv
+
+#endif /*LATESTFRAMESLOT_H_*/
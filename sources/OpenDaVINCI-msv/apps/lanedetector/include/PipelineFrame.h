@@ -0,0 +1,162 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PIPELINEFRAME_H_
+#define PIPELINEFRAME_H_
+
+#include <vector>
+
+#include <opencv/cv.h>
+
+#include "core/base/Mutex.h"
+#include "core/data/TimeStamp.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class carries one camera frame through the stages of the
+     * lane detector's pipeline together with the time stamps when
+     * every stage has finished with it.
+     */
+    class PipelineFrame {
+        private:
+	        /**
+	         * "Forbidden" copy constructor. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the copy constructor.
+	         *
+	         * @param obj Reference to an object of this class.
+	         */
+	        PipelineFrame(const PipelineFrame &/*obj*/);
+
+	        /**
+	         * "Forbidden" assignment operator. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the assignment operator.
+	         *
+	         * @param obj Reference to an object of this class.
+	         * @return Reference to this instance.
+	         */
+	        PipelineFrame& operator=(const PipelineFrame &/*obj*/);
+
+        public:
+	        PipelineFrame();
+
+	        virtual ~PipelineFrame();
+
+	        /**
+	         * This method (re-)allocates the images if the frame's
+	         * dimensions have changed. The preprocessed image is
+	         * initially black.
+	         *
+	         * @param width Width of the camera image.
+	         * @param height Height of the camera image.
+	         * @param numberOfChannels Bytes per pixel of the camera image.
+	         */
+	        void allocate(const uint32_t &width, const uint32_t &height, const uint32_t &numberOfChannels);
+
+        public:
+	        /* Image as copied from the shared memory. */
+	        IplImage *m_raw;
+
+	        /* Preprocessed image (3 channels for grayscale cameras). */
+	        IplImage *m_image;
+
+	        /* Image to be measured (either m_raw or m_image). */
+	        IplImage *m_processed;
+
+	        /* true if m_processed must be read rotated by 180 degrees. */
+	        bool m_isRotated;
+
+	        uint32_t m_frameNumber;
+
+	        /* Time when the camera published the frame. */
+	        core::data::TimeStamp m_sent;
+
+	        /* Time when the frame was copied from the shared memory. */
+	        core::data::TimeStamp m_acquired;
+
+	        /* Time when the frame was preprocessed. */
+	        core::data::TimeStamp m_preprocessed;
+    };
+
+    /**
+     * This class recycles the frames of the pipeline to avoid
+     * allocating images per frame. Frames are created on demand;
+     * as every stage holds at most one frame and every slot between
+     * two stages holds at most one frame, only a handful of frames
+     * are ever created.
+     */
+    class FramePool {
+        private:
+	        /**
+	         * "Forbidden" copy constructor. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the copy constructor.
+	         *
+	         * @param obj Reference to an object of this class.
+	         */
+	        FramePool(const FramePool &/*obj*/);
+
+	        /**
+	         * "Forbidden" assignment operator. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the assignment operator.
+	         *
+	         * @param obj Reference to an object of this class.
+	         * @return Reference to this instance.
+	         */
+	        FramePool& operator=(const FramePool &/*obj*/);
+
+        public:
+	        FramePool();
+
+	        /**
+	         * Destructor. All frames created by this pool are deleted.
+	         */
+	        virtual ~FramePool();
+
+	        /**
+	         * @return Unused frame.
+	         */
+	        PipelineFrame* acquire();
+
+	        /**
+	         * This method returns a frame for reuse.
+	         *
+	         * @param frame Frame to return (NULL is ignored).
+	         */
+	        void release(PipelineFrame *frame);
+
+	        /**
+	         * @return Number of frames created by this pool.
+	         */
+	        uint32_t getNumberOfFrames();
+
+        private:
+	        core::base::Mutex m_mutex;
+	        vector<PipelineFrame*> m_frames;
+	        vector<PipelineFrame*> m_unusedFrames;
+    };
+
+} // msv
+
+#endif /*PIPELINEFRAME_H_*/
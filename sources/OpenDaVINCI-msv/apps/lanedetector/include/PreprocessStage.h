@@ -0,0 +1,86 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PREPROCESSSTAGE_H_
+#define PREPROCESSSTAGE_H_
+
+#include "core/base/Service.h"
+
+#include "LatestFrameSlot.h"
+#include "PipelineFrame.h"
+#include "Preprocessor.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class is the second stage of the lane detector's pipeline:
+     * It detects the edges in grayscale frames or rotates color frames
+     * and passes them to the measuring stage.
+     */
+    class PreprocessStage : public core::base::Service {
+        private:
+	        /**
+	         * "Forbidden" copy constructor. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the copy constructor.
+	         *
+	         * @param obj Reference to an object of this class.
+	         */
+	        PreprocessStage(const PreprocessStage &/*obj*/);
+
+	        /**
+	         * "Forbidden" assignment operator. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the assignment operator.
+	         *
+	         * @param obj Reference to an object of this class.
+	         * @return Reference to this instance.
+	         */
+	        PreprocessStage& operator=(const PreprocessStage &/*obj*/);
+
+        public:
+	        /**
+	         * Constructor.
+	         *
+	         * @param preprocessor Preprocessor to be used by this stage only.
+	         * @param framePool Pool to return replaced frames to.
+	         * @param input Slot to take the acquired frames from.
+	         * @param output Slot to pass the preprocessed frames to.
+	         */
+	        PreprocessStage(Preprocessor &preprocessor, FramePool &framePool, LatestFrameSlot &input, LatestFrameSlot &output);
+
+	        virtual ~PreprocessStage();
+
+        private:
+	        virtual void beforeStop();
+
+	        virtual void run();
+
+        private:
+	        Preprocessor &m_preprocessor;
+	        FramePool &m_framePool;
+	        LatestFrameSlot &m_input;
+	        LatestFrameSlot &m_output;
+    };
+
+} // msv
+
+#endif /*PREPROCESSSTAGE_H_*/
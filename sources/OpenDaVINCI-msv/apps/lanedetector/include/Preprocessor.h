@@ -0,0 +1,117 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef PREPROCESSOR_H_
+#define PREPROCESSOR_H_
+
+#include <opencv/cv.h>
+
+#include "core/platform.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class prepares a camera image for measuring the lane
+     * markings: Grayscale images are turned into dilated edges,
+     * color images are rotated by 180 degrees.
+     *
+     * As measureDistance() only scans a few rows, the edges are only
+     * detected in a region of interest given as fractions of the
+     * image's height; rows outside of this region are never written.
+     * Optionally, the region is downscaled before detecting edges
+     * and the edges are scaled up again afterwards.
+     *
+     * Instead of rotating color images, the rotation can be left to
+     * the reader of the image which remaps its indices.
+     */
+    class Preprocessor {
+        private:
+	        /**
+	         * "Forbidden" copy constructor. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the copy constructor.
+	         *
+	         * @param obj Reference to an object of this class.
+	         */
+	        Preprocessor(const Preprocessor &/*obj*/);
+
+	        /**
+	         * "Forbidden" assignment operator. Goal: The compiler should warn
+	         * already at compile time for unwanted bugs caused by any misuse
+	         * of the assignment operator.
+	         *
+	         * @param obj Reference to an object of this class.
+	         * @return Reference to this instance.
+	         */
+	        Preprocessor& operator=(const Preprocessor &/*obj*/);
+
+        public:
+	        /**
+	         * Constructor for processing entire images and rotating
+	         * color images.
+	         */
+	        Preprocessor();
+
+	        /**
+	         * Constructor.
+	         *
+	         * @param top Upper border of the region of interest (0 = top of the image).
+	         * @param bottom Lower border of the region of interest (1 = bottom of the image).
+	         * @param downscale Factor to downscale the region of interest with before detecting edges (1 = none).
+	         * @param remapRotation true if color images are not rotated but must be read with remapped indices.
+	         */
+	        Preprocessor(const double &top, const double &bottom, const uint32_t &downscale, const bool &remapRotation);
+
+	        virtual ~Preprocessor();
+
+	        /**
+	         * This method preprocesses one camera image.
+	         *
+	         * @param raw Image as copied from the shared memory; grayscale images are modified.
+	         * @param image Image for the results (3 channels for grayscale images); may be raw for color images.
+	         * @param isRotated true if the returned image must be read rotated by 180 degrees.
+	         * @return Image to be measured (raw or image).
+	         */
+	        IplImage* preprocess(IplImage *raw, IplImage *image, bool &isRotated);
+
+	        /**
+	         * This method returns the rows processed for an image.
+	         *
+	         * @param height Height of the image.
+	         * @param firstRow First processed row.
+	         * @param numberOfRows Number of processed rows.
+	         */
+	        void getRegionOfInterest(const int32_t &height, int32_t &firstRow, int32_t &numberOfRows) const;
+
+        private:
+	        void detectEdges(IplImage *raw, IplImage *image);
+
+        private:
+	        double m_top;
+	        double m_bottom;
+	        uint32_t m_downscale;
+	        bool m_remapRotation;
+	        IplImage *m_downscaled;
+    };
+
+} // msv
+
+#endif /*PREPROCESSOR_H_*/
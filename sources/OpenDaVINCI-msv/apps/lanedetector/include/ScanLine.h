@@ -0,0 +1,81 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SCANLINE_H_
+#define SCANLINE_H_
+
+#include "core/platform.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class searches for the first white pixel on one row of an
+     * image with interleaved channels; a pixel is white if its first
+     * three channels (or its only channel) are 255.
+     *
+     * The edge images of the lane detector are mostly black. Therefore,
+     * the rows are scanned in blocks of four pixels: All 32bit words of
+     * a block are checked at once whether any of their bytes is 255 and
+     * only such blocks are inspected pixel by pixel.
+     */
+    class ScanLine {
+        public:
+	        /**
+	         * This method scans from begin towards the end of the row.
+	         *
+	         * @param row Pointer to the row's first pixel.
+	         * @param begin Index of the first pixel to check.
+	         * @param end Index of the pixel to stop at (not checked).
+	         * @param numberOfChannels Bytes per pixel.
+	         * @return Index of the first white pixel or end if there is none.
+	         */
+	        static int32_t findWhitePixelForward(const unsigned char *row, const int32_t &begin, const int32_t &end, const int32_t &numberOfChannels);
+
+	        /**
+	         * This method scans from begin towards the start of the row.
+	         *
+	         * @param row Pointer to the row's first pixel.
+	         * @param begin Index of the first pixel to check.
+	         * @param end Index of the pixel to stop at (not checked; end < begin).
+	         * @param numberOfChannels Bytes per pixel.
+	         * @return Index of the first white pixel or end if there is none.
+	         */
+	        static int32_t findWhitePixelBackward(const unsigned char *row, const int32_t &begin, const int32_t &end, const int32_t &numberOfChannels);
+
+	        /**
+	         * @param pixel Pointer to the pixel's first channel.
+	         * @param numberOfChannels Bytes per pixel.
+	         * @return true if the pixel is white.
+	         */
+	        static bool isWhite(const unsigned char *pixel, const int32_t &numberOfChannels);
+
+        private:
+	        /**
+	         * @param block Pointer to the first pixel of a block of four pixels.
+	         * @param numberOfChannels Bytes per pixel.
+	         * @return true if any byte of the block is 255.
+	         */
+	        static bool hasWhiteByte(const unsigned char *block, const int32_t &numberOfChannels);
+    };
+
+} // msv
+
+#endif /*SCANLINE_H_*/
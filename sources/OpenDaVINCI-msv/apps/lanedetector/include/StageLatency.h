@@ -0,0 +1,101 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef STAGELATENCY_H_
+#define STAGELATENCY_H_
+
+#include <ostream>
+#include <string>
+
+#include "core/data/TimeStamp.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class accumulates the latencies of one stage of the
+     * lane detector's pipeline.
+     */
+    class StageLatency {
+        public:
+	        /**
+	         * Constructor.
+	         *
+	         * @param name Name of the stage.
+	         */
+	        StageLatency(const string &name);
+
+	        /**
+	         * Copy constructor.
+	         *
+	         * @param obj Reference to an object of this class.
+	         */
+	        StageLatency(const StageLatency &obj);
+
+	        /**
+	         * Assignment operator.
+	         *
+	         * @param obj Reference to an object of this class.
+	         * @return Reference to this instance.
+	         */
+	        StageLatency& operator=(const StageLatency &obj);
+
+	        virtual ~StageLatency();
+
+	        /**
+	         * This method adds the latency of one frame.
+	         *
+	         * @param begin Time when the stage received the frame.
+	         * @param end Time when the stage finished the frame.
+	         */
+	        void add(const core::data::TimeStamp &begin, const core::data::TimeStamp &end);
+
+	        /**
+	         * @return Number of frames.
+	         */
+	        uint32_t getNumberOfFrames() const;
+
+	        /**
+	         * @return Mean latency in microseconds.
+	         */
+	        double getMeanLatency() const;
+
+	        /**
+	         * @return Maximum latency in microseconds.
+	         */
+	        long getMaximumLatency() const;
+
+	        /**
+	         * This method writes the mean and maximum latency in milliseconds.
+	         *
+	         * @param out Stream to write to.
+	         */
+	        void write(ostream &out) const;
+
+        private:
+	        string m_name;
+	        uint32_t m_numberOfFrames;
+	        double m_sumOfLatencies;
+	        long m_maximumLatency;
+    };
+
+} // msv
+
+#endif /*STAGELATENCY_H_*/
@@ -0,0 +1,116 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "core/base/Thread.h"
+#include "core/wrapper/SharedMemoryFactory.h"
+
+#include "AcquireStage.h"
+
+namespace msv {
+
+    using namespace std;
+    using namespace core::base;
+    using namespace core::data;
+    using namespace core::data::image;
+
+    AcquireStage::AcquireStage(KeyValueDataStore &keyValueDataStore, FramePool &framePool, LatestFrameSlot &output) :
+        m_keyValueDataStore(keyValueDataStore),
+        m_framePool(framePool),
+        m_output(output),
+        m_sharedImageMemory(),
+        m_sharedImageRing(),
+        m_sharedImage(),
+        m_lastFrameNumber(0),
+        m_lastSent() {}
+
+    AcquireStage::~AcquireStage() {}
+
+    void AcquireStage::beforeStop() {}
+
+    void AcquireStage::run() {
+        serviceReady();
+
+        while (isRunning()) {
+            PipelineFrame *frame = m_framePool.acquire();
+
+            if (acquire(*frame)) {
+                // Any frame not yet taken by the preprocessing stage is stale now.
+                m_framePool.release(m_output.put(frame));
+            }
+            else {
+                m_framePool.release(frame);
+
+                // Poll for the next frame.
+                Thread::usleep(1000);
+            }
+        }
+    }
+
+    bool AcquireStage::isAttached() const {
+        return (m_sharedImageRing.isValid() && m_sharedImageRing->isValid());
+    }
+
+    bool AcquireStage::acquire(PipelineFrame &frame) {
+        // Frame rings count their frames; thus, the data store
+        // does not need to be queried as long as nothing changed.
+        if (isAttached() && m_sharedImageRing->isFrameRing() && (m_sharedImageRing->getLatestFrameNumber() == m_lastFrameNumber)) {
+            return false;
+        }
+
+        Container c = m_keyValueDataStore.get(Container::SHARED_IMAGE);
+        if (c.getDataType() != Container::SHARED_IMAGE) {
+            return false;
+        }
+
+        if (!isAttached()) {
+            m_sharedImage = c.getData<SharedImage>();
+            m_sharedImageMemory = core::wrapper::SharedMemoryFactory::attachToSharedMemory(m_sharedImage.getName());
+            m_sharedImageRing = core::SharedPointer<SharedFrameRing>(new SharedFrameRing(m_sharedImageMemory));
+            if (!isAttached()) {
+                return false;
+            }
+        }
+
+        // Plain shared memory segments are only announced by their containers.
+        const TimeStamp sent = c.getSentTimeStamp();
+        if (!m_sharedImageRing->isFrameRing() && (sent == m_lastSent)) {
+            return false;
+        }
+
+        const uint32_t numberOfChannels = m_sharedImage.getBytesPerPixel();
+        const uint32_t size = m_sharedImage.getWidth() * m_sharedImage.getHeight() * numberOfChannels;
+
+        frame.allocate(m_sharedImage.getWidth(), m_sharedImage.getHeight(), numberOfChannels);
+
+        uint32_t frameNumber = 0;
+        if ( (frame.m_raw == NULL) || !m_sharedImageRing->read(frame.m_raw->imageData, size, frameNumber) ) {
+            return false;
+        }
+
+        frame.m_frameNumber = frameNumber;
+        frame.m_sent = sent;
+        frame.m_acquired = TimeStamp();
+
+        m_lastFrameNumber = frameNumber;
+        m_lastSent = sent;
+
+        return true;
+    }
+
+} // msv
@@ -28,15 +28,22 @@
 #include "core/base/KeyValueConfiguration.h"
 #include "core/data/Container.h"
 #include "core/data/image/SharedImage.h"
+#include "core/data/TimeStamp.h"
 #include "core/io/ContainerConference.h"
 #include "core/wrapper/SharedMemoryFactory.h"
 
-#include "tools/player/Player.h"
-
 #include "GeneratedHeaders_Data.h"
 
+#include "AcquireStage.h"
 #include "LaneDetector.h"
+#include "LaneDetectorConfiguration.h"
+#include "LatestFrameSlot.h"
 #include "Lines.h"
+#include "PipelineFrame.h"
+#include "PreprocessStage.h"
+#include "Preprocessor.h"
+#include "ScanLine.h"
+#include "StageLatency.h"
 
 
 
@@ -47,14 +54,21 @@
     using namespace core::base;
     using namespace core::data;
     using namespace core::data::image;
-    using namespace tools::player;
 
     LaneDetector::LaneDetector(const int32_t &argc, char **argv) : ConferenceClientModule(argc, argv, "lanedetector"),
     m_hasAttachedToSharedImageMemory(false),
     m_sharedImageMemory(),
+    m_sharedImageRing(),
     m_image(NULL),
     merge_image(NULL),
     m_debug(false),
+    m_headless(false),
+    m_drawing(false),
+    m_isRotated(false),
+    m_roiTop(0),
+    m_roiBottom(1),
+    m_downscale(1),
+    m_preprocessor(new Preprocessor()),
 
     upline1(0.0, 0.0, 0.0),
     upline2(0.0, 0.0, 0.0),
@@ -119,71 +133,103 @@
                 m_sharedImageMemory
                 = core::wrapper::SharedMemoryFactory::attachToSharedMemory(
                     si.getName());
+                m_sharedImageRing = core::SharedPointer<SharedFrameRing>(new SharedFrameRing(m_sharedImageMemory));
+                m_hasAttachedToSharedImageMemory = m_sharedImageRing->isValid();
             }
             const uint32_t numberOfChannels = si.getBytesPerPixel();
+            const uint32_t size = si.getWidth() * si.getHeight() * numberOfChannels;
+            uint32_t frameNumber = 0;
         //Single channel version of image copy
-            if (m_sharedImageMemory->isValid()){
+            if (m_sharedImageRing.isValid() && m_sharedImageRing->isValid()){
+                bool hasFrame = false;
                 if(numberOfChannels == 1) {
-                // Lock the memory region to gain exclusive access. REMEMBER!!! DO NOT FAIL WITHIN lock() / unlock(), otherwise, the image producing process would fail.
-                    m_sharedImageMemory->lock();
-                    {
-                    // For example, simply show the image.
-                        if (merge_image == NULL) {
-                            merge_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
-                        }
-                        if (m_image == NULL){
-                            m_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, 3);
-                        }
-
-                    // Copying the image data is very expensive...
-                        if (merge_image != NULL) {
-                            memcpy(merge_image->imageData,
-                                m_sharedImageMemory->getSharedMemory(),
-                                si.getWidth() * si.getHeight() * numberOfChannels);
-                        }
+                    if (merge_image == NULL) {
+                        merge_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
+                    }
+                    if (m_image == NULL){
+                        m_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, 3);
+                    // Rows outside of the region of interest are never written.
+                        cvSetZero(m_image);
+                    }
+
+                // Copy the latest frame without blocking the image producer.
+                    if (merge_image != NULL) {
+                        hasFrame = m_sharedImageRing->read(merge_image->imageData, size, frameNumber);
                     }
                 }
             // Check if we could successfully attach to the shared memory.
                 else {
-                // Lock the memory region to gain exclusive access. REMEMBER!!! DO NOT FAIL WITHIN lock() / unlock(), otherwise, the image producing process would fail.
-                    m_sharedImageMemory->lock();
-                    {
-                    // For example, simply show the image.
-                        if (m_image == NULL) {
-                            m_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
-                        }
-
-                    // Copying the image data is very expensive...
-                        if (m_image != NULL) {
-                            memcpy(m_image->imageData,
-                                m_sharedImageMemory->getSharedMemory(),
-                                si.getWidth() * si.getHeight() * numberOfChannels);
-                        }
+                    if (m_image == NULL) {
+                        m_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
                     }
+
+                // Copy the latest frame without blocking the image producer.
+                    if (m_image != NULL) {
+                        hasFrame = m_sharedImageRing->read(m_image->imageData, size, frameNumber);
+                    }
+                }
+
+                if (!hasFrame) {
+                    return false;
                 }
-            // Release the memory region so that the image produce (i.e. the camera for example) can provide the next raw image data.
-                m_sharedImageMemory->unlock();
 
                 if(numberOfChannels == 1){
-                    cvSmooth( merge_image, merge_image, CV_GAUSSIAN, 11, 11 );
-                    cvCanny( merge_image, merge_image, 120, 60, 3 );
-                    cvDilate(merge_image, merge_image,NULL,1);
-                    cvMerge(merge_image, merge_image, merge_image, NULL, m_image);
+                    m_preprocessor->preprocess(merge_image, m_image, m_isRotated);
                 }
-            // Mirror the image.
-                if(numberOfChannels != 1){
-                    cvFlip(m_image, 0, -1);
+                else {
+                    m_preprocessor->preprocess(m_image, m_image, m_isRotated);
                 }
                 retVal = true;
             }
         }
-        imgWidth = m_image->width;
-        imgHeight = m_image->height;
+        if (m_image != NULL) {
+            imgWidth = m_image->width;
+            imgHeight = m_image->height;
+        }
         return retVal;
     }
     
     
+    void LaneDetector::setHeadless(const bool &headless) {
+        m_headless = headless;
+    }
+
+    void LaneDetector::setPreprocessing(const double &top, const double &bottom, const uint32_t &downscale) {
+        m_roiTop = top;
+        m_roiBottom = bottom;
+        m_downscale = downscale;
+
+        // Color images are only rotated if they are shown.
+        m_preprocessor = core::SharedPointer<Preprocessor>(new Preprocessor(m_roiTop, m_roiBottom, m_downscale, !m_debug));
+    }
+
     void LaneDetector::processImage() {
+        SteeringData sd;
+        LaneData ld;
+        measure(sd, ld);
+
+        // Shows the image.
+        if (m_debug) {
+            if (m_image != NULL) {
+                cvShowImage("LaneDetector", m_image);
+                cvWaitKey(10);
+            }
+        }
+
+        // Create container for finally sending the data.
+        Container c(Container::USER_DATA_1, sd);
+        Container c2(Container::USER_DATA_3, ld);
+        // Send container.
+        getConference().send(c);
+        getConference().send(c2);
+    }
+
+    void LaneDetector::measure(SteeringData &sd, LaneData &ld) {
+        measureDistances(sd, ld);
+        measureHeading(sd);
+    }
+
+    void LaneDetector::measureDistances(SteeringData &sd, LaneData &ld) {
         setLines(m_image);
         validLines(leftList,0);
         validLines(rightList,1);
@@ -216,8 +262,6 @@
             }
         }
 
-        SteeringData sd;
-        LaneData ld;
         ld.setRightLine1(rightLength);
         ld.setLeftLine(leftLength);
 
@@ -229,87 +273,108 @@
 
         rightError = rightList[0].getCritical() - rightList[0].getXPos();
         leftError = validLeft.begin()->getXPos()-validLeft.begin()->getCritical();
+    }
 
+    void LaneDetector::measureHeading(SteeringData &sd) {
         sd.setHeadingData(measureAngle(m_image));
+    }
 
-
-        // Shows the image.
-        if (m_debug) {
-            if (m_image != NULL) {
-                cvShowImage("LaneDetector", m_image);
-                cvWaitKey(10);
-            }
+    void LaneDetector::getMeasuredDistances(vector<double> &left, vector<double> &right, vector<double> &up) {
+        left.clear();
+        right.clear();
+        up.clear();
+        for (int i = 0; i < SIZE; ++i) {
+            left.push_back(leftList[i].getXPos());
+            right.push_back(rightList[i].getXPos());
         }
-
-        cout << "Create Containers" << endl;
-        // Create container for finally sending the data.
-        Container c(Container::USER_DATA_1, sd);
-        Container c2(Container::USER_DATA_3, ld);
-        cout << "Send Containers" << endl;
-        // Send container.
-        getConference().send(c);
-        getConference().send(c2);
-        cout << "Processed image" << endl;
+        up.push_back(upline1.getYPos());
+        up.push_back(upline2.getYPos());
     }
 
 
     // This method will do the main data processing job.
-    // Therefore, it tries to open the real camera first. If that fails, the virtual camera images from camgen are used.
+    // Acquiring and preprocessing the camera images run in their own threads
+    // while the measurements on the latest preprocessed image are done here.
     ModuleState::MODULE_EXITCODE LaneDetector::body() {
     // Get configuration data.
-        KeyValueConfiguration kv = getKeyValueConfiguration();
-        m_debug = kv.getValue<int32_t> ("lanedetector.debug") == 1;
+        const LaneDetectorConfiguration configuration(getKeyValueConfiguration());
+        m_debug = configuration.debug == 1;
+        m_headless = configuration.headless == 1;
+        m_drawing = m_debug && !m_headless;
 
-        Player *player = NULL;
+        // The edges are only detected in the rows used by the measurements.
+        setPreprocessing(configuration.roiTop, configuration.roiBottom, configuration.downscale);
 
         uint32_t lanecounter = 0;
         time_t startTime = time(0);
         double cumduration;
-    /*
-        // Lane-detector can also directly read the data from file. This might be interesting to inspect the algorithm step-wisely.
-        core::io::URL url("file://recorder.rec");
-        // Size of the memory buffer.
-        const uint32_t MEMORY_SEGMENT_SIZE = kv.getValue<uint32_t>("global.buffer.memorySegmentSize");
-        // Number of memory segments.
-        const uint32_t NUMBER_OF_SEGMENTS = kv.getValue<uint32_t>("global.buffer.numberOfMemorySegments");
-        // If AUTO_REWIND is true, the file will be played endlessly.
-        const bool AUTO_REWIND = true;
-        player = new Player(url, AUTO_REWIND, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS);
-     */
+
+        // Every stage passes its latest frame through a single slot; frames
+        // not taken by the next stage in time are replaced by newer ones.
+        FramePool framePool;
+        LatestFrameSlot acquiredFrames;
+        LatestFrameSlot preprocessedFrames;
+        AcquireStage acquireStage(getKeyValueDataStore(), framePool, acquiredFrames);
+        // The preprocessing stage is the only user of m_preprocessor while the pipeline runs.
+        PreprocessStage preprocessStage(*m_preprocessor, framePool, acquiredFrames, preprocessedFrames);
+
+        StageLatency acquireLatency("acquire");
+        StageLatency preprocessLatency("preprocess");
+        StageLatency measureLatency("measure");
+        StageLatency endToEndLatency("end-to-end");
+
+        acquireStage.start();
+        preprocessStage.start();
+
+        // Wait at most one time slice for the next frame so that a frame
+        // is measured as soon as it is preprocessed. Time slices shorter
+        // than 1ms must not turn take() into a busy poll.
+        const uint32_t TIME_SLICE = static_cast<uint32_t>(1000.0 / getFrequency());
+        const uint32_t TIMEOUT = (TIME_SLICE > 0) ? TIME_SLICE : 1;
 
         // "Working horse."
         while (getModuleState() == ModuleState::RUNNING) {
-            bool has_next_frame = false;
+            PipelineFrame *frame = preprocessedFrames.take(TIMEOUT);
 
-            // Use the shared memory image.
-            Container c;
-            if (player != NULL) {
-            // Read the next container from file.
-                c = player->getNextContainerToBeSent();
-            }
-            else {
-            // Get the most recent available container for a SHARED_IMAGE.
-                c = getKeyValueDataStore().get(Container::SHARED_IMAGE);
-            }
+            // Process the latest image.
+            if (frame != NULL) {
+                m_image = frame->m_processed;
+                m_isRotated = frame->m_isRotated;
+                imgWidth = m_image->width;
+                imgHeight = m_image->height;
 
-            if (c.getDataType() == Container::SHARED_IMAGE) {
-            // Example for processing the received container.
-                has_next_frame = readSharedImage(c);
-            }
-            cout << "has_next_frame = "<< has_next_frame << endl;
-            // Process the read image.
-            if (true == has_next_frame) {
                 processImage();
+                m_image = NULL;
                 lanecounter++;
+
+                const TimeStamp measured;
+                acquireLatency.add(frame->m_sent, frame->m_acquired);
+                preprocessLatency.add(frame->m_acquired, frame->m_preprocessed);
+                measureLatency.add(frame->m_preprocessed, measured);
+                endToEndLatency.add(frame->m_sent, measured);
+
+                framePool.release(frame);
             }
-            cout << "lanecounter =" << lanecounter << endl;
         }
+
+        acquireStage.stop();
+        preprocessStage.stop();
+
         cout << "LaneDetector: processed " << lanecounter << " frames." << endl;
         time_t endTime = time(0);
         cumduration = difftime(endTime, startTime);
         cout << "LaneDetector: processed " << lanecounter/cumduration << " frames per sec." << endl;
 
-        OPENDAVINCI_CORE_DELETE_POINTER(player);
+        cout << "LaneDetector: ";
+        acquireLatency.write(cout);
+        cout << "LaneDetector: ";
+        preprocessLatency.write(cout);
+        cout << "LaneDetector: ";
+        measureLatency.write(cout);
+        cout << "LaneDetector: ";
+        endToEndLatency.write(cout);
+        cout << "LaneDetector: skipped " << acquiredFrames.getNumberOfDroppedFrames() << " frames before preprocessing and "
+             << preprocessedFrames.getNumberOfDroppedFrames() << " frames before measuring." << endl;
 
         return ModuleState::OKAY;
     }
@@ -318,13 +383,12 @@
         imgWidth = image->width;
         imgHeight = image->height;
         double distance = 0.04;
-        const bool headless = getKeyValueConfiguration().getValue<uint32_t>("global.headless") == 1;
         if(yCount < 1) {
 
             /*---If running on Odroid (though is also ugly but functional on sim) 
                 use higher lines to handle acute camera tilt---*/
 
-            if(headless){
+            if(m_headless){
 
                 for(int i = 0; i < SIZE; ++i){
                     rightList[i].setYPos(round(imgHeight * distance *(i+6)));
@@ -348,8 +412,10 @@
         upline1.setYPos(measureDistance(upline1.getXPos(), 2, m_image));
         upline2.setYPos(measureDistance(upline2.getXPos(), 2, m_image));
 
-        cout<< " distance upline1 is:" << upline1.getYPos() <<endl;
-        cout<< " distance upline2 is:" << upline2.getYPos() <<endl;
+        if (m_debug) {
+            cout<< " distance upline1 is:" << upline1.getYPos() <<endl;
+            cout<< " distance upline2 is:" << upline2.getYPos() <<endl;
+        }
        
 
         for (int i = 0; i < SIZE; ++i){
@@ -449,7 +515,7 @@
                     length = 2;
                 }
                 //draw lines
-                for(int j=0; j<length; ++j){
+                for(int j=0; (j<length) && m_drawing; ++j){
                     ptBegin.x = x/2;
                     ptBegin.y= y;
                     ptEnd.x =((tempListRight[j].getXPos()-tempListLeft[j].getXPos())/2)
@@ -472,7 +538,9 @@
                     }
                     ptEnd.x = alphaX+x/2;
                     ptEnd.y =y-tempListLeft[i].getYPos();
-                    line(newImage, ptBegin, ptEnd, cvScalar(255, 100, 0), 2, 8);
+                    if (m_drawing) {
+                        line(newImage, ptBegin, ptEnd, cvScalar(255, 100, 0), 2, 8);
+                    }
                     if(alphaX == 0 ){
                         array[i] = 0.0;
                     }else{
@@ -487,8 +555,10 @@
                 else if (angle* Constants::RAD2DEG < -26)
                     angle = -26* Constants::DEG2RAD;
 
-                cout << "THE ANGLE WILL BE ----------->>>>>>>>>>    " << angle 
-                << " <-radius   degree->"<< angle* Constants::RAD2DEG <<endl;
+                if (m_debug) {
+                    cout << "THE ANGLE WILL BE ----------->>>>>>>>>>    " << angle 
+                    << " <-radius   degree->"<< angle* Constants::RAD2DEG <<endl;
+                }
                 tempAngle = angle;
             }else {
                 angle = tempAngle;
@@ -496,8 +566,10 @@
         }else{
             /*---follow tempangle in case of no data---*/
             angle = tempAngle;
-            cout << "THE TEMP ANGLE WILL BE ----------->>>>>>>>>>    " << angle 
-            << " <-radius   degree->"<< angle* Constants::RAD2DEG <<endl;
+            if (m_debug) {
+                cout << "THE TEMP ANGLE WILL BE ----------->>>>>>>>>>    " << angle 
+                << " <-radius   degree->"<< angle* Constants::RAD2DEG <<endl;
+            }
         }
         return angle;
     }
@@ -527,7 +599,55 @@
         int step = image->widthStep;
         int channel = image->nChannels;
     //pointer to aligned data
-        uchar* data = (uchar*)image->imageData;
+        const unsigned char* data = (const unsigned char*)image->imageData;
+
+    // Rotated images are read by remapping row r to y-1-r and column c to x-1-c.
+    // Scans for full-white line to the right
+        if (dir == 1){
+            if (m_isRotated) {
+                i = x-1 - ScanLine::findWhitePixelBackward(data + (yPos-1)*step, x-1-x/2, 0, channel);
+            }
+            else {
+                i = ScanLine::findWhitePixelForward(data + (y-yPos)*step, x/2, x-1, channel);
+            }
+        }
+    // Scans for full-white line to the left
+        else if (dir==0){
+            if (m_isRotated) {
+                i = x-1 - ScanLine::findWhitePixelForward(data + (yPos-1)*step, x-1-x/2, x-2, channel);
+            }
+            else {
+                i = ScanLine::findWhitePixelBackward(data + (y-yPos)*step, x/2, 1, channel);
+            }
+        }
+    // Scans for upper full-white line
+        else {
+            int startPoint = round (rightList[0].getYPos());
+            const unsigned char* pixel = data + step*(y-startPoint) + yPos*channel;
+            int rowStep = -step;
+            if (m_isRotated) {
+                pixel = data + step*(startPoint-1) + (x-1-yPos)*channel;
+                rowStep = step;
+            }
+            for(i =0; i< y-startPoint; ++i){
+                if (ScanLine::isWhite(pixel, channel)){
+                    break;
+                }
+                pixel += rowStep;
+            }
+            i+=startPoint;
+        }
+
+    // The measurements are only drawn into the image if it is shown.
+        if (m_drawing) {
+            drawDistance(yPos, dir, i, image);
+        }
+        return i;
+    }
+
+    void LaneDetector::drawDistance(int yPos, int dir, int distance, IplImage* image) {
+        int x = image->width;
+        int y = image->height;
 
     // OpenCV variable declarations and instantiations
         cv::Mat newImage = cv::cvarrToMat(image);
@@ -545,61 +665,20 @@
         ptDown.y = y;
         ptUp.x = yPos;
 
-    // Scans for full-white line to the right
         if (dir == 1){
-            for(i = x/2; i<x-1; ++i){
-                int r = data[(y-yPos)*step + i*channel + 0];
-                int g = data[(y-yPos)*step + i*channel + 1];
-                int b = data[(y-yPos)*step + i*channel + 2];
-
-                if (r == 255 && g == 255 && b == 255){
-                    ptRight.x = i;
-                    break;
-                }
-            }
-            if(ptRight.x > x/2){
-                line(newImage, ptMiddle, ptRight, cvScalar(51,255,102), 3, 8);
-            }else{
-                ptRight.x = x-1;
-                line(newImage, ptMiddle, ptRight, cvScalar(51,255,102), 3, 8);
-            }
+            ptRight.x = (distance > x/2) ? distance : x-1;
+            line(newImage, ptMiddle, ptRight, cvScalar(51,255,102), 3, 8);
         }
-    // Scans for full-white line to the left
         else if (dir==0){
-
-            for(i = x/2; i>1; --i){
-                int r = data[(y-yPos)*step + i*channel + 0];
-                int g = data[(y-yPos)*step + i*channel + 1];
-                int b = data[(y-yPos)*step + i*channel + 2];
-
-                if (r == 255 && g == 255 && b == 255){
-                    ptLeft.x = i;
-                    break;
-                }
-            }
+        // No line was found if the scan reached the left border.
+            ptLeft.x = (distance > 1) ? distance : 0;
             line(newImage, ptLeft,ptMiddle, cvScalar(204,51,255), 3, 8);
         }
-    // Scans for upper full-white line
         else {
-        	            
-        	int startPoint = round (rightList[0].getYPos());
-            for(i =0; i< y-startPoint; ++i){
-                int r = data[step*(y-startPoint)+ yPos*channel + 0 -i*step];
-                int g = data[step*(y-startPoint)+ yPos*channel + 1 -i*step];
-                int b = data[step*(y-startPoint)+ yPos*channel + 2 -i*step];
-
-                if (r == 255 && g == 255 && b == 255){
-                    ptUp.y = y-i-startPoint;
-                    break;
-                }
-            }
-            i+=startPoint;
-
-            cout<< "i is " <<i <<endl;
-            ptDown.y -= round (rightList[0].getYPos());
-            cout<< "ptUp.y is " << ptUp.y <<endl;
+            int startPoint = round (rightList[0].getYPos());
+            ptUp.y = (distance < y) ? (y-distance) : 0;
+            ptDown.y -= startPoint;
             line(newImage, ptDown, ptUp, cvScalar(0,184,245), 1, 8);
         }
-        return i;
     }
 } // msv
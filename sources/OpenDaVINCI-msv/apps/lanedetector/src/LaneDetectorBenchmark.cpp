@@ -0,0 +1,245 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "core/StringToolbox.h"
+#include "core/base/CommandLineParser.h"
+#include "core/data/Container.h"
+#include "core/data/TimeStamp.h"
+#include "core/io/URL.h"
+
+#include "tools/player/Player.h"
+
+#include "GeneratedHeaders_Data.h"
+
+#include "LaneDetectorBenchmark.h"
+#include "StageLatency.h"
+
+namespace msv {
+
+    using namespace std;
+    using namespace core::base;
+    using namespace core::data;
+    using namespace tools::player;
+
+    LaneDetectorBenchmark::LaneDetectorBenchmark(const int32_t &argc, char **argv) :
+        LaneDetector(argc, argv),
+        m_source(),
+        m_frames(0),
+        m_benchmarkHeadless(false),
+        m_output(),
+        m_roiTop(0),
+        m_roiBottom(1),
+        m_benchmarkDownscale(1),
+        m_memorySegmentSize(2800000),
+        m_numberOfMemorySegments(20) {
+        // Parse command line arguments.
+        parseAdditionalCommandLineParameters(argc, argv);
+    }
+
+    LaneDetectorBenchmark::~LaneDetectorBenchmark() {}
+
+    void LaneDetectorBenchmark::parseAdditionalCommandLineParameters(const int &argc, char **argv) {
+        CommandLineParser cmdParser;
+        cmdParser.addCommandLineArgument("source");
+        cmdParser.addCommandLineArgument("frames");
+        cmdParser.addCommandLineArgument("headless");
+        cmdParser.addCommandLineArgument("output");
+        cmdParser.addCommandLineArgument("roiTop");
+        cmdParser.addCommandLineArgument("roiBottom");
+        cmdParser.addCommandLineArgument("downscale");
+        cmdParser.addCommandLineArgument("memorySegmentSize");
+        cmdParser.addCommandLineArgument("numberOfMemorySegments");
+
+        cmdParser.parse(argc, argv);
+
+        CommandLineArgument cmdArgumentSOURCE = cmdParser.getCommandLineArgument("source");
+        CommandLineArgument cmdArgumentFRAMES = cmdParser.getCommandLineArgument("frames");
+        CommandLineArgument cmdArgumentHEADLESS = cmdParser.getCommandLineArgument("headless");
+        CommandLineArgument cmdArgumentOUTPUT = cmdParser.getCommandLineArgument("output");
+        CommandLineArgument cmdArgumentROITOP = cmdParser.getCommandLineArgument("roiTop");
+        CommandLineArgument cmdArgumentROIBOTTOM = cmdParser.getCommandLineArgument("roiBottom");
+        CommandLineArgument cmdArgumentDOWNSCALE = cmdParser.getCommandLineArgument("downscale");
+        CommandLineArgument cmdArgumentMEMORYSEGMENTSIZE = cmdParser.getCommandLineArgument("memorySegmentSize");
+        CommandLineArgument cmdArgumentNUMBEROFMEMORYSEGMENTS = cmdParser.getCommandLineArgument("numberOfMemorySegments");
+
+        if (cmdArgumentSOURCE.isSet()) {
+            m_source = cmdArgumentSOURCE.getValue<string>();
+            core::StringToolbox::trim(m_source);
+        }
+
+        if (cmdArgumentFRAMES.isSet()) {
+            m_frames = cmdArgumentFRAMES.getValue<uint32_t>();
+        }
+
+        if (cmdArgumentHEADLESS.isSet()) {
+            m_benchmarkHeadless = (cmdArgumentHEADLESS.getValue<uint32_t>() == 1);
+        }
+
+        if (cmdArgumentOUTPUT.isSet()) {
+            m_output = cmdArgumentOUTPUT.getValue<string>();
+            core::StringToolbox::trim(m_output);
+        }
+
+        if (cmdArgumentROITOP.isSet()) {
+            m_roiTop = cmdArgumentROITOP.getValue<double>();
+        }
+
+        if (cmdArgumentROIBOTTOM.isSet()) {
+            m_roiBottom = cmdArgumentROIBOTTOM.getValue<double>();
+        }
+
+        if (cmdArgumentDOWNSCALE.isSet()) {
+            m_benchmarkDownscale = cmdArgumentDOWNSCALE.getValue<uint32_t>();
+        }
+
+        if (cmdArgumentMEMORYSEGMENTSIZE.isSet()) {
+            m_memorySegmentSize = cmdArgumentMEMORYSEGMENTSIZE.getValue<uint32_t>();
+        }
+
+        if (cmdArgumentNUMBEROFMEMORYSEGMENTS.isSet()) {
+            m_numberOfMemorySegments = cmdArgumentNUMBEROFMEMORYSEGMENTS.getValue<uint32_t>();
+        }
+    }
+
+    uint32_t LaneDetectorBenchmark::benchmark(ostream &out) {
+        if (m_source.size() == 0) {
+            out << "LaneDetectorBenchmark: No recording given; use --source=file://recorder.rec" << endl;
+            return 0;
+        }
+
+        setHeadless(m_benchmarkHeadless);
+        setPreprocessing(m_roiTop, m_roiBottom, m_benchmarkDownscale);
+
+        ofstream csv;
+        if (m_output.size() > 0) {
+            csv.open(m_output.c_str(), ios::out | ios::trunc);
+            csv << fixed << setprecision(6);
+        }
+        bool hasWrittenHeader = false;
+
+        // Replay the recording synchronously to process every frame exactly once.
+        const bool AUTO_REWIND = false;
+        const bool THREADING = false;
+        core::io::URL url(m_source);
+        Player player(url, AUTO_REWIND, m_memorySegmentSize, m_numberOfMemorySegments, THREADING);
+
+        StageLatency readLatency("readSharedImage");
+        StageLatency distanceLatency("measureDistance");
+        StageLatency angleLatency("measureAngle");
+        StageLatency totalLatency("total");
+
+        vector<double> left;
+        vector<double> right;
+        vector<double> up;
+
+        uint32_t frames = 0;
+        const TimeStamp start;
+        while (player.hasMoreData() && ( (m_frames == 0) || (frames < m_frames) )) {
+            Container c = player.getNextContainerToBeSent();
+            if (c.getDataType() != Container::SHARED_IMAGE) {
+                continue;
+            }
+
+            const TimeStamp beforeRead;
+            if (!readSharedImage(c)) {
+                continue;
+            }
+            const TimeStamp afterRead;
+
+            SteeringData sd;
+            LaneData ld;
+            measureDistances(sd, ld);
+            const TimeStamp afterDistances;
+
+            measureHeading(sd);
+            const TimeStamp afterAngle;
+
+            readLatency.add(beforeRead, afterRead);
+            distanceLatency.add(afterRead, afterDistances);
+            angleLatency.add(afterDistances, afterAngle);
+            totalLatency.add(beforeRead, afterAngle);
+
+            if (csv.is_open()) {
+                getMeasuredDistances(left, right, up);
+
+                // The number of scan lines is only known after the first frame.
+                if (!hasWrittenHeader) {
+                    csv << "frame,heading,intersection";
+                    for (uint32_t i = 0; i < left.size(); i++) {
+                        csv << ",left" << i;
+                    }
+                    for (uint32_t i = 0; i < right.size(); i++) {
+                        csv << ",right" << i;
+                    }
+                    for (uint32_t i = 0; i < up.size(); i++) {
+                        csv << ",up" << i;
+                    }
+                    csv << endl;
+                    hasWrittenHeader = true;
+                }
+
+                csv << frames << ","
+                    << sd.getHeadingData() << ","
+                    << sd.getIntersectionLine();
+                for (uint32_t i = 0; i < left.size(); i++) {
+                    csv << "," << left.at(i);
+                }
+                for (uint32_t i = 0; i < right.size(); i++) {
+                    csv << "," << right.at(i);
+                }
+                for (uint32_t i = 0; i < up.size(); i++) {
+                    csv << "," << up.at(i);
+                }
+                csv << "\n";
+            }
+
+            frames++;
+        }
+        const TimeStamp end;
+
+        if (csv.is_open()) {
+            csv.flush();
+            csv.close();
+        }
+
+        const double duration = (end - start).toMicroseconds() / 1000000.0;
+        out << "LaneDetectorBenchmark: processed " << frames << " frames in " << duration << "s";
+        if (duration > 0) {
+            out << " (" << (frames / duration) << " frames per sec)";
+        }
+        out << "." << endl;
+
+        out << "LaneDetectorBenchmark: ";
+        readLatency.write(out);
+        out << "LaneDetectorBenchmark: ";
+        distanceLatency.write(out);
+        out << "LaneDetectorBenchmark: ";
+        angleLatency.write(out);
+        out << "LaneDetectorBenchmark: ";
+        totalLatency.write(out);
+
+        return frames;
+    }
+
+} // msv
@@ -0,0 +1,43 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "LaneDetectorConfiguration.h"
+
+namespace msv {
+
+    using namespace std;
+    using namespace core::base;
+
+    LaneDetectorConfiguration::LaneDetectorConfiguration(const KeyValueConfiguration &kvc) :
+        debug(kvc, "lanedetector.debug"),
+        headless(kvc, "global.headless"),
+        roiTop(kvc, "lanedetector.roi.top", 0),
+        roiBottom(kvc, "lanedetector.roi.bottom", 1),
+        downscale(kvc, "lanedetector.downscale", 1) {}
+
+    LaneDetectorConfiguration::LaneDetectorConfiguration(const LaneDetectorConfiguration &obj) :
+        debug(obj.debug),
+        headless(obj.headless),
+        roiTop(obj.roiTop),
+        roiBottom(obj.roiBottom),
+        downscale(obj.downscale) {}
+
+    LaneDetectorConfiguration::~LaneDetectorConfiguration() {}
+
+} // msv
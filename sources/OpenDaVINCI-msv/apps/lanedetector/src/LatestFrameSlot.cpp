@@ -0,0 +1,67 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "core/base/Lock.h"
+
+#include "LatestFrameSlot.h"
+
+namespace msv {
+
+    using namespace std;
+    using namespace core::base;
+
+    LatestFrameSlot::LatestFrameSlot() :
+        m_condition(),
+        m_frame(NULL),
+        m_numberOfDroppedFrames(0) {}
+
+    LatestFrameSlot::~LatestFrameSlot() {}
+
+    PipelineFrame* LatestFrameSlot::put(PipelineFrame *frame) {
+        Lock l(m_condition);
+        PipelineFrame *replacedFrame = m_frame;
+        if (replacedFrame != NULL) {
+            m_numberOfDroppedFrames++;
+        }
+        m_frame = frame;
+        m_condition.wakeAll();
+        return replacedFrame;
+    }
+
+    PipelineFrame* LatestFrameSlot::take(const uint32_t &timeout) {
+        Lock l(m_condition);
+        if ( (m_frame == NULL) && (timeout > 0) ) {
+            m_condition.waitOnSignalWithTimeout(timeout);
+        }
+        PipelineFrame *frame = m_frame;
+        m_frame = NULL;
+        return frame;
+    }
+
+    void LatestFrameSlot::interrupt() {
+        Lock l(m_condition);
+        m_condition.wakeAll();
+    }
+
+    uint32_t LatestFrameSlot::getNumberOfDroppedFrames() const {
+        Lock l(m_condition);
+        return m_numberOfDroppedFrames;
+    }
+
+} // msv
@@ -0,0 +1,110 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "core/base/Lock.h"
+
+#include "PipelineFrame.h"
+
+namespace msv {
+
+    using namespace std;
+    using namespace core::base;
+    using namespace core::data;
+
+    PipelineFrame::PipelineFrame() :
+        m_raw(NULL),
+        m_image(NULL),
+        m_processed(NULL),
+        m_isRotated(false),
+        m_frameNumber(0),
+        m_sent(),
+        m_acquired(),
+        m_preprocessed() {}
+
+    PipelineFrame::~PipelineFrame() {
+        if (m_raw != NULL) {
+            cvReleaseImage(&m_raw);
+        }
+        if (m_image != NULL) {
+            cvReleaseImage(&m_image);
+        }
+    }
+
+    void PipelineFrame::allocate(const uint32_t &width, const uint32_t &height, const uint32_t &numberOfChannels) {
+        // Grayscale images are merged into three channels during preprocessing.
+        const uint32_t numberOfImageChannels = (numberOfChannels == 1) ? 3 : numberOfChannels;
+
+        if ( (m_raw != NULL) &&
+             ( (static_cast<uint32_t>(m_raw->width) != width) ||
+               (static_cast<uint32_t>(m_raw->height) != height) ||
+               (static_cast<uint32_t>(m_raw->nChannels) != numberOfChannels) ) ) {
+            cvReleaseImage(&m_raw);
+            cvReleaseImage(&m_image);
+        }
+
+        if (m_raw == NULL) {
+            m_raw = cvCreateImage(cvSize(width, height), IPL_DEPTH_8U, numberOfChannels);
+            m_image = cvCreateImage(cvSize(width, height), IPL_DEPTH_8U, numberOfImageChannels);
+
+            // Rows outside of the preprocessor's region of interest are never written.
+            cvSetZero(m_image);
+        }
+    }
+
+    FramePool::FramePool() :
+        m_mutex(),
+        m_frames(),
+        m_unusedFrames() {}
+
+    FramePool::~FramePool() {
+        Lock l(m_mutex);
+        for (uint32_t i = 0; i < m_frames.size(); i++) {
+            delete m_frames[i];
+        }
+        m_frames.clear();
+        m_unusedFrames.clear();
+    }
+
+    PipelineFrame* FramePool::acquire() {
+        Lock l(m_mutex);
+        PipelineFrame *frame = NULL;
+        if (m_unusedFrames.empty()) {
+            frame = new PipelineFrame();
+            m_frames.push_back(frame);
+        }
+        else {
+            frame = m_unusedFrames.back();
+            m_unusedFrames.pop_back();
+        }
+        return frame;
+    }
+
+    void FramePool::release(PipelineFrame *frame) {
+        if (frame != NULL) {
+            Lock l(m_mutex);
+            m_unusedFrames.push_back(frame);
+        }
+    }
+
+    uint32_t FramePool::getNumberOfFrames() {
+        Lock l(m_mutex);
+        return m_frames.size();
+    }
+
+} // msv
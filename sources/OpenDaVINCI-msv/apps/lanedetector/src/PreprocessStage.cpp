@@ -0,0 +1,60 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "core/data/TimeStamp.h"
+
+#include "PreprocessStage.h"
+
+namespace msv {
+
+    using namespace std;
+    using namespace core::base;
+    using namespace core::data;
+
+    PreprocessStage::PreprocessStage(Preprocessor &preprocessor, FramePool &framePool, LatestFrameSlot &input, LatestFrameSlot &output) :
+        m_preprocessor(preprocessor),
+        m_framePool(framePool),
+        m_input(input),
+        m_output(output) {}
+
+    PreprocessStage::~PreprocessStage() {}
+
+    void PreprocessStage::beforeStop() {
+        // Do not wait for the next frame.
+        m_input.interrupt();
+    }
+
+    void PreprocessStage::run() {
+        serviceReady();
+
+        const uint32_t TIMEOUT = 100;
+        while (isRunning()) {
+            PipelineFrame *frame = m_input.take(TIMEOUT);
+
+            if (frame != NULL) {
+                frame->m_processed = m_preprocessor.preprocess(frame->m_raw, frame->m_image, frame->m_isRotated);
+                frame->m_preprocessed = TimeStamp();
+
+                // Any frame not yet taken by the measuring stage is stale now.
+                m_framePool.release(m_output.put(frame));
+            }
+        }
+    }
+
+} // msv
@@ -0,0 +1,122 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "Preprocessor.h"
+
+namespace msv {
+
+    using namespace std;
+
+    Preprocessor::Preprocessor() :
+        m_top(0),
+        m_bottom(1),
+        m_downscale(1),
+        m_remapRotation(false),
+        m_downscaled(NULL) {}
+
+    Preprocessor::Preprocessor(const double &top, const double &bottom, const uint32_t &downscale, const bool &remapRotation) :
+        m_top(top),
+        m_bottom(bottom),
+        m_downscale(downscale),
+        m_remapRotation(remapRotation),
+        m_downscaled(NULL) {
+        // Fall back to the entire image for invalid regions.
+        if ( (m_top < 0) || (m_bottom > 1) || !(m_top < m_bottom) ) {
+            m_top = 0;
+            m_bottom = 1;
+        }
+        if (m_downscale < 1) {
+            m_downscale = 1;
+        }
+    }
+
+    Preprocessor::~Preprocessor() {
+        if (m_downscaled != NULL) {
+            cvReleaseImage(&m_downscaled);
+        }
+    }
+
+    void Preprocessor::getRegionOfInterest(const int32_t &height, int32_t &firstRow, int32_t &numberOfRows) const {
+        firstRow = static_cast<int32_t>(m_top * height);
+        const int32_t lastRow = static_cast<int32_t>(m_bottom * height + 0.5);
+        numberOfRows = (lastRow > firstRow) ? (lastRow - firstRow) : 0;
+    }
+
+    IplImage* Preprocessor::preprocess(IplImage *raw, IplImage *image, bool &isRotated) {
+        isRotated = false;
+
+        if (raw->nChannels == 1) {
+            detectEdges(raw, image);
+            return image;
+        }
+
+        if (m_remapRotation) {
+            isRotated = true;
+            return raw;
+        }
+
+        // Mirror the image.
+        cvFlip(raw, (raw == image) ? NULL : image, -1);
+        return image;
+    }
+
+    void Preprocessor::detectEdges(IplImage *raw, IplImage *image) {
+        int32_t firstRow = 0;
+        int32_t numberOfRows = 0;
+        getRegionOfInterest(raw->height, firstRow, numberOfRows);
+        if (numberOfRows == 0) {
+            return;
+        }
+
+        const CvRect roi = cvRect(0, firstRow, raw->width, numberOfRows);
+        cvSetImageROI(raw, roi);
+        cvSetImageROI(image, roi);
+
+        const int32_t width = raw->width / m_downscale;
+        const int32_t height = numberOfRows / m_downscale;
+        if ( (m_downscale > 1) && (width > 0) && (height > 0) ) {
+            if ( (m_downscaled != NULL) && ( (m_downscaled->width != width) || (m_downscaled->height != height) ) ) {
+                cvReleaseImage(&m_downscaled);
+            }
+            if (m_downscaled == NULL) {
+                m_downscaled = cvCreateImage(cvSize(width, height), IPL_DEPTH_8U, 1);
+            }
+
+            // Keep the smoothing's extent w.r.t. the original image.
+            int32_t kernel = (11 / m_downscale) | 1;
+            kernel = (kernel < 3) ? 3 : kernel;
+
+            cvResize(raw, m_downscaled, CV_INTER_AREA);
+            cvSmooth(m_downscaled, m_downscaled, CV_GAUSSIAN, kernel, kernel);
+            cvCanny(m_downscaled, m_downscaled, 120, 60, 3);
+            cvDilate(m_downscaled, m_downscaled, NULL, 1);
+            cvResize(m_downscaled, raw, CV_INTER_NN);
+        }
+        else {
+            cvSmooth(raw, raw, CV_GAUSSIAN, 11, 11);
+            cvCanny(raw, raw, 120, 60, 3);
+            cvDilate(raw, raw, NULL, 1);
+        }
+        cvMerge(raw, raw, raw, NULL, image);
+
+        cvResetImageROI(raw);
+        cvResetImageROI(image);
+    }
+
+} // msv
@@ -0,0 +1,92 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cstring>
+
+#include "ScanLine.h"
+
+namespace msv {
+
+    using namespace std;
+
+    // Number of pixels checked at once; one block consists of numberOfChannels 32bit words.
+    static const int32_t BLOCK_SIZE = 4;
+
+    bool ScanLine::isWhite(const unsigned char *pixel, const int32_t &numberOfChannels) {
+        if (numberOfChannels < 3) {
+            return (pixel[0] == 255);
+        }
+        return ((pixel[0] & pixel[1] & pixel[2]) == 255);
+    }
+
+    bool ScanLine::hasWhiteByte(const unsigned char *block, const int32_t &numberOfChannels) {
+        uint32_t found = 0;
+        for (int32_t i = 0; i < numberOfChannels; i++) {
+            uint32_t word = 0;
+            // Rows are not necessarily aligned to words.
+            ::memcpy(&word, block + i * sizeof(uint32_t), sizeof(uint32_t));
+
+            // A byte is 255 if it becomes 0 after inverting the word; the
+            // expression sets the highest bit of every byte that is 0.
+            const uint32_t inverted = ~word;
+            found |= (inverted - 0x01010101u) & ~inverted & 0x80808080u;
+        }
+        return (found != 0);
+    }
+
+    int32_t ScanLine::findWhitePixelForward(const unsigned char *row, const int32_t &begin, const int32_t &end, const int32_t &numberOfChannels) {
+        int32_t i = begin;
+        while (i < end) {
+            if ( ((end - i) >= BLOCK_SIZE) && !hasWhiteByte(row + i * numberOfChannels, numberOfChannels) ) {
+                i += BLOCK_SIZE;
+                continue;
+            }
+
+            // Inspect the block or the remaining pixels one by one.
+            const int32_t last = ((end - i) >= BLOCK_SIZE) ? (i + BLOCK_SIZE) : end;
+            for (; i < last; i++) {
+                if (isWhite(row + i * numberOfChannels, numberOfChannels)) {
+                    return i;
+                }
+            }
+        }
+        return end;
+    }
+
+    int32_t ScanLine::findWhitePixelBackward(const unsigned char *row, const int32_t &begin, const int32_t &end, const int32_t &numberOfChannels) {
+        int32_t i = begin;
+        while (i > end) {
+            // The block consists of the pixels i - BLOCK_SIZE + 1 ... i.
+            if ( ((i - end) >= BLOCK_SIZE) && !hasWhiteByte(row + (i - BLOCK_SIZE + 1) * numberOfChannels, numberOfChannels) ) {
+                i -= BLOCK_SIZE;
+                continue;
+            }
+
+            // Inspect the block or the remaining pixels one by one.
+            const int32_t last = ((i - end) >= BLOCK_SIZE) ? (i - BLOCK_SIZE) : end;
+            for (; i > last; i--) {
+                if (isWhite(row + i * numberOfChannels, numberOfChannels)) {
+                    return i;
+                }
+            }
+        }
+        return end;
+    }
+
+} // msv
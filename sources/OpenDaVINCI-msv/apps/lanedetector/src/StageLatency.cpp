@@ -0,0 +1,78 @@
+/**
+ * lanedetector - Sample application for detecting lane markings.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <iomanip>
+
+#include "StageLatency.h"
+
+namespace msv {
+
+    using namespace std;
+    using namespace core::data;
+
+    StageLatency::StageLatency(const string &name) :
+        m_name(name),
+        m_numberOfFrames(0),
+        m_sumOfLatencies(0),
+        m_maximumLatency(0) {}
+
+    StageLatency::StageLatency(const StageLatency &obj) :
+        m_name(obj.m_name),
+        m_numberOfFrames(obj.m_numberOfFrames),
+        m_sumOfLatencies(obj.m_sumOfLatencies),
+        m_maximumLatency(obj.m_maximumLatency) {}
+
+    StageLatency& StageLatency::operator=(const StageLatency &obj) {
+        m_name = obj.m_name;
+        m_numberOfFrames = obj.m_numberOfFrames;
+        m_sumOfLatencies = obj.m_sumOfLatencies;
+        m_maximumLatency = obj.m_maximumLatency;
+
+        return *this;
+    }
+
+    StageLatency::~StageLatency() {}
+
+    void StageLatency::add(const TimeStamp &begin, const TimeStamp &end) {
+        const long latency = (end - begin).toMicroseconds();
+
+        m_numberOfFrames++;
+        m_sumOfLatencies += latency;
+        m_maximumLatency = (latency > m_maximumLatency) ? latency : m_maximumLatency;
+    }
+
+    uint32_t StageLatency::getNumberOfFrames() const {
+        return m_numberOfFrames;
+    }
+
+    double StageLatency::getMeanLatency() const {
+        return (m_numberOfFrames > 0) ? (m_sumOfLatencies / m_numberOfFrames) : 0;
+    }
+
+    long StageLatency::getMaximumLatency() const {
+        return m_maximumLatency;
+    }
+
+    void StageLatency::write(ostream &out) const {
+        out << m_name << ": mean " << fixed << setprecision(3) << (getMeanLatency() / 1000.0)
+            << "ms, max " << (m_maximumLatency / 1000.0) << "ms (" << m_numberOfFrames << " frames)." << endl;
+        out.unsetf(ios::floatfield);
+    }
+
+} // msv
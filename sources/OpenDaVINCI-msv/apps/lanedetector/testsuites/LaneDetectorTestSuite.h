@@ -30,7 +30,11 @@
 
 // Include local header files.
 #include "../include/LaneDetector.h"
+#include "../include/LatestFrameSlot.h"
 #include "../include/Lines.h"
+#include "../include/PipelineFrame.h"
+#include "../include/Preprocessor.h"
+#include "../include/ScanLine.h"
 
 using namespace std;
 using namespace core::data;
@@ -148,6 +152,96 @@ class LaneDetectorTest : public CxxTest::TestSuite {
             TS_ASSERT(ldt->callReadSharedImage(c) == false);
         }
 
+        void testLatestFrameSlotReplacesStaleFrame() {
+            FramePool pool;
+            LatestFrameSlot slot;
+
+            PipelineFrame *first = pool.acquire();
+            PipelineFrame *second = pool.acquire();
+            TS_ASSERT(first != second);
+
+            TS_ASSERT(slot.put(first) == NULL);
+            // The first frame was not taken and is returned for recycling.
+            TS_ASSERT(slot.put(second) == first);
+            TS_ASSERT(slot.getNumberOfDroppedFrames() == 1);
+            pool.release(first);
+
+            TS_ASSERT(slot.take(0) == second);
+            TS_ASSERT(slot.take(0) == NULL);
+            TS_ASSERT(slot.take(10) == NULL);
+            pool.release(second);
+
+            // Recycled frames are reused.
+            pool.acquire();
+            pool.acquire();
+            TS_ASSERT(pool.getNumberOfFrames() == 2);
+        }
+
+        void testScanLineFindsFirstWhitePixel() {
+            const int32_t WIDTH = 37;
+            const int32_t CHANNELS = 3;
+            unsigned char row[WIDTH * CHANNELS];
+            for (int32_t i = 0; i < WIDTH * CHANNELS; i++) {
+                row[i] = 0;
+            }
+
+            TS_ASSERT(ScanLine::findWhitePixelForward(row, 18, 36, CHANNELS) == 36);
+            TS_ASSERT(ScanLine::findWhitePixelBackward(row, 18, 1, CHANNELS) == 1);
+
+            // Partially white pixels do not count.
+            row[5 * CHANNELS] = 255;
+            row[5 * CHANNELS + 1] = 255;
+            row[30 * CHANNELS + 2] = 255;
+            TS_ASSERT(ScanLine::findWhitePixelForward(row, 18, 36, CHANNELS) == 36);
+            TS_ASSERT(ScanLine::findWhitePixelBackward(row, 18, 1, CHANNELS) == 1);
+
+            row[5 * CHANNELS + 2] = 255;
+            row[30 * CHANNELS] = 255;
+            row[30 * CHANNELS + 1] = 255;
+            row[33 * CHANNELS] = row[33 * CHANNELS + 1] = row[33 * CHANNELS + 2] = 255;
+            TS_ASSERT(ScanLine::findWhitePixelForward(row, 18, 36, CHANNELS) == 30);
+            TS_ASSERT(ScanLine::findWhitePixelBackward(row, 18, 1, CHANNELS) == 5);
+
+            // The pixel at end is not checked.
+            TS_ASSERT(ScanLine::findWhitePixelForward(row, 18, 30, CHANNELS) == 30);
+            TS_ASSERT(ScanLine::findWhitePixelForward(row, 31, 36, CHANNELS) == 33);
+            TS_ASSERT(ScanLine::findWhitePixelBackward(row, 4, 1, CHANNELS) == 1);
+        }
+
+        void testPreprocessorRegionOfInterest() {
+            int32_t firstRow = 0;
+            int32_t numberOfRows = 0;
+
+            Preprocessor entireImage;
+            entireImage.getRegionOfInterest(480, firstRow, numberOfRows);
+            TS_ASSERT(firstRow == 0);
+            TS_ASSERT(numberOfRows == 480);
+
+            Preprocessor lowerHalf(0.5, 1, 2, true);
+            lowerHalf.getRegionOfInterest(480, firstRow, numberOfRows);
+            TS_ASSERT(firstRow == 240);
+            TS_ASSERT(numberOfRows == 240);
+
+            // Invalid regions fall back to the entire image.
+            Preprocessor invalid(0.7, 0.3, 1, false);
+            invalid.getRegionOfInterest(480, firstRow, numberOfRows);
+            TS_ASSERT(firstRow == 0);
+            TS_ASSERT(numberOfRows == 480);
+        }
+
+        void testPipelineFrameReallocatesOnChangedDimensions() {
+            PipelineFrame frame;
+            frame.allocate(4, 3, 1);
+            TS_ASSERT(frame.m_raw != NULL);
+            TS_ASSERT(frame.m_raw->nChannels == 1);
+            TS_ASSERT(frame.m_image->nChannels == 3);
+
+            frame.allocate(6, 5, 3);
+            TS_ASSERT(frame.m_raw->width == 6);
+            TS_ASSERT(frame.m_raw->height == 5);
+            TS_ASSERT(frame.m_image->nChannels == 3);
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////
         // Below this line the necessary constructor for initializing the pointer variables,
         // and the forbidden copy constructor and assignment operator are declared.
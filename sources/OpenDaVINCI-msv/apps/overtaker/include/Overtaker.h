@@ -21,6 +21,10 @@
 #define OVERTAKER_H_
 
 #include "core/base/ConferenceClientModule.h"
+#include "core/base/FIFOQueue.h"
+#include "core/base/RateLimitedLogger.h"
+#include "core/data/Container.h"
+#include "core/data/control/VehicleControl.h"
 
 namespace msv {
 
@@ -28,6 +32,8 @@ namespace msv {
 
     /**
      * This class is a skeleton to send driving commands to Hesperia-light's vehicle driving dynamics simulation.
+     * The overtaking state machine is stepped once for every new measurement
+     * from the sensor board; in between, the module sleeps.
      */
     class Overtaker : public core::base::ConferenceClientModule {
         private:
@@ -51,6 +57,13 @@ namespace msv {
             Overtaker& operator=(const Overtaker &/*obj*/);
 
         public:
+            enum {
+                /* Maximum time in milliseconds to wait for a new measurement before checking the module's state again. */
+                MEASUREMENT_TIMEOUT = 100,
+                /* Minimum time in milliseconds between two status messages. */
+                LOG_INTERVAL = 1000
+            };
+
             /**
              * Constructor.
              *
@@ -68,6 +81,15 @@ namespace msv {
             virtual void setUp();
 
             virtual void tearDown();
+
+            /**
+             * This method steps the state machine for one measurement
+             * using the most recent vehicle and steering data.
+             *
+             * @param containerSensorBoardData New measurement from the sensor board.
+             * @return Vehicle control to be sent.
+             */
+            core::data::control::VehicleControl step(core::data::Container &containerSensorBoardData);
             
             static const int m_followLane = 1;
             static const int m_turnOut = 2;
@@ -75,11 +97,16 @@ namespace msv {
             static const int m_turnBack = 4;
             static const int m_returnNormal = 5;
 
+            core::base::FIFOQueue m_sensorBoardData;
+            core::base::RateLimitedLogger m_logger;
             int m_counter;
             double m_steering;
             int m_sensor;
             double m_carLength;
             double m_speed;
+            int m_state;
+            double m_initialHeading;
+            double m_initialAbsPath;
 
     };
 
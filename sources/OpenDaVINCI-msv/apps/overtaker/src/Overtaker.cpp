@@ -20,9 +20,12 @@
 #include <stdio.h>
 #include <math.h>
 
+#include <sstream>
+
 #include "core/io/ContainerConference.h"
 #include "core/data/Container.h"
 #include "core/data/Constants.h"
+#include "core/data/TimeStamp.h"
 #include "core/data/control/VehicleControl.h"
 #include "core/data/environment/VehicleData.h"
 #include "core/base/KeyValueConfiguration.h"
@@ -41,10 +44,16 @@
 
     Overtaker::Overtaker(const int32_t &argc, char **argv) :
     ConferenceClientModule(argc, argv, "Overtaker"),
+    m_sensorBoardData(),
+    m_logger(cout, LOG_INTERVAL),
     m_counter(0),
     m_steering(25),
     m_sensor(0),
-    m_speed(1.5)
+    m_carLength(0),
+    m_speed(1.5),
+    m_state(m_followLane),
+    m_initialHeading(0),
+    m_initialAbsPath(0)
     {}
 
     Overtaker::~Overtaker() {}
@@ -67,7 +76,9 @@
     // Send container.
         getConference().send(c);
 
-
+        stringstream s;
+        s << "Overtaker stopped, " << m_logger.getNumberOfSuppressedMessages() << " status messages suppressed.";
+        m_logger.logEvent(s.str());
     }
 
     // This method will do the main data processing job.
@@ -77,134 +88,148 @@
 
         KeyValueConfiguration kv = getKeyValueConfiguration();
         m_carLength = kv.getValue<double> ("global.carLength");
-        int m_state = m_followLane;
-        double m_initialHeading;
-        double m_currentHeading;
-        double m_initialAbsPath;
-        double m_currentAbsPath;
 
-        //int m_currentSteering;
+        // Every new measurement from the sensor board is queued so that the state machine
+        // is stepped exactly once per measurement regardless of the module's frequency.
+        addDataStoreFor(Container::USER_DATA_0, m_sensorBoardData);
+
+        // Under the supercomponent's control, getModuleState() synchronizes this module with
+        // the pulses. Otherwise, it would sleep for the rest of each time slice; instead, we sleep
+        // until the next measurement arrives and use the timeout to check the module's state.
+        const bool isManaged = (getServerInformation().getManagedLevel() != core::dmcp::ServerInformation::ML_NONE);
+        while ((isManaged ? getModuleState() : getModuleStateWithoutWaiting()) == ModuleState::RUNNING) {
+            if (!isManaged && !m_sensorBoardData.waitForData(MEASUREMENT_TIMEOUT)) {
+                continue;
+            }
 
-        while (getModuleState() == ModuleState::RUNNING) {
+            while (!m_sensorBoardData.isEmpty()) {
+                Container containerSensorBoardData = m_sensorBoardData.leave();
+                VehicleControl vc = step(containerSensorBoardData);
 
-        // Setting up different containers and getting data from them.
-            Container containerSensorBoardData = getKeyValueDataStore().get(Container::USER_DATA_0);
-            SensorBoardData sbd = containerSensorBoardData.getData<SensorBoardData> ();
-            Container containerSteeringData = getKeyValueDataStore().get(Container::USER_DATA_1);
-            SteeringData sd = containerSteeringData.getData<SteeringData> ();
-            Container containerVehicleData = getKeyValueDataStore().get(Container::VEHICLEDATA);
-            VehicleData vd = containerVehicleData.getData<VehicleData> ();
+                // Create container for finally sending the data.
+                Container c(Container::VEHICLECONTROL, vc);
+                // Send container.
+                getConference().send(c);
+            }
+        }
 
-            VehicleControl vc;
 
-            m_currentHeading = vd.getHeading();
-            m_currentAbsPath = vd.getAbsTraveledPath();
 
-            
+        return ModuleState::OKAY;
+    }
 
-            vc.setSpeed(m_speed);
+    VehicleControl Overtaker::step(Container &containerSensorBoardData) {
+        // Setting up different containers and getting data from them.
+        SensorBoardData sbd = containerSensorBoardData.getData<SensorBoardData> ();
+        Container containerSteeringData = getKeyValueDataStore().get(Container::USER_DATA_1);
+        SteeringData sd = containerSteeringData.getData<SteeringData> ();
+        Container containerVehicleData = getKeyValueDataStore().get(Container::VEHICLEDATA);
+        VehicleData vd = containerVehicleData.getData<VehicleData> ();
 
-        // if ultrasonic front exist.
-            if(sbd.containsKey_MapOfDistances(3))
-            {
+        VehicleControl vc;
 
-                switch(m_state)
-                {
-                    case m_followLane : 
-                        // && (m_currentSteering > -3 || m_currentSteering < 3)
-                        if(sbd.getValueForKey_MapOfDistances(3) < (m_carLength * 1.75) && sbd.getValueForKey_MapOfDistances(3) > 0)
-                        {   
-                            cerr << "------Turnout because :" << endl;
-                            cout << "Value from Ultrasonic Front ("<<(m_carLength * 1.75)<< ") and (greater than 0): " << sbd.getValueForKey_MapOfDistances(3) << endl;
-                            m_initialHeading = m_currentHeading;
-                            cout << "initial heading = " << m_initialHeading * Constants::RAD2DEG << endl;
-                            cout << "m_currentHeading = " << m_currentHeading * Constants::RAD2DEG << endl;
-                            vc.setSpeed(0);
-                            m_state = m_turnOut;
-                        }
-                        vc.setSteeringWheelAngle(sd.getHeadingData());
-                        //m_currentSteering = (sd.getHeadingData() * Constants::RAD2DEG);
-                        break;
-                    case m_turnOut :
-        // Turn out to left lane until InfraRed sensor detects the object, Keep incrementing counter to know how much to turn back later.
-                        
-                        if(sbd.getValueForKey_MapOfDistances(m_sensor) > 0 || angleDifference(m_initialHeading, m_currentHeading) > 8)
-                        {   
-                            cerr << "-----Straighten in left lane because :" << endl;
-                            cout << "Value from Front InfraRed (greater than 0)" << sbd.getValueForKey_MapOfDistances(0) << endl;
-                            cerr << "ANGLE DIFFERENCE (greater than 8):   " << angleDifference(m_initialHeading, m_currentHeading) << endl;
-                            m_initialHeading = m_currentHeading;
-                            m_initialAbsPath = m_currentAbsPath;
-                            m_state = m_straighten;
-                            break;
-                        }
-                        //++m_counter;
-                        vc.setSteeringWheelAngle(-(m_steering + 1) * Constants::DEG2RAD);
-                        break;
+        const double currentHeading = vd.getHeading();
+        const double currentAbsPath = vd.getAbsTraveledPath();
 
-                    case m_straighten : 
-        // Turn car fully until Infrared front detects the object is close enough, This is done to align car to the object.
-                        m_steering = 25;
-                        if((sbd.getValueForKey_MapOfDistances(0) < (m_carLength * 0.5) && sbd.getValueForKey_MapOfDistances(0) > 0) || angleDifference(m_initialHeading, m_currentHeading) < -15)
-                        {
-                            cerr << "-------left lane, lane following Because: " << endl;
-                            cout << "Value from Front InfraRed" << sbd.getValueForKey_MapOfDistances(0) << endl;
-                            cerr << "ANGLE DIFFERENCE less than -15: " << angleDifference(m_initialHeading, m_currentHeading) << endl;
-                            m_initialHeading = m_currentHeading;
-                            m_state = m_turnBack;
-                        }
-                        else 
-                        {                              
-                            vc.setSteeringWheelAngle(m_steering * Constants::DEG2RAD);
-                        }
+        vc.setSpeed(m_speed);
+
+        // if ultrasonic front exist.
+        if(sbd.containsKey_MapOfDistances(3))
+        {
+            stringstream s;
+
+            switch(m_state)
+            {
+                case m_followLane : 
+                    // && (m_currentSteering > -3 || m_currentSteering < 3)
+                    if(sbd.getValueForKey_MapOfDistances(3) < (m_carLength * 1.75) && sbd.getValueForKey_MapOfDistances(3) > 0)
+                    {   
+                        s << "Turnout because value from Ultrasonic Front (" << (m_carLength * 1.75) << ") and (greater than 0): " << sbd.getValueForKey_MapOfDistances(3)
+                          << ", initial heading = " << currentHeading * Constants::RAD2DEG;
+                        m_logger.logEvent(s.str());
+                        m_initialHeading = currentHeading;
+                        vc.setSpeed(0);
+                        m_state = m_turnOut;
+                    }
+                    vc.setSteeringWheelAngle(sd.getHeadingData());
+                    break;
+                case m_turnOut :
+    // Turn out to left lane until InfraRed sensor detects the object, Keep incrementing counter to know how much to turn back later.
+                    
+                    if(sbd.getValueForKey_MapOfDistances(m_sensor) > 0 || angleDifference(m_initialHeading, currentHeading) > 8)
+                    {   
+                        s << "Straighten in left lane because value from Front InfraRed (greater than 0): " << sbd.getValueForKey_MapOfDistances(0)
+                          << ", angle difference (greater than 8): " << angleDifference(m_initialHeading, currentHeading);
+                        m_logger.logEvent(s.str());
+                        m_initialHeading = currentHeading;
+                        m_initialAbsPath = currentAbsPath;
+                        m_state = m_straighten;
                         break;
-                    case m_turnBack :
-                        // If Front InfraRed and Front Right Ultrasonic is not detecting an object turn back half of counter. Go back to lanefollowing.
+                    }
+                    //++m_counter;
+                    vc.setSteeringWheelAngle(-(m_steering + 1) * Constants::DEG2RAD);
+                    break;
+
+                case m_straighten : 
+    // Turn car fully until Infrared front detects the object is close enough, This is done to align car to the object.
+                    m_steering = 25;
+                    if((sbd.getValueForKey_MapOfDistances(0) < (m_carLength * 0.5) && sbd.getValueForKey_MapOfDistances(0) > 0) || angleDifference(m_initialHeading, currentHeading) < -15)
+                    {
+                        s << "Left lane, lane following because value from Front InfraRed: " << sbd.getValueForKey_MapOfDistances(0)
+                          << ", angle difference (less than -15): " << angleDifference(m_initialHeading, currentHeading);
+                        m_logger.logEvent(s.str());
+                        m_initialHeading = currentHeading;
+                        m_state = m_turnBack;
+                    }
+                    else 
+                    {                              
+                        vc.setSteeringWheelAngle(m_steering * Constants::DEG2RAD);
+                    }
+                    break;
+                case m_turnBack :
+                    // If Front InfraRed and Front Right Ultrasonic is not detecting an object turn back half of counter. Go back to lanefollowing.
+                    
+                    if((currentAbsPath - m_initialAbsPath) > 0.3 && sbd.getValueForKey_MapOfDistances(0) < 0 &&
+                        (sbd.getValueForKey_MapOfDistances(4) > (1.25 * m_carLength) || sbd.getValueForKey_MapOfDistances(4) < 0))
+                    {
+                        s << "Return to right lane (swing right) because distance travelled: " << (currentAbsPath - m_initialAbsPath)
+                          << ", value from Ultrasonic Front Right: " << sbd.getValueForKey_MapOfDistances(4)
+                          << ", value from Front InfraRed: " << sbd.getValueForKey_MapOfDistances(0)
+                          << ", initial heading = " << currentHeading * Constants::RAD2DEG;
+                        m_logger.logEvent(s.str());
+                        m_initialHeading = currentHeading;
+                        m_state = m_returnNormal;
+
+                    }else{
+                        vc.setSteeringWheelAngle(sd.getHeadingData());
                         
-                        if((m_currentAbsPath - m_initialAbsPath) > 0.3 && sbd.getValueForKey_MapOfDistances(0) < 0 &&
-                            (sbd.getValueForKey_MapOfDistances(4) > (1.25 * m_carLength) || sbd.getValueForKey_MapOfDistances(4) < 0))
-                        {
-                            cerr << "-----return to right lane (swing right) because:" << endl;
-                            cout << "Distance travelled: " << (m_currentAbsPath - m_initialAbsPath) << endl;
-                            cout << "Value from Ultrasonic Front Right" << sbd.getValueForKey_MapOfDistances(3) << endl;
-                            cout << "Value from Front InfraRed" << sbd.getValueForKey_MapOfDistances(0) << endl;
-                            m_initialHeading = m_currentHeading;
-                            cout << "initial heading = " << m_initialHeading * Constants::RAD2DEG << endl;
-                            cout << "m_currentHeading = " << m_currentHeading * Constants::RAD2DEG << endl;
-                            m_state = m_returnNormal;
-
-                        }else{
-                            vc.setSteeringWheelAngle(sd.getHeadingData());
-                            
-                        }
-                        break;
-                    case m_returnNormal :
-
-                        m_steering = 25;
-                        if(angleDifference(m_initialHeading, m_currentHeading) > -35)
-                        {
-                            vc.setSteeringWheelAngle(m_steering * Constants::DEG2RAD);
-                        }
-                        else 
-                        {   
-                            cerr << "-----Follow lane because:" << endl;
-                            //cerr << "Value from Ultrasonic Front Right: " <<sbd.getValueForKey_MapOfDistances(4) << endl;
-                            //cerr << "IR front right less thsan 0" << sbd.getValueForKey_MapOfDistances(0) << endl;
-                            cerr << "ANGLE DIFFERENCE less than -35: " << angleDifference(m_initialHeading, m_currentHeading) << endl;
-                            m_state = m_followLane;   
-                        }
-                        break;
-                }
+                    }
+                    break;
+                case m_returnNormal :
+
+                    m_steering = 25;
+                    if(angleDifference(m_initialHeading, currentHeading) > -35)
+                    {
+                        vc.setSteeringWheelAngle(m_steering * Constants::DEG2RAD);
+                    }
+                    else 
+                    {   
+                        s << "Follow lane because angle difference (less than -35): " << angleDifference(m_initialHeading, currentHeading);
+                        m_logger.logEvent(s.str());
+                        m_state = m_followLane;   
+                    }
+                    break;
             }
-            // Create container for finally sending the data.
-            Container c(Container::VEHICLECONTROL, vc);
-            // Send container.
-            getConference().send(c);
         }
 
+        // The current status is reported at most once per LOG_INTERVAL.
+        {
+            stringstream s;
+            s << "State " << m_state << ", heading: " << currentHeading * Constants::RAD2DEG << ", angle difference: " << angleDifference(m_initialHeading, currentHeading);
+            m_logger.log(TimeStamp(), s.str());
+        }
 
-
-        return ModuleState::OKAY;
+        return vc;
     }
 
     double Overtaker::angleDifference(double initialHeading, double heading){
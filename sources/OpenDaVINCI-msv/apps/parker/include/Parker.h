@@ -20,7 +20,15 @@
 #ifndef PARKER_H_
 #define PARKER_H_
 
+#include <string>
+
 #include "core/base/ConferenceClientModule.h"
+#include "core/base/FIFOQueue.h"
+#include "core/base/RateLimitedLogger.h"
+#include "core/data/Container.h"
+#include "core/data/control/VehicleControl.h"
+
+#include "ParkerConfiguration.h"
 
 namespace msv {
 
@@ -28,6 +36,8 @@ namespace msv {
 
     /**
      * This class is a skeleton to send driving commands to Hesperia-light's vehicle driving dynamics simulation.
+     * The parking state machine is stepped once for every new measurement
+     * from the sensor board; in between, the module sleeps.
      */
     class Parker : public core::base::ConferenceClientModule {
         private:
@@ -51,6 +61,13 @@ namespace msv {
             Parker& operator=(const Parker &/*obj*/);
 
         public:
+            enum {
+                /* Maximum time in milliseconds to wait for a new measurement before checking the module's state again. */
+                MEASUREMENT_TIMEOUT = 100,
+                /* Minimum time in milliseconds between two status messages. */
+                LOG_INTERVAL = 1000
+            };
+
             /**
              * Constructor.
              *
@@ -68,7 +85,27 @@ namespace msv {
 
             virtual void tearDown();
 
+            /**
+             * This method steps the state machine for one measurement
+             * using the most recent vehicle and steering data.
+             *
+             * @param containerSensorBoardData New measurement from the sensor board.
+             * @param configuration Parker's configuration.
+             * @return Vehicle control to be sent.
+             */
+            core::data::control::VehicleControl step(core::data::Container &containerSensorBoardData, const ParkerConfiguration &configuration);
+
+            const string getModeName(const int &mode) const;
+
             double angleDifference(double initialHeading, double heading);
+
+        private:
+            core::base::FIFOQueue m_sensorBoardData;
+            core::base::RateLimitedLogger m_logger;
+            int m_mode;
+            int m_counter;
+            double m_currentTraveledPath; // Marker for a certain position
+            double m_initialHeading; // Heading when parking was initiated
     };
 
 } // msv
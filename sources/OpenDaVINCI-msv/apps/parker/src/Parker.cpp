@@ -20,9 +20,12 @@
 #include <stdio.h>
 #include <math.h>
 
+#include <sstream>
+
 #include "core/io/ContainerConference.h"
 #include "core/data/Container.h"
 #include "core/data/Constants.h"
+#include "core/data/TimeStamp.h"
 #include "core/data/control/VehicleControl.h"
 #include "core/data/environment/VehicleData.h"
 #include "core/base/KeyValueConfiguration.h"
@@ -54,7 +57,13 @@ namespace msv {
 
 
         Parker::Parker(const int32_t &argc, char **argv) :
-	        ConferenceClientModule(argc, argv, "Parker") {
+	        ConferenceClientModule(argc, argv, "Parker"),
+                m_sensorBoardData(),
+                m_logger(cout, LOG_INTERVAL),
+                m_mode(SCANNING),
+                m_counter(0),
+                m_currentTraveledPath(0),
+                m_initialHeading(0) {
         }
 
         Parker::~Parker() {}
@@ -65,138 +74,137 @@ namespace msv {
 
         void Parker::tearDown() {
 	        // This method will be call automatically _after_ return from body().
+                stringstream s;
+                s << "Parker stopped in mode " << getModeName(m_mode) << ", " << m_logger.getNumberOfSuppressedMessages() << " status messages suppressed.";
+                m_logger.logEvent(s.str());
         }
 
         // This method will do the main data processing job.
         ModuleState::MODULE_EXITCODE Parker::body() {
 
-                int mode = SCANNING;
-                int counter = 0;
-                double currentTraveledPath; // Marker for a certain position
-                double initialHeading; // Heading when parking was initiated
+                const ParkerConfiguration configuration(getKeyValueConfiguration());
 
-                KeyValueConfiguration kv = getKeyValueConfiguration();
-                double carLength = kv.getValue<double> ("global.carLength");
-                
+                // Every new measurement from the sensor board is queued so that the state machine
+                // is stepped exactly once per measurement regardless of the module's frequency.
+                addDataStoreFor(Container::USER_DATA_0, m_sensorBoardData);
 
-	        while (getModuleState() == ModuleState::RUNNING) {
-                // In the following, you find example for the various data sources that are available:
+                // Under the supercomponent's control, getModuleState() synchronizes this module with
+                // the pulses. Otherwise, it would sleep for the rest of each time slice; instead, we sleep
+                // until the next measurement arrives and use the timeout to check the module's state.
+                const bool isManaged = (getServerInformation().getManagedLevel() != core::dmcp::ServerInformation::ML_NONE);
+	        while ((isManaged ? getModuleState() : getModuleStateWithoutWaiting()) == ModuleState::RUNNING) {
+                        if (!isManaged && !m_sensorBoardData.waitForData(MEASUREMENT_TIMEOUT)) {
+                                continue;
+                        }
 
-                // 1. Get most recent vehicle data:
-                Container containerVehicleData = getKeyValueDataStore().get(Container::VEHICLEDATA);
-                VehicleData vd = containerVehicleData.getData<VehicleData> ();
-                cerr << "Most recent vehicle data: '" << vd.toString() << "'" << endl;
+                        while (!m_sensorBoardData.isEmpty()) {
+                                Container containerSensorBoardData = m_sensorBoardData.leave();
+                                VehicleControl vc = step(containerSensorBoardData, configuration);
+
+                                // Create container for finally sending the data.
+                                Container c(Container::VEHICLECONTROL, vc);
+                                // Send container.
+                                getConference().send(c);
+                        }
+	        }
+
+	        return ModuleState::OKAY;
+        }
 
-                // 2. Get most recent sensor board data:
-                Container containerSensorBoardData = getKeyValueDataStore().get(Container::USER_DATA_0);
+        VehicleControl Parker::step(Container &containerSensorBoardData, const ParkerConfiguration &configuration) {
+                // 1. Sensor board data that triggered this step:
                 SensorBoardData sbd = containerSensorBoardData.getData<SensorBoardData> ();
-                cerr << "Most recent sensor board data: '" << sbd.toString() << "'" << endl;
 
-                // 3. Get most recent user button data:
-                Container containerUserButtonData = getKeyValueDataStore().get(Container::USER_BUTTON);
-                UserButtonData ubd = containerUserButtonData.getData<UserButtonData> ();
-                cerr << "Most recent user button data: '" << ubd.toString() << "'" << endl;
+                // 2. Get most recent vehicle data:
+                Container containerVehicleData = getKeyValueDataStore().get(Container::VEHICLEDATA);
+                VehicleData vd = containerVehicleData.getData<VehicleData> ();
 
-                // 4. Get most recent steering data as fill from lanedetector for example:
+                // 3. Get most recent steering data as fill from lanedetector for example:
                 Container containerSteeringData = getKeyValueDataStore().get(Container::USER_DATA_1);
                 SteeringData sd = containerSteeringData.getData<SteeringData> ();
-                cerr << "Most recent steering data: '" << sd.toString() << "'" << endl;
-
 
-                // Design your control algorithm here depending on the input data from above.
+                const int previousMode = m_mode;
 
                 // Create vehicle control data.
                 VehicleControl vc;
                 
-                switch (mode) {
+                switch (m_mode) {
 
                         case SCANNING:
-                        cout << "Forward - Mode SCANNING" << endl;
                         vc.setSpeed(1);
                         //vc.setSteeringWheelAngle(sd.getHeadingData());
                         vc.setSteeringWheelAngle(0);
                         
                         // If IR sensor and US sensor is far enough change to measuring mode
-                        if(sbd.getValueForKey_MapOfDistances(0) < 0 && (sbd.getValueForKey_MapOfDistances(4) < 0 || sbd.getValueForKey_MapOfDistances(4) > carLength * 1.1)){
-                                mode = MEASURING;
-                                currentTraveledPath = vd.getAbsTraveledPath();
+                        if(sbd.getValueForKey_MapOfDistances(0) < 0 && (sbd.getValueForKey_MapOfDistances(4) < 0 || sbd.getValueForKey_MapOfDistances(4) > configuration.carLength * 1.1)){
+                                m_mode = MEASURING;
+                                m_currentTraveledPath = vd.getAbsTraveledPath();
                         }
                         break;
 
                         case MEASURING:
-                        cout << "Forward - Mode MEASURING" << endl;
-                        cout << "Measured distance: " << vd.getAbsTraveledPath() - currentTraveledPath << endl;
                         vc.setSpeed(1);
                         vc.setSteeringWheelAngle(0);
                         //vc.setSteeringWheelAngle(sd.getHeadingData());
                         
                         // If something is detected during measuring, go back to SCANNING mode
-                        if((sbd.getValueForKey_MapOfDistances(0) > -1 && vd.getAbsTraveledPath() - currentTraveledPath < carLength * 1.2) || (sd.getHeadingData() > 10 || sd.getHeadingData() < -10)){
-                                mode = SCANNING;
+                        if((sbd.getValueForKey_MapOfDistances(0) > -1 && vd.getAbsTraveledPath() - m_currentTraveledPath < configuration.carLength * 1.2) || (sd.getHeadingData() > 10 || sd.getHeadingData() < -10)){
+                                m_mode = SCANNING;
                         }
                         // If gap is wide enough change mode to ALIGNING
-                        else if (vd.getAbsTraveledPath() - currentTraveledPath >= carLength * 1.2){
-                                mode = ALIGNING;
-                                currentTraveledPath = vd.getAbsTraveledPath();
+                        else if (vd.getAbsTraveledPath() - m_currentTraveledPath >= configuration.carLength * 1.2){
+                                m_mode = ALIGNING;
+                                m_currentTraveledPath = vd.getAbsTraveledPath();
                         }
                         break;
 
                         // Mode for aligning the car to park
                         case ALIGNING:
-                        cout << "Reverse - Mode ALIGNING" << endl;
-                        cout << "Measured distance: " << vd.getAbsTraveledPath() - currentTraveledPath << endl;
                         vc.setSpeed(1);
                         
                         // Car has traveled enough to stop and park
-                        if((vd.getAbsTraveledPath() - currentTraveledPath) > carLength * 1.0){
-                                counter = 0;
-                                mode = STOPPING;
-                                initialHeading = vd.getHeading();
+                        if((vd.getAbsTraveledPath() - m_currentTraveledPath) > configuration.carLength * 1.0){
+                                m_counter = 0;
+                                m_mode = STOPPING;
+                                m_initialHeading = vd.getHeading();
                         }
                         break;
 
 
                         // Mode for stopping car to reverse
                         case STOPPING:
-                        cout << "Reverse - Mode STOPPING" << endl;
-                        ++counter;
+                        ++m_counter;
                         vc.setSpeed(0);
 
-                        // Enough time has passed to reverse
-                        if(counter >= 30){
-                                mode = BACK_RIGHT;
-                                currentTraveledPath = vd.getAbsTraveledPath();
+                        // Enough measurements have passed to reverse
+                        if(m_counter >= 30){
+                                m_mode = BACK_RIGHT;
+                                m_currentTraveledPath = vd.getAbsTraveledPath();
                         }
 
                         break;
                         
                         // Mode to back and turn right
                         case BACK_RIGHT:
-                        cout << "Reverse - Mode BACK_RIGHT" << endl;
-                        cout << "Measured distance: " << vd.getAbsTraveledPath() - currentTraveledPath << endl;
-                        cout << "Initial heading(): " << initialHeading * Constants::RAD2DEG << " Heading: " << vd.getHeading() * Constants::RAD2DEG << endl;
-                        cout << "Angle diff: " << angleDifference(initialHeading, vd.getHeading()) << endl;
                         vc.setSpeed(-1);
                         vc.setSteeringWheelAngle(25 * Constants::DEG2RAD);
                         
                         // When heading has changed enough, change mode to BACK_STRAIGHT
-                        cout << "Rear: " << sbd.getValueForKey_MapOfDistances(1) << endl;
-                        cerr << "Stop backing: " << (sbd.getValueForKey_MapOfDistances(1) < (carLength * 0.5) && sbd.getValueForKey_MapOfDistances(1) > 0) << endl;
-                        if(sbd.getValueForKey_MapOfDistances(1) < (carLength * 0.5) && sbd.getValueForKey_MapOfDistances(1) > 0)
-                                mode = STRAIGHTEN;
-
-                        if (angleDifference(initialHeading, vd.getHeading()) > 22){
-                                if (carLength < 1)
-                                        mode = BACK_LEFT;
+                        if(sbd.getValueForKey_MapOfDistances(1) < (configuration.carLength * 0.5) && sbd.getValueForKey_MapOfDistances(1) > 0)
+                                m_mode = STRAIGHTEN;
+
+                        if (angleDifference(m_initialHeading, vd.getHeading()) > 22){
+                                if (configuration.carLength < 1)
+                                        m_mode = BACK_LEFT;
                                 else
-                                        mode = BACK_STRAIGHT;
-                                currentTraveledPath = vd.getAbsTraveledPath();
+                                        m_mode = BACK_STRAIGHT;
+                                m_currentTraveledPath = vd.getAbsTraveledPath();
                                 vc.setSteeringWheelAngle(0);
                         }
                         // ABORT if something is detected in the rear
-                        if(sbd.getValueForKey_MapOfDistances(1) < carLength * 0.10 && sbd.getValueForKey_MapOfDistances(1) > 0){
-                                mode = ABORT;
-                                currentTraveledPath = vd.getAbsTraveledPath();
+                        if(sbd.getValueForKey_MapOfDistances(1) < configuration.carLength * 0.10 && sbd.getValueForKey_MapOfDistances(1) > 0){
+                                m_mode = ABORT;
+                                m_currentTraveledPath = vd.getAbsTraveledPath();
                                 vc.setSpeed(0);
                         }
 
@@ -204,15 +212,13 @@ namespace msv {
 
                         // Mode to back straight
                         case BACK_STRAIGHT:
-                        cout << "Reverse - Mode: BACK_STRAIGHT" << endl;
-                        cout << "Measured distance: " << vd.getAbsTraveledPath() - currentTraveledPath << endl;
                         vc.setSpeed(-1);
                         vc.setSteeringWheelAngle(0);
 
                         // Change mode to BACK_LEFT when car traveled enough distance
-                        if((vd.getAbsTraveledPath() - currentTraveledPath) > carLength * 0.6){
-                                mode = BACK_LEFT;
-                                currentTraveledPath = vd.getAbsTraveledPath();
+                        if((vd.getAbsTraveledPath() - m_currentTraveledPath) > configuration.carLength * 0.6){
+                                m_mode = BACK_LEFT;
+                                m_currentTraveledPath = vd.getAbsTraveledPath();
                                 vc.setSteeringWheelAngle(-26 * Constants::DEG2RAD);
                         }
 
@@ -220,63 +226,78 @@ namespace msv {
 
                         // Mode to back and turn left
                         case BACK_LEFT:
-                        cout << "Reverse - Mode: BACK_LEFT" << endl;
-                        cout << "Initial heading(): " << initialHeading * Constants::RAD2DEG << " Heading: " << vd.getHeading() * Constants::RAD2DEG << endl;
-                        cout << "Angle diff: " << angleDifference(initialHeading, vd.getHeading()) << endl;
-                        cout << "Rear: " << sbd.getValueForKey_MapOfDistances(1) << endl;
-                        
                         vc.setSpeed(-1);
                         vc.setSteeringWheelAngle(-26 * Constants::DEG2RAD);
                         
                         // When car is almost parallel or IR rear detects object close enough, change mode to STRAIGHTEN
-                        cerr << "Stop backing: " << (sbd.getValueForKey_MapOfDistances(1) < (carLength * 0.8) && sbd.getValueForKey_MapOfDistances(1) > 0) << endl;
-                        if(angleDifference(initialHeading, vd.getHeading()) < 7 || (sbd.getValueForKey_MapOfDistances(1) > 0)){
+                        if(angleDifference(m_initialHeading, vd.getHeading()) < 7 || (sbd.getValueForKey_MapOfDistances(1) > 0)){
                                 vc.setSpeed(0);
-                                mode = STRAIGHTEN;
+                                m_mode = STRAIGHTEN;
                         }
                    
                         break;
 
                         // Mode to straighten the car
                         case STRAIGHTEN:
-                        cout << "Forward - Mode: STRAIGHTEN" << endl;
-                        cout << "Initial heading: " << initialHeading * Constants::RAD2DEG << " Heading: " << vd.getHeading() * Constants::RAD2DEG << endl;
-                        cout << "Angle diff: " << angleDifference(initialHeading, vd.getHeading()) << endl;
                         vc.setSteeringWheelAngle(25);
                         vc.setSpeed(1);
                         
                         // Change mode to STOP is the car is parallel to road
-                        if(angleDifference(initialHeading, vd.getHeading()) < 3){
+                        if(angleDifference(m_initialHeading, vd.getHeading()) < 3){
                                 vc.setSpeed(-1);
-                                mode = STOP;
+                                m_mode = STOP;
                         }
                         // Change mode back to BACK_LEFT if US front detects object close enough
-                        else if(sbd.getValueForKey_MapOfDistances(3) < (0.5 * carLength) && sbd.getValueForKey_MapOfDistances(3) > 0){
-                                mode = BACK_LEFT;
+                        else if(sbd.getValueForKey_MapOfDistances(3) < (0.5 * configuration.carLength) && sbd.getValueForKey_MapOfDistances(3) > 0){
+                                m_mode = BACK_LEFT;
                         }
 
                         break;
 
                         // Car is done
                         case STOP:
-                        cout << "Mode: STOP" << endl;
                         vc.setSpeed(0);
                         break;
 
                         // Mode to abort
                         case ABORT:
-                        cerr << "Mode: ABORT" << endl;
                         break;
 
                 }
 
-                // Create container for finally sending the data.
-                Container c(Container::VEHICLECONTROL, vc);
-                // Send container.
-                getConference().send(c);
-	        }
+                // Mode changes are always reported, the current status at most once per LOG_INTERVAL.
+                if (m_mode != previousMode) {
+                        stringstream s;
+                        s << "Mode " << getModeName(previousMode) << " -> " << getModeName(m_mode);
+                        m_logger.logEvent(s.str());
+                }
 
-	        return ModuleState::OKAY;
+                {
+                        stringstream s;
+                        s << "Mode " << getModeName(m_mode)
+                          << ", measured distance: " << vd.getAbsTraveledPath() - m_currentTraveledPath
+                          << ", angle diff: " << angleDifference(m_initialHeading, vd.getHeading())
+                          << ", rear: " << sbd.getValueForKey_MapOfDistances(1);
+                        m_logger.log(TimeStamp(), s.str());
+                }
+
+                return vc;
+        }
+
+        const string Parker::getModeName(const int &mode) const {
+                switch (mode) {
+                        case SCANNING: return "SCANNING";
+                        case MEASURING: return "MEASURING";
+                        case ALIGNING: return "ALIGNING";
+                        case BACK_RIGHT: return "BACK_RIGHT";
+                        case BACK_STRAIGHT: return "BACK_STRAIGHT";
+                        case BACK_LEFT: return "BACK_LEFT";
+                        case STRAIGHTEN: return "STRAIGHTEN";
+                        case STOPPING: return "STOPPING";
+                        case STOP: return "STOP";
+                        case ABORT: return "ABORT";
+                }
+                return "UNKNOWN";
         }
 
         /*
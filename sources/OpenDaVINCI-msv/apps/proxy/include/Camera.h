@@ -23,6 +23,7 @@
 #include <stdint.h>
 
 #include "core/SharedPointer.h"
+#include "core/base/SharedFrameRing.h"
 #include "core/data/image/SharedImage.h"
 #include "core/wrapper/SharedMemory.h"
 
@@ -33,7 +34,9 @@ namespace msv {
     using namespace std;
 
     /**
-     * This class wraps a camera and captures its data into a shared memory segment.
+     * This class wraps a camera and captures its data into a shared memory
+     * segment organized as frame ring so that the camera never waits for
+     * slow consumers.
      */
     class Camera {
         private:
@@ -75,6 +78,11 @@ namespace msv {
              */
             core::data::image::SharedImage capture();
 
+            /**
+             * @return Number of frames successfully captured into the shared memory.
+             */
+            uint32_t getNumberOfCapturedFrames() const;
+
         protected:
             /**
              * This method is responsible to copy the image from the
@@ -105,6 +113,7 @@ namespace msv {
         private:
             core::data::image::SharedImage m_sharedImage;
             core::SharedPointer<core::wrapper::SharedMemory> m_sharedMemory;
+            core::SharedPointer<core::base::SharedFrameRing> m_frameRing;
             
         protected:
             string m_name;
@@ -113,6 +122,7 @@ namespace msv {
             uint32_t m_height;
             uint32_t m_bpp;
             uint32_t m_size;
+            uint32_t m_numberOfCapturedFrames;
     };
 
 } // msv
@@ -0,0 +1,94 @@
+/**
+ * proxy - Sample application to encapsulate HW/SW interfacing with embedded systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef CAMERACAPTURE_H_
+#define CAMERACAPTURE_H_
+
+#include "core/base/Mutex.h"
+#include "core/base/Service.h"
+#include "core/data/image/SharedImage.h"
+
+#include "Camera.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class captures the camera's frames into its shared memory
+     * in an own thread. Thus, the camera runs at its own frame rate
+     * regardless of how long publishing, recording, and the serial
+     * communication take.
+     */
+    class CameraCapture : public core::base::Service {
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             *
+             * @param obj Reference to an object of this class.
+             */
+            CameraCapture(const CameraCapture &/*obj*/);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             *
+             * @param obj Reference to an object of this class.
+             * @return Reference to this instance.
+             */
+            CameraCapture& operator=(const CameraCapture &/*obj*/);
+
+        public:
+            /**
+             * Constructor.
+             *
+             * @param camera Camera to capture from.
+             */
+            CameraCapture(Camera &camera);
+
+            virtual ~CameraCapture();
+
+            /**
+             * This method returns the meta information of the most
+             * recently captured frame.
+             *
+             * @param sharedImage Meta information to be updated.
+             * @return Number of frames captured so far.
+             */
+            uint32_t getLatestFrame(core::data::image::SharedImage &sharedImage);
+
+        private:
+            virtual void beforeStop();
+
+            virtual void run();
+
+        private:
+            Camera &m_camera;
+
+            core::base::Mutex m_latestFrameMutex;
+            core::data::image::SharedImage m_latestFrame;
+            uint32_t m_numberOfFrames;
+    };
+
+} // msv
+
+#endif /*CAMERACAPTURE_H_*/
@@ -61,8 +61,10 @@ namespace msv {
              * @param width
              * @param height
              * @param bpp
+             * @param headless true if the captured frames shall not be shown.
+             * @param preprocessing true if edges shall be detected in color frames before sharing them.
              */
-            OpenCVCamera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp, const bool &headless);
+            OpenCVCamera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp, const bool &headless, const bool &preprocessing);
 
             virtual ~OpenCVCamera();
 
@@ -76,10 +78,12 @@ namespace msv {
         private:
             CvCapture *m_capture;
             IplImage *m_image;
+            IplImage *m_frame;
             IplImage *out;
             IplImage *merge_image;
             IplImage *gray_out;
             bool isheadless;
+            bool m_preprocessing;
     };
 
 } // msv
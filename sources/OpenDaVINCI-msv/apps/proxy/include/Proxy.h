@@ -23,12 +23,17 @@
 #include <map>
 
 #include "core/base/ConferenceClientModule.h"
+#include "core/base/Mutex.h"
 #include "core/data/Container.h"
 #include "tools/recorder/Recorder.h"
 #include "serial/serial.h"
 
 #include "Camera.h"
+#include "CameraCapture.h"
 #include "RunningMedian.h"
+#include "SerialFrameListener.h"
+#include "SerialFrameParser.h"
+#include "SerialIO.h"
 
 namespace msv {
 
@@ -37,7 +42,7 @@ namespace msv {
     /**
      * This class wraps the software/hardware interface board.
      */
-    class Proxy : public core::base::ConferenceClientModule {
+    class Proxy : public core::base::ConferenceClientModule, public SerialFrameListener {
         private:
             /**
              * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -71,27 +76,31 @@ namespace msv {
 
             core::base::ModuleState::MODULE_EXITCODE body();
 
+            virtual void nextFrame(const uint8_t *frame, const uint32_t &size);
+
         private:
             virtual void setUp();
 
             virtual void tearDown();
 
             void distribute(core::data::Container c);
-            int getSerial();
-            void distSerial();
+            void distSerial(const uint8_t *frame);
             void sendSerial();
 
         private:
             static const int INSERIAL = 17;
             static const int OUTSERIAL = 7;
+            static const uint32_t SERIAL_TIMEOUT = 5; // Maximum delay of a command in ms.
+            core::base::Mutex m_distributeMutex;
             tools::recorder::Recorder *m_recorder;
             Camera *m_camera;
+            CameraCapture *m_cameraCapture;
             serial::Serial *this_serial;
+            SerialIO *m_serialIO;
             uint8_t endByte;
             uint8_t startByte;
             uint8_t outSer[OUTSERIAL];
-            uint8_t incomingSer[INSERIAL];
-            uint8_t oldIncomingSer[OUTSERIAL];
+            SerialFrameParser m_serialFrameParser;
             uint16_t speedOut;
             uint16_t steeringOut;
             RunningMedian irFrontRightMedian;
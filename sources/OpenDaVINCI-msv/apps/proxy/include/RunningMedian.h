@@ -1,11 +1,14 @@
 /**
- * Running Median - a (not very portable) class to handle a buffered running median, storing values in a 77
+ * Running Median - a class to handle a buffered running median over a sliding window of samples.
  * 
  *
  */
 
 #include <stdint.h>
 
+#include <set>
+#include <vector>
+
 #ifndef RUNNING_MEDIAN_H_
 #define RUNNING_MEDIAN_H_
 
@@ -20,24 +23,35 @@
 
         public:
 	       	
-	       	//Constructor
+	       	//Constructor for the default window of 5 samples
 	        RunningMedian();
 
-	        /*---Add a value to the sliding window and sorted array---*/
+	        //Constructor for a window of windowSize samples (at least 1)
+	        RunningMedian(const uint32_t &windowSize);
+
+	        /*---Add a value to the sliding window replacing the oldest one, O(log n)---*/
 	        void addValue(uint16_t value);
 
-	        /*---"Insert" the new value into the sorted array using a kind of 
-	        	insertion sort then redurn the median---*/        
+	        /*---Return the median of the sliding window (the lower one for even
+	        	window sizes), O(1)---*/        
 			uint16_t getMedian();
 
         private:
-        	//set size of sample
-        	static const int BUFFSIZE = 5;
-   			uint16_t circBuffer[BUFFSIZE];
-			uint16_t sortedArray[BUFFSIZE];
+        	/*---Move values between both halves until the lower half
+        		holds (n+1)/2 values---*/
+        	void rebalance();
+
+        private:
+        	//default size of sample
+        	static const uint32_t BUFFSIZE = 5;
+   			vector<uint16_t> circBuffer;
+   			uint32_t oldest;
+   			//the smaller half of the window including the median and the greater half
+   			multiset<uint16_t> lowerHalf;
+   			multiset<uint16_t> upperHalf;
 
 
     };
 
 
-#endif /*RUNNING_MEDIAN_H_*/
\ No newline at end of file
+#endif /*RUNNING_MEDIAN_H_*/
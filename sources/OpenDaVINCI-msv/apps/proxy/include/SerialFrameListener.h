@@ -0,0 +1,46 @@
+/**
+ * proxy - Sample application to encapsulate HW/SW interfacing with embedded systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SERIALFRAMELISTENER_H_
+#define SERIALFRAMELISTENER_H_
+
+#include "core/platform.h"
+
+namespace msv {
+
+    /**
+     * This class provides an interface for getting informed
+     * about new frames received from the interface board.
+     */
+    class SerialFrameListener {
+        public:
+            virtual ~SerialFrameListener() {}
+
+            /**
+             * This method is called for every received valid frame.
+             *
+             * @param frame Received frame.
+             * @param size Size of the frame in bytes.
+             */
+            virtual void nextFrame(const uint8_t *frame, const uint32_t &size) = 0;
+    };
+
+} // msv
+
+#endif /*SERIALFRAMELISTENER_H_*/
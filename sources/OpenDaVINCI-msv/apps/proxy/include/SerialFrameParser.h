@@ -0,0 +1,133 @@
+/**
+ * proxy - Sample application to encapsulate HW/SW interfacing with embedded systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SERIALFRAMEPARSER_H_
+#define SERIALFRAMEPARSER_H_
+
+#include "core/platform.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class collects the bytes received from the interface board
+     * in a ring buffer and extracts complete frames from it. A frame
+     * starts with the start byte, has the end byte at its second last
+     * position, and ends with a checksum that makes the XOR over all
+     * bytes of the frame zero. Bytes that do not start a valid frame
+     * are discarded one at a time until the stream is in sync again.
+     */
+    class SerialFrameParser {
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             *
+             * @param obj Reference to an object of this class.
+             */
+            SerialFrameParser(const SerialFrameParser &/*obj*/);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             *
+             * @param obj Reference to an object of this class.
+             * @return Reference to this instance.
+             */
+            SerialFrameParser& operator=(const SerialFrameParser &/*obj*/);
+
+        public:
+            enum {
+                BUFFER_SIZE = 256 // Must be a power of two.
+            };
+
+            /**
+             * Constructor.
+             *
+             * @param frameSize Size of one frame in bytes including start byte, end byte, and checksum.
+             * @param startByte First byte of every frame.
+             * @param endByte Second last byte of every frame.
+             */
+            SerialFrameParser(const uint32_t &frameSize, const uint8_t &startByte, const uint8_t &endByte);
+
+            virtual ~SerialFrameParser();
+
+            /**
+             * This method appends received bytes. If the buffer is
+             * full, the oldest bytes are discarded.
+             *
+             * @param data Received bytes.
+             * @param length Number of received bytes.
+             */
+            void write(const uint8_t *data, const uint32_t &length);
+
+            /**
+             * This method extracts the next valid frame.
+             *
+             * @param frame Destination for getFrameSize() bytes.
+             * @return true if a valid frame was copied to frame.
+             */
+            bool read(uint8_t *frame);
+
+            /**
+             * @return Size of one frame in bytes.
+             */
+            uint32_t getFrameSize() const;
+
+            /**
+             * @return Number of buffered bytes.
+             */
+            uint32_t getNumberOfBufferedBytes() const;
+
+            /**
+             * @return Number of valid frames extracted so far.
+             */
+            uint32_t getNumberOfFrames() const;
+
+            /**
+             * @return Number of bytes discarded while resynchronizing or due to overflows.
+             */
+            uint32_t getNumberOfDiscardedBytes() const;
+
+        private:
+            /**
+             * @param offset Offset relative to the oldest buffered byte.
+             * @return Buffered byte.
+             */
+            uint8_t at(const uint32_t &offset) const;
+
+            void discard(const uint32_t &length);
+
+        private:
+            const uint32_t m_frameSize;
+            const uint8_t m_startByte;
+            const uint8_t m_endByte;
+            uint8_t m_buffer[BUFFER_SIZE];
+            uint32_t m_head;
+            uint32_t m_size;
+            uint32_t m_numberOfFrames;
+            uint32_t m_numberOfDiscardedBytes;
+    };
+
+} // msv
+
+#endif /*SERIALFRAMEPARSER_H_*/
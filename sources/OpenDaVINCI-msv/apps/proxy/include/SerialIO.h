@@ -0,0 +1,108 @@
+/**
+ * proxy - Sample application to encapsulate HW/SW interfacing with embedded systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SERIALIO_H_
+#define SERIALIO_H_
+
+#include "core/base/Mutex.h"
+#include "core/base/Service.h"
+#include "serial/serial.h"
+
+#include "SerialFrameListener.h"
+#include "SerialFrameParser.h"
+
+namespace msv {
+
+    using namespace std;
+
+    /**
+     * This class exchanges the frames with the interface board in its
+     * own thread: Received bytes are read in blocks as soon as they
+     * arrive, split into frames, and passed to a SerialFrameListener;
+     * commands handed over by send() are written by the same thread.
+     * Thus, neither a slow serial line nor the camera block each other.
+     */
+    class SerialIO : public core::base::Service {
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             *
+             * @param obj Reference to an object of this class.
+             */
+            SerialIO(const SerialIO &/*obj*/);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             *
+             * @param obj Reference to an object of this class.
+             * @return Reference to this instance.
+             */
+            SerialIO& operator=(const SerialIO &/*obj*/);
+
+        public:
+            enum {
+                MAX_COMMAND_SIZE = 32,
+                READ_BLOCK_SIZE = 64
+            };
+
+            /**
+             * Constructor.
+             *
+             * @param serial Opened serial port; its read timeout limits the delay of commands.
+             * @param parser Parser to split the received bytes into frames.
+             * @param listener Listener to be informed about received frames.
+             */
+            SerialIO(serial::Serial &serial, SerialFrameParser &parser, SerialFrameListener &listener);
+
+            virtual ~SerialIO();
+
+            /**
+             * This method hands over a command to be written. A command
+             * that was not written yet is replaced.
+             *
+             * @param command Command to write.
+             * @param size Size of the command (at most MAX_COMMAND_SIZE bytes).
+             */
+            void send(const uint8_t *command, const uint32_t &size);
+
+        private:
+            virtual void beforeStop();
+
+            virtual void run();
+
+            void writePendingCommand();
+
+        private:
+            serial::Serial &m_serial;
+            SerialFrameParser &m_parser;
+            SerialFrameListener &m_listener;
+
+            core::base::Mutex m_commandMutex;
+            uint8_t m_command[MAX_COMMAND_SIZE];
+            uint32_t m_commandSize;
+            bool m_hasCommand;
+    };
+
+} // msv
+
+#endif /*SERIALIO_H_*/
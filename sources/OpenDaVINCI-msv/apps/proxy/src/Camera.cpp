@@ -28,14 +28,19 @@ namespace msv {
     Camera::Camera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp) :
         m_sharedImage(),
         m_sharedMemory(),
+        m_frameRing(),
         m_name(name),
         m_id(id),
         m_width(width),
         m_height(height),
         m_bpp(bpp),
-        m_size(0) {
+        m_size(0),
+        m_numberOfCapturedFrames(0) {
 
-        m_sharedMemory = core::wrapper::SharedMemoryFactory::createSharedMemory(name, width * height * bpp);
+        const uint32_t FRAME_SIZE = width * height * bpp;
+        const uint32_t NUMBER_OF_SLOTS = core::base::SharedFrameRing::DEFAULT_NUMBER_OF_SLOTS;
+        m_sharedMemory = core::wrapper::SharedMemoryFactory::createSharedMemory(name, core::base::SharedFrameRing::getRequiredSize(FRAME_SIZE, NUMBER_OF_SLOTS));
+        m_frameRing = core::SharedPointer<core::base::SharedFrameRing>(new core::base::SharedFrameRing(m_sharedMemory, FRAME_SIZE, NUMBER_OF_SLOTS));
 
         m_sharedImage.setName(name);
         m_sharedImage.setWidth(width);
@@ -71,13 +76,20 @@ namespace msv {
         return m_size;
     }
 
+    uint32_t Camera::getNumberOfCapturedFrames() const {
+        return m_numberOfCapturedFrames;
+    }
+
     core::data::image::SharedImage Camera::capture() {
         if (isValid()) {
             if (captureFrame()) {
-                if (m_sharedMemory.isValid() && m_sharedMemory->isValid()) {
-                    m_sharedMemory->lock();
-                        copyImageTo((char*)m_sharedMemory->getSharedMemory(), m_size);
-                    m_sharedMemory->unlock();
+                if (m_frameRing.isValid() && m_frameRing->isFrameRing()) {
+                    // Consumers read the previous frame meanwhile without blocking the camera.
+                    char *dest = m_frameRing->beginWrite();
+                    if ( (dest != NULL) && copyImageTo(dest, m_size) ) {
+                        m_numberOfCapturedFrames++;
+                    }
+                    m_frameRing->endWrite();
                 }
             }
         }
@@ -0,0 +1,70 @@
+/**
+ * proxy - Sample application to encapsulate HW/SW interfacing with embedded systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "core/base/Lock.h"
+#include "core/base/Thread.h"
+
+#include "CameraCapture.h"
+
+namespace msv {
+
+    using namespace std;
+    using namespace core::base;
+    using namespace core::data::image;
+
+    CameraCapture::CameraCapture(Camera &camera) :
+        m_camera(camera),
+        m_latestFrameMutex(),
+        m_latestFrame(),
+        m_numberOfFrames(0) {}
+
+    CameraCapture::~CameraCapture() {}
+
+    uint32_t CameraCapture::getLatestFrame(SharedImage &sharedImage) {
+        Lock l(m_latestFrameMutex);
+        sharedImage = m_latestFrame;
+        return m_numberOfFrames;
+    }
+
+    void CameraCapture::beforeStop() {}
+
+    void CameraCapture::run() {
+        serviceReady();
+
+        while (isRunning()) {
+            // Grabbing blocks until the camera delivers the next frame.
+            const SharedImage si = m_camera.capture();
+            const uint32_t numberOfFrames = m_camera.getNumberOfCapturedFrames();
+
+            bool captured = false;
+            {
+                Lock l(m_latestFrameMutex);
+                captured = (numberOfFrames != m_numberOfFrames);
+                m_latestFrame = si;
+                m_numberOfFrames = numberOfFrames;
+            }
+
+            if (!captured) {
+                // Do not spin if the camera failed.
+                Thread::usleep(1000);
+            }
+        }
+    }
+
+} // msv
@@ -29,14 +29,16 @@ using namespace core::base;
 
 namespace msv {
 
-    OpenCVCamera::OpenCVCamera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp, const bool &headless) :
+    OpenCVCamera::OpenCVCamera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp, const bool &headless, const bool &preprocessing) :
         Camera(name, id, width, height, bpp),
         m_capture(NULL),       
         m_image(NULL),
+        m_frame(NULL),
         out(NULL),
         merge_image(NULL),
         gray_out(NULL),
-        isheadless(headless) {
+        isheadless(headless),
+        m_preprocessing(preprocessing) {
 
         m_capture = cvCaptureFromCAM(id);
         if (m_capture) {
@@ -49,6 +51,18 @@ namespace msv {
     }
 
     OpenCVCamera::~OpenCVCamera() {
+        if (m_image != NULL) {
+            cvReleaseImage(&m_image);
+        }
+        if (out != NULL) {
+            cvReleaseImage(&out);
+        }
+        if (merge_image != NULL) {
+            cvReleaseImage(&merge_image);
+        }
+        if (gray_out != NULL) {
+            cvReleaseImage(&gray_out);
+        }
         if (m_capture) {
             cvReleaseCapture(&m_capture);
             m_capture = NULL;
@@ -60,7 +74,8 @@ namespace msv {
     }
 
     /*---Capture the frame, if BPP in config is set to 1, set image to gray scale, 
-        else do all processing edge detection for debug purposes---*/
+        else share the color frame as it is or, if enabled, do all processing edge
+        detection for debug purposes---*/
 
     bool OpenCVCamera::captureFrame() {
         bool retVal = false;
@@ -69,13 +84,16 @@ namespace msv {
                 if (getBPP() == 1) {
                     IplImage *tmpFrame = cvRetrieveFrame(m_capture);
 
-                    if (m_image == NULL || out == NULL || gray_out == NULL) {
+                    if (m_image == NULL) {
                         m_image = cvCreateImage(cvGetSize(tmpFrame), IPL_DEPTH_8U, 1);                    
                     }                   
 
                     cvCvtColor( tmpFrame , m_image, CV_BGR2GRAY);
-
-
+                    m_frame = m_image;
+                }
+                else if (!m_preprocessing) {
+                    // The frame is valid until the next one is grabbed.
+                    m_frame = cvRetrieveFrame(m_capture);
                 }
                 else {
                     IplImage *tmpFrame = cvRetrieveFrame(m_capture);
@@ -92,6 +110,7 @@ namespace msv {
                     cvCanny( out, merge_image, 110, 55, 3 );
                     cvMerge(merge_image, merge_image, merge_image, NULL, tmpFrame);
                     cvDilate(tmpFrame, m_image,NULL,1);
+                    m_frame = m_image;
                 }
 
                 retVal = true;
@@ -103,13 +122,13 @@ namespace msv {
     bool OpenCVCamera::copyImageTo(char *dest, const uint32_t &size) {
         bool retVal = false;
 
-        if ( (dest != NULL) && (size > 0) && (m_image != NULL) ) {
-            ::memcpy(dest, m_image->imageData, size);
+        if ( (dest != NULL) && (size > 0) && (m_frame != NULL) ) {
+            ::memcpy(dest, m_frame->imageData, size);
 
             //check if configuration is tagged for running odroid headless.
             
             if(!isheadless){
-                cvShowImage("WindowShowImage", m_image);
+                cvShowImage("WindowShowImage", m_frame);
                 cvWaitKey(10);
             }
             
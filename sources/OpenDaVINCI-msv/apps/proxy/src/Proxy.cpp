@@ -21,7 +21,9 @@
 #include <cstring>
 #include <cmath>
 
+#include "core/base/ConfigurationValue.h"
 #include "core/base/KeyValueConfiguration.h"
+#include "core/base/Lock.h"
 #include "core/data/Container.h"
 #include "core/data/TimeStamp.h"
 #include "core/data/environment/VehicleData.h"
@@ -51,14 +53,17 @@ namespace msv {
 
     Proxy::Proxy(const int32_t &argc, char **argv) :
         ConferenceClientModule(argc, argv, "proxy"),
+        SerialFrameListener(),
+        m_distributeMutex(),
         m_recorder(NULL),
         m_camera(NULL),
+        m_cameraCapture(NULL),
         this_serial(NULL),
+        m_serialIO(NULL),
         endByte(0xFF),
         startByte(0xAA),
         outSer(),
-        incomingSer(),
-        oldIncomingSer(),
+        m_serialFrameParser(INSERIAL, startByte, endByte),
         speedOut(1500),
         steeringOut(90),
         irFrontRightMedian(),
@@ -92,8 +97,10 @@ namespace msv {
             const uint32_t NUMBER_OF_SEGMENTS = getKeyValueConfiguration().getValue<uint32_t>("global.buffer.numberOfMemorySegments");
             // Run recorder in asynchronous mode to allow real-time recording in background.
             const bool THREADING = true;
+            // 1 = write camera frames directly from the camera's shared memory instead of copying them into memory segments first.
+            const ConfigurationValue<uint32_t> recordInPlace(kv, "proxy.recordInPlace", 1);
 
-            m_recorder = new Recorder(recordingURL.str(), MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING);
+            m_recorder = new Recorder(recordingURL.str(), MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, recordInPlace == 1);
         }
 
         // Create the camera grabber.
@@ -105,22 +112,53 @@ namespace msv {
         const uint32_t HEIGHT = getKeyValueConfiguration().getValue<uint32_t>("proxy.camera.height");
         const uint32_t BPP = getKeyValueConfiguration().getValue<uint32_t>("proxy.camera.bpp");
         const bool headless = getKeyValueConfiguration().getValue<uint32_t>("global.headless") == 1;
+        const ConfigurationValue<uint32_t> preprocessing(kv, "proxy.camera.preprocessing", 0);
         if (TYPE.compare("opencv") == 0) {
-            m_camera = new OpenCVCamera(NAME, ID, WIDTH, HEIGHT, BPP, headless);
+            m_camera = new OpenCVCamera(NAME, ID, WIDTH, HEIGHT, BPP, headless, preprocessing == 1);
         }
 
         if (m_camera == NULL) {
             cerr << "No valid camera type defined." << endl;
         }
+        else {
+            // The camera captures at its own pace; body() only announces the latest frame.
+            m_cameraCapture = new CameraCapture(*m_camera);
+            m_cameraCapture->start();
+        }
+
+        /*---Establish serial port connection; the serial thread exchanges the frames from now on---*/
+        const uint32_t baud = 115200;
+        const string port = "/dev/ttyACM0";
+        cerr << "Trying port: " << port << endl;
 
-        //Establish serial port connection
+        try {
+            this_serial = new Serial(port, baud, Timeout::simpleTimeout(SERIAL_TIMEOUT));
+        }
+        catch (const std::exception &e) {
+            cerr << "IO Exception - SerialPort " << port << " is not configured correctly: " << e.what() << endl;
+            OPENDAVINCI_CORE_DELETE_POINTER(this_serial);
+        }
 
+        if ( (this_serial != NULL) && this_serial->isOpen() ) {
+            m_serialIO = new SerialIO(*this_serial, m_serialFrameParser, *this);
+            m_serialIO->start();
+        }
     }
 
     /*---This method will be call automatically _after_ return from body().---*/
 
     void Proxy::tearDown() {
-        
+        if (m_serialIO != NULL) {
+            m_serialIO->stop();
+            cout << "Proxy: Received " << m_serialFrameParser.getNumberOfFrames() << " frames, discarded " << m_serialFrameParser.getNumberOfDiscardedBytes() << " bytes." << endl;
+        }
+        OPENDAVINCI_CORE_DELETE_POINTER(m_serialIO);
+
+        if (m_cameraCapture != NULL) {
+            m_cameraCapture->stop();
+        }
+        OPENDAVINCI_CORE_DELETE_POINTER(m_cameraCapture);
+
         /*---send neutral signals to arduino---*/
         speedOut = 1500;
         steeringOut = 90;
@@ -135,14 +173,29 @@ namespace msv {
         for(int i = 0; i < OUTSERIAL-1; i++){
             outSer[OUTSERIAL - 1] ^= outSer[i];
         } 
-        for (int i = 0; i < 300; ++i){
-            this_serial->write(outSer, 7);
+        if (this_serial != NULL) {
+            try {
+                for (int i = 0; i < 300; ++i){
+                    this_serial->write(outSer, 7);
+                }
+            }
+            catch (const std::exception &e) {
+                cerr << "IO Exception - Could not send neutral signals: " << e.what() << endl;
+            }
+        }
+        OPENDAVINCI_CORE_DELETE_POINTER(this_serial);
+
+        if (m_recorder != NULL) {
+            cout << "Proxy: Recorded " << m_recorder->getDataStoreForSharedData().getNumberOfRecordedSharedMemories() << " frames, dropped " << m_recorder->getDataStoreForSharedData().getNumberOfDroppedSharedMemories() << " frames." << endl;
         }
         OPENDAVINCI_CORE_DELETE_POINTER(m_recorder);
         OPENDAVINCI_CORE_DELETE_POINTER(m_camera);
     }
 
     void Proxy::distribute(Container c) {
+        // Camera frames and serial frames are distributed from different threads.
+        Lock l(m_distributeMutex);
+
         // Store data to recorder.
         if (m_recorder != NULL) {
             // Time stamp data before storing.
@@ -213,55 +266,23 @@ namespace msv {
                 outSer[OUTSERIAL - 1] ^= outSer[i];
             } 
 
-            /*---Write byte array to Serial device---*/
+            /*---Hand byte array over to the serial thread---*/
 
-            int sentnum = (int)this_serial->write(outSer, 7);
-            cerr << "Succesfully sent bytes: " << sentnum << endl;
+            m_serialIO->send(outSer, OUTSERIAL);
         }
     }
 
-    /*---Read sensor data from the car/arduino from serial device---*/
-
-    int Proxy::getSerial() {
-
-        uint8_t current = 0;
-        uint8_t tempincoming[INSERIAL];
-        uint8_t check = 0;
-
-        /*---check that the first byte in line is the startByte else read to next endByte and reset start byte---*/
-        this_serial->read(&current,1);
-        if(current != startByte){
-            while (this_serial->read(&current,1) && current != endByte);
-            this_serial->read(&current,1);
-            this_serial->read(&current,1);
-        }
-
-
-        
-        tempincoming[0] = current;
-        this_serial->read(tempincoming + 1, 16);
+    /*---Called by the serial thread for every validated packet from the car/arduino---*/
 
-        //calculate checksum
-        for(int i = 0; i < INSERIAL; i++){
-            check ^= tempincoming[i];
-        }
-
-        /*---If all the expected bits are in place and checksum is satisfactory put 
-            temporary array to global and return success value---*/
-        
-        if(tempincoming[0] == startByte && tempincoming[INSERIAL - 2] == endByte && check == 0){
-            for(int i = 0; i < INSERIAL; i++){
-                incomingSer[i] = tempincoming[i];
-            }
-            return 1;
-        }else{
-            return 0;
+    void Proxy::nextFrame(const uint8_t *frame, const uint32_t &size) {
+        if (size == INSERIAL) {
+            distSerial(frame);
         }
     }
 
     /*---If an incoming serial packet is validated, it will be distributed to shared memory---*/
 
-    void Proxy::distSerial() {
+    void Proxy::distSerial(const uint8_t *incomingSer) {
         
         VehicleData vd;
         SensorBoardData sbd;
@@ -366,58 +387,25 @@ namespace msv {
         double cumulDuration;
         time_t startTime = time(0);
         
-        /*---Set serial settings---*/
-        uint32_t baud = 115200;
-        string port = "/dev/ttyACM0";
-        cerr << "Trying port: " << port << endl;
-
-        int goodSerial = 1;
-        int correctSerialDevice = true;
-
-        try{
-            this_serial = new Serial(port, baud, Timeout::simpleTimeout(2000));
-            //this_serial->flushInput();
-        }catch (IOException e){
-            cerr << "IO Exception - SerialPort" << port << "is not configured correctly" << endl;
-            correctSerialDevice = false;
-        }    
-        
         while (getModuleState() == ModuleState::RUNNING) {
 
-            /*---Capture image frame.--*/
-
-            if (m_camera != NULL) {                
-                core::data::image::SharedImage si = m_camera->capture();
-                Container c(Container::SHARED_IMAGE, si);
-                distribute(c);
-                captureCounter++;
-                cout << "Captured Frame" << endl;
-            }
-
-            /*---Start serial sequence---*/            
+            /*---Announce the latest captured image frame.--*/
 
-            if(correctSerialDevice && this_serial->isOpen()){
-                //if not receiving serial do not send
-                if(goodSerial){
-                    sendSerial();
+            if (m_cameraCapture != NULL) {
+                core::data::image::SharedImage si;
+                const uint32_t numberOfFrames = m_cameraCapture->getLatestFrame(si);
+                if (numberOfFrames != captureCounter) {
+                    Container c(Container::SHARED_IMAGE, si);
+                    distribute(c);
+                    captureCounter = numberOfFrames;
                 }
+            }
 
-                //only attempt serial read if there is a packet to read
-                if(this_serial->available() > 15){
-                    goodSerial = getSerial();
-                }
-                
-                //if a packet is captured, distribute it to shared memory
-                if(goodSerial){
-                    distSerial();
-                }
+            /*---Received packets are distributed by the serial thread---*/
 
-                // if incoming serial buffer is falling behind, flush it
-                if(this_serial->available() > 32){
-                    this_serial->flushInput();
-                }
+            if (m_serialIO != NULL) {
+                sendSerial();
             }
-            
         }
 
         /*---Show realtime frequency---*/
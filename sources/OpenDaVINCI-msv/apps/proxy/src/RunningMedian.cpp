@@ -1,54 +1,68 @@
 #include "RunningMedian.h"
 
 RunningMedian::RunningMedian():
-	circBuffer(),
-	sortedArray()
-	{}
+	circBuffer(BUFFSIZE, 0),
+	oldest(0),
+	lowerHalf(),
+	upperHalf()
+	{
+		rebalance();
+	}
+
+RunningMedian::RunningMedian(const uint32_t &windowSize):
+	circBuffer((windowSize > 0) ? windowSize : 1, 0),
+	oldest(0),
+	lowerHalf(),
+	upperHalf()
+	{
+		rebalance();
+	}
 
-/*---Add a value to the sliding window and sorted array---*/
+/*---Add a value to the sliding window replacing the oldest one---*/
 
 void RunningMedian::addValue(uint16_t value){
-	int i,j;
-	bool notReplaced = true;
-	uint16_t finalNum = circBuffer[BUFFSIZE -1];
-
-	//Iterate through circBuffer to move all elements up one place
-	for(i = (BUFFSIZE-1); i > 0; --i){
-		//remove old value from sorted array and close the gap
-		if(sortedArray[i] == finalNum && notReplaced){
-			for(j = i; j > 0; --j){
-				sortedArray[j] = sortedArray[j-1];
-			}
-			notReplaced = false;		
-		}
-		circBuffer[i] = circBuffer[i-1];
+	//remove the oldest value from the half containing it
+	const uint16_t finalNum = circBuffer[oldest];
+	if(!lowerHalf.empty() && finalNum <= *lowerHalf.rbegin()){
+		lowerHalf.erase(lowerHalf.find(finalNum));
+	}else{
+		upperHalf.erase(upperHalf.find(finalNum));
 	}
-	//Put new value at start of both
-	circBuffer[0] = value;
-	sortedArray[0] = value;
+
+	circBuffer[oldest] = value;
+	oldest = (oldest + 1) % circBuffer.size();
+
+	if(!lowerHalf.empty() && value <= *lowerHalf.rbegin()){
+		lowerHalf.insert(value);
+	}else{
+		upperHalf.insert(value);
+	}
+	rebalance();
 }
 
-/*---"Insert" the new value into the sorted array using a kind of 
-	insertion sort then redurn the median---*/
+/*---The greatest value of the lower half is the median---*/
 
 uint16_t RunningMedian::getMedian(){
-	int i = 1;
-	uint16_t tmp;
-
-	/*---insert the first element of sort list in place (rest can be assumed to be sorted), 
-		making room by pushing greater values back one place---*/
-
-	if(!(sortedArray[0] >= sortedArray[1])){
-		tmp = sortedArray[0]; 
-	 	while(i < BUFFSIZE && sortedArray[i] != tmp) {
-	 		if(tmp > sortedArray[i]){
-				break;
-			}else{
-				sortedArray[i-1] = sortedArray[i];
-			}
-			++i;
-	 	}
-	 	sortedArray[i - 1] = tmp;
+ 	return *lowerHalf.rbegin();
+}
+
+void RunningMedian::rebalance(){
+	const uint32_t lowerSize = (circBuffer.size() + 1) / 2;
+
+	//the initial window consists of zeros
+	if(lowerHalf.empty() && upperHalf.empty()){
+		lowerHalf.insert(circBuffer.begin(), circBuffer.begin() + lowerSize);
+		upperHalf.insert(circBuffer.begin() + lowerSize, circBuffer.end());
+	}
+
+	while(lowerHalf.size() > lowerSize){
+		multiset<uint16_t>::iterator greatest = lowerHalf.end();
+		--greatest;
+		upperHalf.insert(*greatest);
+		lowerHalf.erase(greatest);
+	}
+	while(lowerHalf.size() < lowerSize){
+		lowerHalf.insert(*upperHalf.begin());
+		upperHalf.erase(upperHalf.begin());
 	}
- 	return sortedArray[BUFFSIZE/2];
-}
\ No newline at end of file
+}
@@ -0,0 +1,104 @@
+/**
+ * proxy - Sample application to encapsulate HW/SW interfacing with embedded systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "SerialFrameParser.h"
+
+namespace msv {
+
+    using namespace std;
+
+    SerialFrameParser::SerialFrameParser(const uint32_t &frameSize, const uint8_t &startByte, const uint8_t &endByte) :
+        m_frameSize(frameSize),
+        m_startByte(startByte),
+        m_endByte(endByte),
+        m_buffer(),
+        m_head(0),
+        m_size(0),
+        m_numberOfFrames(0),
+        m_numberOfDiscardedBytes(0) {}
+
+    SerialFrameParser::~SerialFrameParser() {}
+
+    void SerialFrameParser::write(const uint8_t *data, const uint32_t &length) {
+        for (uint32_t i = 0; i < length; i++) {
+            if (m_size == BUFFER_SIZE) {
+                discard(1);
+            }
+            m_buffer[(m_head + m_size) & (BUFFER_SIZE - 1)] = data[i];
+            m_size++;
+        }
+    }
+
+    bool SerialFrameParser::read(uint8_t *frame) {
+        while ( (m_frameSize > 1) && (m_size >= m_frameSize) ) {
+            if ( (at(0) == m_startByte) && (at(m_frameSize - 2) == m_endByte) ) {
+                uint8_t checksum = 0;
+                for (uint32_t i = 0; i < m_frameSize; i++) {
+                    checksum ^= at(i);
+                }
+
+                if (checksum == 0) {
+                    for (uint32_t i = 0; i < m_frameSize; i++) {
+                        frame[i] = at(i);
+                    }
+                    m_head = (m_head + m_frameSize) & (BUFFER_SIZE - 1);
+                    m_size -= m_frameSize;
+                    m_numberOfFrames++;
+                    return true;
+                }
+            }
+
+            // Not the begin of a valid frame; try the next start byte.
+            uint32_t skip = 1;
+            while ( (skip < m_size) && (at(skip) != m_startByte) ) {
+                skip++;
+            }
+            discard(skip);
+        }
+
+        return false;
+    }
+
+    uint32_t SerialFrameParser::getFrameSize() const {
+        return m_frameSize;
+    }
+
+    uint32_t SerialFrameParser::getNumberOfBufferedBytes() const {
+        return m_size;
+    }
+
+    uint32_t SerialFrameParser::getNumberOfFrames() const {
+        return m_numberOfFrames;
+    }
+
+    uint32_t SerialFrameParser::getNumberOfDiscardedBytes() const {
+        return m_numberOfDiscardedBytes;
+    }
+
+    uint8_t SerialFrameParser::at(const uint32_t &offset) const {
+        return m_buffer[(m_head + offset) & (BUFFER_SIZE - 1)];
+    }
+
+    void SerialFrameParser::discard(const uint32_t &length) {
+        m_head = (m_head + length) & (BUFFER_SIZE - 1);
+        m_size -= length;
+        m_numberOfDiscardedBytes += length;
+    }
+
+} // msv
@@ -0,0 +1,101 @@
+/**
+ * proxy - Sample application to encapsulate HW/SW interfacing with embedded systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cstring>
+#include <iostream>
+
+#include "core/base/Lock.h"
+#include "core/base/Thread.h"
+
+#include "SerialIO.h"
+
+namespace msv {
+
+    using namespace std;
+    using namespace core::base;
+
+    SerialIO::SerialIO(serial::Serial &serial, SerialFrameParser &parser, SerialFrameListener &listener) :
+        m_serial(serial),
+        m_parser(parser),
+        m_listener(listener),
+        m_commandMutex(),
+        m_command(),
+        m_commandSize(0),
+        m_hasCommand(false) {}
+
+    SerialIO::~SerialIO() {}
+
+    void SerialIO::send(const uint8_t *command, const uint32_t &size) {
+        Lock l(m_commandMutex);
+        m_commandSize = (size < MAX_COMMAND_SIZE) ? size : static_cast<uint32_t>(MAX_COMMAND_SIZE);
+        ::memcpy(m_command, command, m_commandSize);
+        m_hasCommand = true;
+    }
+
+    void SerialIO::beforeStop() {}
+
+    void SerialIO::run() {
+        serviceReady();
+
+        uint8_t block[READ_BLOCK_SIZE];
+        uint8_t frame[SerialFrameParser::BUFFER_SIZE];
+
+        try {
+            while (isRunning()) {
+                writePendingCommand();
+
+                // Returns after the serial port's read timeout at the latest.
+                if (m_serial.waitReadable()) {
+                    size_t available = m_serial.available();
+                    if (available > READ_BLOCK_SIZE) {
+                        available = READ_BLOCK_SIZE;
+                    }
+
+                    const size_t length = m_serial.read(block, (available > 0) ? available : 1);
+                    m_parser.write(block, static_cast<uint32_t>(length));
+
+                    while (m_parser.read(frame)) {
+                        m_listener.nextFrame(frame, m_parser.getFrameSize());
+                    }
+                }
+            }
+        }
+        catch (const std::exception &e) {
+            cerr << "SerialIO: Stopped communication: " << e.what() << endl;
+        }
+    }
+
+    void SerialIO::writePendingCommand() {
+        uint8_t command[MAX_COMMAND_SIZE];
+        uint32_t size = 0;
+        {
+            Lock l(m_commandMutex);
+            if (m_hasCommand) {
+                ::memcpy(command, m_command, m_commandSize);
+                size = m_commandSize;
+                m_hasCommand = false;
+            }
+        }
+
+        if (size > 0) {
+            m_serial.write(command, size);
+        }
+    }
+
+} // msv
@@ -20,10 +20,17 @@
 #ifndef ProxyTESTSUITE_H_
 #define ProxyTESTSUITE_H_
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
 #include "cxxtest/TestSuite.h"
 
 // Include local header files.
 #include "../include/Proxy.h"
+#include "../include/RunningMedian.h"
+#include "../include/SerialFrameParser.h"
 
 using namespace std;
 using namespace core::data;
@@ -84,6 +91,114 @@ class ProxyTest : public CxxTest::TestSuite {
             TS_ASSERT(dt != NULL);
         }
 
+        void createFrame(uint8_t *frame, const uint8_t &value) {
+            frame[0] = 0xAA;
+            for (uint32_t i = 1; i < 15; i++) {
+                frame[i] = value + i;
+            }
+            frame[15] = 0xFF;
+            frame[16] = 0;
+            for (uint32_t i = 0; i < 16; i++) {
+                frame[16] ^= frame[i];
+            }
+        }
+
+        void testSerialFrameParserSplitFrames() {
+            SerialFrameParser parser(17, 0xAA, 0xFF);
+            uint8_t frame[17];
+            uint8_t received[17];
+            createFrame(frame, 3);
+
+            parser.write(frame, 10);
+            TS_ASSERT(!parser.read(received));
+            parser.write(frame + 10, 7);
+            TS_ASSERT(parser.read(received));
+            TS_ASSERT(::memcmp(frame, received, 17) == 0);
+            TS_ASSERT(!parser.read(received));
+            TS_ASSERT_EQUALS(parser.getNumberOfFrames(), 1u);
+            TS_ASSERT_EQUALS(parser.getNumberOfBufferedBytes(), 0u);
+        }
+
+        void testSerialFrameParserResynchronizes() {
+            SerialFrameParser parser(17, 0xAA, 0xFF);
+            uint8_t frame[17];
+            uint8_t corrupted[17];
+            uint8_t received[17];
+            createFrame(frame, 0x10);
+            createFrame(corrupted, 0x20);
+            corrupted[5] ^= 0x01;
+
+            // Garbage with start bytes, a corrupted frame, and two valid frames.
+            const uint8_t garbage[] = { 0x01, 0xAA, 0xFF, 0xAA, 0x17 };
+            parser.write(garbage, sizeof(garbage));
+            parser.write(corrupted, 17);
+            parser.write(frame, 17);
+            parser.write(frame, 17);
+
+            TS_ASSERT(parser.read(received));
+            TS_ASSERT(::memcmp(frame, received, 17) == 0);
+            TS_ASSERT(parser.read(received));
+            TS_ASSERT(::memcmp(frame, received, 17) == 0);
+            TS_ASSERT(!parser.read(received));
+            TS_ASSERT_EQUALS(parser.getNumberOfFrames(), 2u);
+            TS_ASSERT_EQUALS(parser.getNumberOfDiscardedBytes(), sizeof(garbage) + 17);
+        }
+
+        void testSerialFrameParserOverflow() {
+            SerialFrameParser parser(17, 0xAA, 0xFF);
+            uint8_t frame[17];
+            uint8_t received[17];
+
+            // Only the most recent frames survive if nobody reads.
+            for (uint32_t i = 0; i < 2 * SerialFrameParser::BUFFER_SIZE / 17; i++) {
+                createFrame(frame, i);
+                parser.write(frame, 17);
+            }
+            TS_ASSERT_EQUALS(parser.getNumberOfBufferedBytes(), static_cast<uint32_t>(SerialFrameParser::BUFFER_SIZE));
+
+            uint32_t numberOfFrames = 0;
+            while (parser.read(received)) {
+                numberOfFrames++;
+            }
+            TS_ASSERT(::memcmp(frame, received, 17) == 0);
+            TS_ASSERT_EQUALS(numberOfFrames, static_cast<uint32_t>(SerialFrameParser::BUFFER_SIZE / 17));
+        }
+
+        void testRunningMedianDefaultWindow() {
+            RunningMedian median;
+
+            // The window is initially filled with zeros.
+            median.addValue(10);
+            median.addValue(20);
+            TS_ASSERT_EQUALS(median.getMedian(), 0);
+            median.addValue(30);
+            TS_ASSERT_EQUALS(median.getMedian(), 10);
+
+            // A single spike is suppressed.
+            median.addValue(20);
+            median.addValue(20);
+            median.addValue(1000);
+            TS_ASSERT_EQUALS(median.getMedian(), 20);
+        }
+
+        void testRunningMedianLargeWindows() {
+            for (uint32_t windowSize = 1; windowSize < 32; windowSize++) {
+                RunningMedian median(windowSize);
+                vector<uint16_t> window(windowSize, 0);
+
+                for (uint32_t i = 0; i < 1000; i++) {
+                    const uint16_t value = static_cast<uint16_t>(rand() % ((i % 2 == 0) ? 8 : 1000));
+                    median.addValue(value);
+                    window[i % windowSize] = value;
+
+                    // The lower median for even window sizes.
+                    vector<uint16_t> sorted(window);
+                    sort(sorted.begin(), sorted.end());
+                    TS_ASSERT_EQUALS(median.getMedian(), sorted[(windowSize - 1) / 2]);
+                }
+            }
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////
         // Below this line the necessary constructor for initializing the pointer variables,
         // and the forbidden copy constructor and assignment operator are declared.
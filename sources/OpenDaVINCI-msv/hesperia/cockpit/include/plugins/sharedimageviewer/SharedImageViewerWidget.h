@@ -34,6 +34,7 @@
 #include "core/SharedPointer.h"
 #include "core/base/Mutex.h"
 #include "core/io/ContainerListener.h"
+#include "core/base/SharedFrameRing.h"
 #include "core/wrapper/SharedMemory.h"
 #include "core/data/image/SharedImage.h"
 
@@ -89,6 +90,8 @@ namespace cockpit {
                     mutable core::base::Mutex m_sharedImageMemoryMutex;
                     core::data::image::SharedImage m_sharedImage;
                     core::SharedPointer<core::wrapper::SharedMemory> m_sharedImageMemory;
+                    core::SharedPointer<core::base::SharedFrameRing> m_sharedImageRing;
+                    vector<char> m_frame;
                     QImage *m_drawableImage;
                     QVector<QRgb> m_grayscale;
 
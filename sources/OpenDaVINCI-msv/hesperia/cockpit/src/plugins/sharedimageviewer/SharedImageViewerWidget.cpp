@@ -49,6 +49,8 @@ namespace cockpit {
                     m_sharedImageMemoryMutex(),
                     m_sharedImage(),
                     m_sharedImageMemory(),
+                    m_sharedImageRing(),
+                    m_frame(),
                     m_drawableImage(NULL),
                     m_grayscale(),
                     m_list(NULL),
@@ -94,7 +96,9 @@ namespace cockpit {
                         setWindowTitle(QString::fromStdString(si.toString()));
 
             			m_sharedImageMemory = core::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
+            			m_sharedImageRing = core::SharedPointer<SharedFrameRing>(new SharedFrameRing(m_sharedImageMemory));
             			m_sharedImage = si;
+            			m_frame.resize(si.getSize());
 
             			// Remove the selection box.
             			m_list->hide();
@@ -125,16 +129,17 @@ namespace cockpit {
             void SharedImageViewerWidget::paintEvent(QPaintEvent * /*evnt*/) {
                 Lock l(m_sharedImageMemoryMutex);
 
-                if ( (m_sharedImageMemory.isValid()) && (m_sharedImageMemory->isValid()) ) {
-                    m_sharedImageMemory->lock();
-
+                uint32_t frameNumber = 0;
+                if ( (m_sharedImageRing.isValid()) &&
+                     (m_frame.size() > 0) &&
+                     (m_sharedImageRing->read(&m_frame[0], m_frame.size(), frameNumber)) ) {
                     OPENDAVINCI_CORE_DELETE_POINTER(m_drawableImage);
                     if (m_sharedImage.getBytesPerPixel() == 3) {
-                        m_drawableImage = new QImage((uchar*)(static_cast<char*>(m_sharedImageMemory->getSharedMemory())), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel() * m_sharedImage.getWidth(), QImage::Format_RGB888);
+                        m_drawableImage = new QImage((uchar*)(&m_frame[0]), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel() * m_sharedImage.getWidth(), QImage::Format_RGB888);
                         *m_drawableImage = m_drawableImage->rgbSwapped();
                     }
                     else if (m_sharedImage.getBytesPerPixel() == 1) {
-                        m_drawableImage = new QImage((uchar*)(static_cast<char*>(m_sharedImageMemory->getSharedMemory())), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel() * m_sharedImage.getWidth(), QImage::Format_Indexed8);
+                        m_drawableImage = new QImage((uchar*)(&m_frame[0]), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel() * m_sharedImage.getWidth(), QImage::Format_Indexed8);
                         m_drawableImage->setColorTable(m_grayscale);
                     }
 
@@ -142,7 +147,6 @@ namespace cockpit {
                         QPainter widgetPainter(this);
                         widgetPainter.drawImage(0, 0, *m_drawableImage);
                     }
-                    m_sharedImageMemory->unlock();
                 }
             }
 
@@ -32,7 +32,6 @@
 #include "hesperia/scenario/SCNXArchive.h"
 #include "hesperia/scenario/SCNXArchiveFactory.h"
 #include "hesperia/data/scenario/Scenario.h"
-#include "hesperia/scenario/LaneVisitor.h"
 #include "hesperia/data/environment/EgoState.h"
 #include "core/data/environment/Point3.h"
 #include "hesperia/data/environment/NamedLine.h"
@@ -67,22 +66,14 @@ namespace measurements {
 
         // Get scenario.
         const URL urlOfSCNXFile(getKeyValueConfiguration().getValue<string>("global.scenario"));
-        
-        // Create graph.
-        core::wrapper::graph::DirectedGraph m_graph;
 
         // Read scenario.
         vector<NamedLine> listOfLines;
         if (urlOfSCNXFile.isValid()) {
             SCNXArchive &scnxArchive = SCNXArchiveFactory::getInstance().getSCNXArchive(urlOfSCNXFile);
 
-            hesperia::data::scenario::Scenario &scenario = scnxArchive.getScenario();
-
-            // Construct road network.
-            LaneVisitor lv(m_graph, scenario);
-            scenario.accept(lv);
-
-            listOfLines = lv.getListOfLines();
+            // The road network is constructed once per archive.
+            listOfLines = scnxArchive.getLaneIndex().getListOfLines();
         }
 
         
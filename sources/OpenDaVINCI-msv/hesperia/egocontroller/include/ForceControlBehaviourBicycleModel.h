@@ -20,6 +20,8 @@
 #ifndef EGOCONTROLLER_FORCECONTROLBEHAVIOURBICYCLEMODEL_H_
 #define EGOCONTROLLER_FORCECONTROLBEHAVIOURBICYCLEMODEL_H_
 
+#include <vector>
+
 #include "core/data/TimeStamp.h"
 
 #include "ControlBehaviour.h"
@@ -56,6 +58,13 @@ namespace egocontroller {
             virtual void stop();
             virtual hesperia::data::environment::EgoState computeEgoState();
 
+            // Advances the vehicle by the given time step (in seconds) without touching the clock;
+            // returns false if the vehicle stands still.
+            bool integrate(const double &timeStep);
+
+            // Advances all given vehicles by the given time step (in seconds) without touching the clock.
+            static void integrate(vector<ForceControlBehaviourBicycleModel> &vehicles, const double &timeStep);
+
         protected:
             double m_minimumTurningRadius;
             double m_vehicleMass;
@@ -95,6 +104,8 @@ namespace egocontroller {
             core::data::TimeStamp m_previousTime;
             hesperia::data::environment::Point3 m_oldPosition;
             hesperia::data::environment::Point3 m_orientation;
+            hesperia::data::environment::Point3 m_velocityVector;
+            hesperia::data::environment::Point3 m_acceleration;
     };
 }
 
@@ -20,6 +20,8 @@
 #ifndef EGOCONTROLLER_FORCECONTROLBEHAVIOURSIMPLIFIEDBICYCLEMODEL_H_
 #define EGOCONTROLLER_FORCECONTROLBEHAVIOURSIMPLIFIEDBICYCLEMODEL_H_
 
+#include <vector>
+
 #include "core/data/TimeStamp.h"
 
 #include "ControlBehaviour.h"
@@ -52,6 +54,12 @@ namespace egocontroller {
             virtual void stop();
             virtual hesperia::data::environment::EgoState computeEgoState();
 
+            // Advances the vehicle by the given time step (in seconds) without touching the clock.
+            void integrate(const double &timeStep);
+
+            // Advances all given vehicles by the given time step (in seconds) without touching the clock.
+            static void integrate(vector<ForceControlBehaviourSimplifiedBicycleModel> &vehicles, const double &timeStep);
+
         protected:
             double m_minimumTurningRadius;
             double m_vehicleMass;
@@ -86,6 +94,8 @@ namespace egocontroller {
             core::data::TimeStamp m_previousTime;
             core::data::environment::Point3 m_oldPosition;
             core::data::environment::Point3 m_orientation;
+            core::data::environment::Point3 m_velocityVector;
+            core::data::environment::Point3 m_acceleration;
     };
 }
 
@@ -77,7 +77,9 @@ namespace egocontroller {
         m_vehicleResistiveEffortX(0),
         m_previousTime(),
         m_oldPosition(),
-        m_orientation(1,0,0)
+        m_orientation(1,0,0),
+        m_velocityVector(),
+        m_acceleration()
     {}
 
     ForceControlBehaviourBicycleModel::~ForceControlBehaviourBicycleModel()
@@ -121,6 +123,15 @@ namespace egocontroller {
         TimeStamp currentTime;
         double timeStep = (currentTime.toMicroseconds() - m_previousTime.toMicroseconds()) / (1000.0 * 1000.0);
 
+        if (!integrate(timeStep)) {
+            return EgoState(m_oldPosition, m_orientation, Point3(0, 0, 0), Point3(0, 0, 0));
+        }
+
+        m_previousTime = currentTime;
+        return EgoState(m_oldPosition, m_orientation, m_velocityVector, m_acceleration);
+    }
+
+    bool ForceControlBehaviourBicycleModel::integrate(const double &timeStep) {
         ////////////////////////////////////////////////////////////////////////
         // Desired inputs.
 
@@ -157,7 +168,7 @@ namespace egocontroller {
         }
 
         if (fabs(m_velocity) < 1e-5) {
-            return EgoState(m_oldPosition, m_orientation, Point3(0, 0, 0), Point3(0, 0, 0));
+            return false;
         }
 
         ////////////////////////////////////////////////////////////////////////
@@ -215,23 +226,27 @@ namespace egocontroller {
         m_steeringAngle = timeStep * (m_vehicleDesiredRotationalEffort - m_steeringAngle);
 //        m_steeringAngle = m_vehicleDesiredRotationalEffort;
 
-        cerr << "X: " << x << ", Y: " << y << ", cAF: " << cAlphaFront << ", cAR: " << cAlphaRear << ", m_yaw = " << m_yaw << ", m_yawRate = " << m_yawRate << ", m_attitudeAngle = " << m_attitudeAngle << ", m_steeringRate: " << m_steeringRate << ", m_steeringAngle: " << m_steeringAngle << ", desiredRot: " << m_vehicleDesiredRotationalEffort << endl;
+        const double cosYaw = cos(m_yaw);
+        const double sinYaw = sin(m_yaw);
 
-        m_orientation = Point3(1, 0, 0);
-        m_orientation.rotateZ(m_yaw);
-        m_orientation.normalize();
+        m_orientation.setX(cosYaw);
+        m_orientation.setY(sinYaw);
 
-        Point3 position(m_oldPosition.getX() + x, m_oldPosition.getY() + y, 0);
-        m_oldPosition = position;
+        m_oldPosition.setX(m_oldPosition.getX() + x);
+        m_oldPosition.setY(m_oldPosition.getY() + y);
+        m_oldPosition.setZ(0);
 
         // Set velocity.
-        Point3 velocity(cos(m_yaw) * m_velocity,
-                        sin(m_yaw) * m_velocity,
-                        0);
+        m_velocityVector.setX(cosYaw * m_velocity);
+        m_velocityVector.setY(sinYaw * m_velocity);
 
-        Point3 acceleration;
+        return true;
+    }
 
-        m_previousTime = currentTime;
-        return EgoState(position, m_orientation, velocity, acceleration);
+    void ForceControlBehaviourBicycleModel::integrate(vector<ForceControlBehaviourBicycleModel> &vehicles, const double &timeStep) {
+        const uint32_t SIZE = vehicles.size();
+        for (uint32_t i = 0; i < SIZE; i++) {
+            vehicles[i].integrate(timeStep);
+        }
     }
 }
@@ -67,7 +67,9 @@ namespace egocontroller {
         m_vehicleResistiveEffortX(0),
         m_previousTime(),
         m_oldPosition(),
-        m_orientation(1,0,0)
+        m_orientation(1,0,0),
+        m_velocityVector(),
+        m_acceleration()
     {}
 
     ForceControlBehaviourSimplifiedBicycleModel::~ForceControlBehaviourSimplifiedBicycleModel()
@@ -113,6 +115,13 @@ namespace egocontroller {
         TimeStamp currentTime;
         double timeStep = (currentTime.toMicroseconds() - m_previousTime.toMicroseconds()) / (1000.0 * 1000.0);
 
+        integrate(timeStep);
+
+        m_previousTime = currentTime;
+        return EgoState(m_oldPosition, m_orientation, m_velocityVector, m_acceleration);
+    }
+
+    void ForceControlBehaviourSimplifiedBicycleModel::integrate(const double &timeStep) {
         ////////////////////////////////////////////////////////////////////////
         // Longitudinal input.
 
@@ -151,23 +160,25 @@ namespace egocontroller {
 
         m_yaw = m_yaw + relativeYaw;
 
-        cerr << "X: " << relativeX << ", Y: " << relativeY << ", relYaw: " << relativeYaw << ", relSteeringAngle: " << relativeSteeringAngle << ", yaw: " << m_yaw << "velocity: " << m_velocity << ", m_steeringRate: " << m_steeringRate << ", m_steeringAngle: " << m_steeringAngle << ", desiredAngle: " << m_vehicleDesiredSteeringAngle << endl;
+        const double cosYaw = cos(m_yaw);
+        const double sinYaw = sin(m_yaw);
 
-        m_orientation = Point3(1, 0, 0);
-        m_orientation.rotateZ(m_yaw);
-        m_orientation.normalize();
+        m_orientation.setX(cosYaw);
+        m_orientation.setY(sinYaw);
 
-        Point3 position(m_oldPosition.getX() + relativeX, m_oldPosition.getY() + relativeY, 0);
-        m_oldPosition = position;
+        m_oldPosition.setX(m_oldPosition.getX() + relativeX);
+        m_oldPosition.setY(m_oldPosition.getY() + relativeY);
+        m_oldPosition.setZ(0);
 
         // Set velocity.
-        Point3 velocity(cos(m_yaw) * m_velocity,
-                        sin(m_yaw) * m_velocity,
-                        0);
-
-        Point3 acceleration;
+        m_velocityVector.setX(cosYaw * m_velocity);
+        m_velocityVector.setY(sinYaw * m_velocity);
+    }
 
-        m_previousTime = currentTime;
-        return EgoState(position, m_orientation, velocity, acceleration);
+    void ForceControlBehaviourSimplifiedBicycleModel::integrate(vector<ForceControlBehaviourSimplifiedBicycleModel> &vehicles, const double &timeStep) {
+        const uint32_t SIZE = vehicles.size();
+        for (uint32_t i = 0; i < SIZE; i++) {
+            vehicles[i].integrate(timeStep);
+        }
     }
 }
@@ -20,8 +20,10 @@
 #ifndef HESPERIA_WRAPPER_GRAPH_DIRECTEDGRAPH_H_
 #define HESPERIA_WRAPPER_GRAPH_DIRECTEDGRAPH_H_
 
+#include <list>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 // native.h must be included as first header file for definition of _WIN32_WINNT.
@@ -40,10 +42,18 @@ namespace core {
             using namespace std;
 
             /**
-             * This interface encapsulates all necessary method for a graph's vertex.
+             * This class encapsulates a directed graph. The shortest paths
+             * are computed using A* and the most recently queried routes
+             * are cached until the graph is modified.
              */
             class OPENDAVINCI_API DirectedGraph {
                 private:
+                    /**
+                     * Maximum number of routes to be cached.
+                     */
+                    const static uint32_t MAXIMUM_NUMBER_OF_CACHED_ROUTES;
+
+
                     /**
                      * "Forbidden" copy constructor. Goal: The compiler should warn
                      * already at compile time for unwanted bugs caused by any misuse
@@ -112,6 +122,13 @@ namespace core {
                      */
                     vector<const Vertex*> getShortestPath(const Vertex &v1, const Vertex &v2);
 
+                    /**
+                     * This method returns the number of currently cached routes.
+                     *
+                     * @return Number of cached routes.
+                     */
+                    uint32_t getNumberOfCachedRoutes() const;
+
                 private:
                     typedef boost::adjacency_list<boost::vecS, boost::vecS, boost::directedS, const Vertex*, boost::property<boost::edge_weight_t, double> > GraphDefinition;
                     typedef boost::property_map<GraphDefinition, boost::edge_weight_t>::type WeightMap;
@@ -119,8 +136,28 @@ namespace core {
                     GraphDefinition m_graph; // Graph.
                     WeightMap m_weightMap; // Edges' weights.
                     map<int32_t, GraphDefinition::vertex_descriptor> m_mapOfVertices; // Map of vertices.
+                    typedef pair<int32_t, int32_t> RouteKey; // Identifiers of start and end vertex.
+                    typedef list<pair<RouteKey, vector<const Vertex*> > > ListOfRoutes;
+
+                    /**
+                     * This method computes the shortest path between
+                     * the given vertices using A*.
+                     *
+                     * @param start Start vertex.
+                     * @param end End vertex.
+                     * @param route List of vertices to choose to reach end from start; empty if end cannot be reached.
+                     */
+                    void computeShortestPath(const GraphDefinition::vertex_descriptor &start, const GraphDefinition::vertex_descriptor &end, vector<const Vertex*> &route);
+
+                    /**
+                     * This method removes all cached routes.
+                     */
+                    void clearCachedRoutes();
+
                     vector<const Vertex*> m_listOfVertices;
                     vector<const Edge*> m_listOfEdges;
+                    ListOfRoutes m_cachedRoutes; // Most recently used route first.
+                    map<RouteKey, ListOfRoutes::iterator> m_mapOfCachedRoutes;
             };
 
         }
@@ -0,0 +1,105 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef HESPERIA_DATA_ENVIRONMENT_PACKEDVERTEXLIST_H_
+#define HESPERIA_DATA_ENVIRONMENT_PACKEDVERTEXLIST_H_
+
+#include <vector>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+
+#include "core/base/Deserializer.h"
+#include "core/base/Serializer.h"
+#include "core/data/environment/Point3.h"
+
+namespace hesperia {
+    namespace data {
+        namespace environment {
+
+            using namespace std;
+
+            /**
+             * This class serializes lists of vertices as used by Polygon,
+             * Route, and ContouredObject. The vertices are written as one
+             * block of coordinates (x, y, z as doubles in network byte
+             * order) instead of one nested netstring per Point3. A version
+             * field tells the readers which layout was used so that data
+             * written with the former layout can still be read.
+             */
+            class OPENDAVINCI_API PackedVertexList {
+                private:
+                    /**
+                     * "Forbidden" default constructor. This class only
+                     * provides static methods.
+                     */
+                    PackedVertexList();
+
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    PackedVertexList(const PackedVertexList &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    PackedVertexList& operator=(const PackedVertexList &);
+
+                public:
+                    enum VERSION {
+                        NESTED = 0, // One serialized Point3 per vertex.
+                        PACKED = 1  // Contiguous coordinates.
+                    };
+
+                    /**
+                     * This method writes the given vertices using the
+                     * packed layout.
+                     *
+                     * @param s Serializer to write to.
+                     * @param numberOfVerticesID Identifier of the number of vertices.
+                     * @param verticesID Identifier of the block of coordinates.
+                     * @param listOfVertices Vertices to write.
+                     */
+                    static void write(core::base::Serializer &s, const uint32_t &numberOfVerticesID, const uint32_t &verticesID, const vector<core::data::environment::Point3> &listOfVertices);
+
+                    /**
+                     * This method reads vertices written with either
+                     * layout and appends them to the given list. Packed
+                     * vertices whose number does not match the size of
+                     * the stored coordinates are rejected.
+                     *
+                     * @param d Deserializer to read from.
+                     * @param numberOfVerticesID Identifier of the number of vertices.
+                     * @param verticesID Identifier of the block of coordinates or of the nested vertices.
+                     * @param listOfVertices List to append the vertices to.
+                     * @return false if the stored vertices were rejected.
+                     */
+                    static bool read(core::base::Deserializer &d, const uint32_t &numberOfVerticesID, const uint32_t &verticesID, vector<core::data::environment::Point3> &listOfVertices);
+            };
+
+        }
+    }
+} // hesperia::data::environment
+
+#endif /*HESPERIA_DATA_ENVIRONMENT_PACKEDVERTEXLIST_H_*/
@@ -37,12 +37,20 @@ namespace hesperia {
             using namespace core::data::environment;
 
             /**
-             * This class represents a polygon.
+             * This class represents a polygon. Besides the vertices, the
+             * polygon keeps their XY coordinates in a flat array and their
+             * axis-aligned bounding box to speed up the geometric queries.
              */
             class OPENDAVINCI_API Polygon : public core::data::SerializableData {
                 private:
                     const static double EPSILON;
 
+                    /**
+                     * Minimum distance between two polygons to consider
+                     * them as separated without testing their edges.
+                     */
+                    const static double SEPARATION;
+
                 public:
                     Polygon();
 
@@ -103,7 +111,9 @@ namespace hesperia {
                     /**
                      * This method intersects this polygon with
                      * the other return the resulting contour
-                     * ignoring the Z coordinate.
+                     * ignoring the Z coordinate. The contour consists
+                     * of the intersection points of both polygons' edges
+                     * and of the vertices from other inside this polygon.
                      *
                      * @param other Polygon to be intersect with this one.
                      * @return Polygon built from intersection points.
@@ -138,7 +148,48 @@ namespace hesperia {
                     virtual const string toString() const;
 
                 private:
+                    /**
+                     * This method rebuilds the flat coordinates and the
+                     * bounding box from the list of vertices.
+                     */
+                    void updateCoordinates();
+
+                    /**
+                     * This method checks if the given point is within
+                     * this polygon ignoring Z coordinate.
+                     *
+                     * @param x X coordinate of the point to be tested.
+                     * @param y Y coordinate of the point to be tested.
+                     * @return true, if the point is within this polygon.
+                     */
+                    bool containsIgnoreZ(const double &x, const double &y) const;
+
+                    /**
+                     * @param other Polygon to compare with.
+                     * @return true, if the bounding boxes of both polygons overlap.
+                     */
+                    bool overlapsBoundingBoxIgnoreZ(const Polygon &other) const;
+
+                    /**
+                     * @return true, if this polygon has at least three vertices and is convex.
+                     */
+                    bool isConvexIgnoreZ() const;
+
+                    /**
+                     * This method searches for a separating axis among the
+                     * edges' normals of both polygons which must be convex.
+                     *
+                     * @param other Polygon to compare with.
+                     * @return true, if a separating axis was found.
+                     */
+                    bool isSeparatedIgnoreZ(const Polygon &other) const;
+
                     vector<Point3> m_listOfVertices;
+                    vector<double> m_coordinatesXY;
+                    double m_minX;
+                    double m_minY;
+                    double m_maxX;
+                    double m_maxY;
             };
 
         }
@@ -0,0 +1,142 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_SCENARIO_LANEINDEX_H_
+#define HESPERIA_SCENARIO_LANEINDEX_H_
+
+#include <vector>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+#include "core/data/environment/Point3.h"
+#include "core/wrapper/graph/DirectedGraph.h"
+
+#include "hesperia/data/environment/NamedLine.h"
+#include "hesperia/data/scenario/Scenario.h"
+
+namespace hesperia {
+    namespace scenario {
+
+        using namespace std;
+
+        /**
+         * This class holds the lane geometry of a scenario. It contains
+         * the road network graph and the lane segments that LaneVisitor
+         * creates. It also has a uniform grid over the segments, so the
+         * nearest lane segment to a position can be found without
+         * checking every segment.
+         */
+        class OPENDAVINCI_API LaneIndex {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                LaneIndex(const LaneIndex &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                LaneIndex& operator=(const LaneIndex &);
+
+            public:
+                /**
+                 * Constructor. The scenario is visited once by LaneVisitor.
+                 *
+                 * @param scenario Scenario to index.
+                 */
+                LaneIndex(data::scenario::Scenario &scenario);
+
+                /**
+                 * Constructor for the given lane segments without road network.
+                 *
+                 * @param listOfLines Lane segments to index.
+                 */
+                LaneIndex(const vector<data::environment::NamedLine> &listOfLines);
+
+                virtual ~LaneIndex();
+
+                /**
+                 * This method returns the road network.
+                 *
+                 * @return Road network.
+                 */
+                core::wrapper::graph::DirectedGraph& getGraph();
+
+                /**
+                 * This method returns all lane segments. Arcs are
+                 * approximated by several segments.
+                 *
+                 * @return List of lane segments.
+                 */
+                const vector<data::environment::NamedLine>& getListOfLines() const;
+
+                /**
+                 * This method finds the lane segment nearest to the given
+                 * position in the XY-plane. The distance is measured to the
+                 * segment itself, not to the infinite line through it.
+                 *
+                 * @param position Position.
+                 * @param line Nearest lane segment.
+                 * @param distance Distance between position and line.
+                 * @return true if there is any lane segment.
+                 */
+                bool getNearestLine(const core::data::environment::Point3 &position, data::environment::NamedLine &line, double &distance) const;
+
+            private:
+                /**
+                 * This method builds the grid for m_listOfLines.
+                 */
+                void buildGrid();
+
+                /**
+                 * This method returns the squared distance in the XY-plane
+                 * between the given position and a lane segment.
+                 *
+                 * @param x X coordinate of the position.
+                 * @param y Y coordinate of the position.
+                 * @param index Index of the lane segment.
+                 * @return Squared distance.
+                 */
+                double getSquaredDistanceTo(const double &x, const double &y, const uint32_t &index) const;
+
+                core::wrapper::graph::DirectedGraph m_graph;
+                vector<data::environment::NamedLine> m_listOfLines;
+
+                // End points of the segments as x1, y1, x2, y2.
+                vector<double> m_coordinates;
+
+                double m_minX;
+                double m_minY;
+                double m_cellSize;
+                uint32_t m_columns;
+                uint32_t m_rows;
+
+                // Segments of cell i are m_cellEntries[m_cellStart[i] .. m_cellStart[i+1]).
+                vector<uint32_t> m_cellStart;
+                vector<uint32_t> m_cellEntries;
+        };
+
+    }
+} // hesperia::scenario
+
+#endif /*HESPERIA_SCENARIO_LANEINDEX_H_*/
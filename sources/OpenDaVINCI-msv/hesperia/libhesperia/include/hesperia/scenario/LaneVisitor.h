@@ -20,17 +20,23 @@
 #ifndef HESPERIA_SCENARIO_LANEVISITOR_H_
 #define HESPERIA_SCENARIO_LANEVISITOR_H_
 
+#include <map>
+#include <string>
+
 #include "core/native.h"
 
 #include "core/wrapper/graph/DirectedGraph.h"
 #include "core/wrapper/graph/Edge.h"
 
 #include "hesperia/data/environment/NamedLine.h"
+#include "hesperia/data/scenario/Lane.h"
+#include "hesperia/data/scenario/PointID.h"
 #include "hesperia/data/scenario/PointModel.h"
 #include "hesperia/data/scenario/StraightLine.h"
 #include "hesperia/data/scenario/Arc.h"
 #include "hesperia/data/scenario/ScenarioVisitor.h"
 #include "hesperia/data/scenario/Scenario.h"
+#include "hesperia/scenario/FindNodeByPointIDVisitor.h"
 
 namespace hesperia {
     namespace scenario {
@@ -83,6 +89,19 @@ namespace hesperia {
                 // This vector contains all line between start and end points from lanes (arcs are approximated).
                 vector<hesperia::data::environment::NamedLine> m_listOfLines;
 
+                // Lanes by "layer.road.lane" to resolve connectors without visiting the whole scenario each time.
+                map<string, hesperia::data::scenario::Lane*> m_mapOfLanes;
+                bool m_hasCollectedLanes;
+
+                /**
+                 * This method lets the given visitor visit the lane
+                 * referred to by the given point ID.
+                 *
+                 * @param finder Visitor to find the point.
+                 * @param pointID Point to find.
+                 */
+                void find(FindNodeByPointIDVisitor &finder, const hesperia::data::scenario::PointID &pointID);
+
                 /**
                  * This method is called by the generic visit method.
                  *
@@ -24,12 +24,16 @@
 
 // native.h must be included as first header file for definition of _WIN32_WINNT.
 #include "core/native.h"
+#include "core/SharedPointer.h"
+#include "core/base/Mutex.h"
 #include "core/wrapper/DecompressedData.h"
 #include "core/wrapper/Image.h"
 
 #include "hesperia/data/scenario/ComplexModel.h"
 #include "hesperia/data/scenario/Scenario.h"
 #include "hesperia/data/situation/Situation.h"
+#include "hesperia/scenario/LaneIndex.h"
+#include "hesperia/scenario/SCNXArchiveCache.h"
 
 
 namespace hesperia {
@@ -41,7 +45,10 @@ namespace hesperia {
         class SCNXArchiveFactory;
 
         /**
-         * This class represents the contents of an SCNX archive.
+         * This class represents the contents of an SCNX archive. The
+         * aerial and height images as well as the lane index are created
+         * when they are requested for the first time and are shared by all
+         * consumers of this archive afterwards.
          */
         class OPENDAVINCI_API SCNXArchive {
             private:
@@ -73,8 +80,9 @@ namespace hesperia {
                  *
                  * @param scenario Scenario data structure.
                  * @param dd Decompressed contents of an SCNX archive.
+                 * @param cache Cache for the parsed situations.
                  */
-                SCNXArchive(const data::scenario::Scenario &scenario, core::wrapper::DecompressedData *dd);
+                SCNXArchive(const data::scenario::Scenario &scenario, core::wrapper::DecompressedData *dd, SCNXArchiveCache *cache);
 
             public:
                 virtual ~SCNXArchive();
@@ -100,6 +108,13 @@ namespace hesperia {
                  */
                 core::wrapper::Image* getHeightImage();
 
+                /**
+                 * This method returns the lane geometry of the scenario.
+                 *
+                 * @return Lane index.
+                 */
+                LaneIndex& getLaneIndex();
+
                 /**
                  * This method return the list of ground based complex models.
                  *
@@ -115,19 +130,34 @@ namespace hesperia {
                 vector<data::situation::Situation> getListOfSituations() const;
 
                 /**
-                 * This method returns the input stream
-                 * for reading the model data.
+                 * This method returns an input stream for reading the
+                 * model data. Every call returns a separate copy of the
+                 * data so that several consumers of this archive can read
+                 * the same model at the same time.
                  *
                  * @param modelFile Name of the model file.
-                 * @return Input stream to read the model data or NULL if the name could not be found.
+                 * @return Input stream to read the model data or an invalid pointer if the name could not be found.
                  */
-                istream* getModelData(const string &modelFile) const;
+                core::SharedPointer<istream> getModelData(const string &modelFile) const;
 
             private:
+                /**
+                 * This method decodes the given image from the archive.
+                 *
+                 * @param fileName Name of the image in the archive.
+                 * @return Image or NULL if the image could not be found.
+                 */
+                core::wrapper::Image* loadImage(const string &fileName);
+
                 data::scenario::Scenario m_scenario;
                 core::wrapper::DecompressedData *m_decompressedData;
+                SCNXArchiveCache *m_cache;
                 core::wrapper::Image *m_aerialImage;
                 core::wrapper::Image *m_heightImage;
+                bool m_hasLoadedAerialImage;
+                bool m_hasLoadedHeightImage;
+                LaneIndex *m_laneIndex;
+                mutable core::base::Mutex m_mutex;
         };
 
     }
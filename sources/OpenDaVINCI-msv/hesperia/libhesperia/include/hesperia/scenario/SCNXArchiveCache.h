@@ -0,0 +1,194 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_SCENARIO_SCNXARCHIVECACHE_H_
+#define HESPERIA_SCENARIO_SCNXARCHIVECACHE_H_
+
+#include <map>
+#include <string>
+
+// native.h must be included as first header file for definition of _WIN32_WINNT.
+#include "core/native.h"
+#include "core/base/Mutex.h"
+#include "core/wrapper/StringComparator.h"
+
+#include "hesperia/data/scenario/Scenario.h"
+#include "hesperia/data/situation/Situation.h"
+
+namespace hesperia {
+    namespace scenario {
+
+        using namespace std;
+
+        /**
+         * This class stores the serialized Scenario and Situation data
+         * structures of an SCNX archive in a binary file next to the
+         * archive. A process can then skip parsing the .scn and .sit
+         * files if they have not changed since the cache was written.
+         *
+         * Every entry is keyed by its name in the archive together
+         * with the length and a 64-bit FNV-1a hash of its text. The file also carries
+         * a format version. If the key or the version differs, the
+         * entry is treated as stale and the caller parses the text again.
+         */
+        class OPENDAVINCI_API SCNXArchiveCache {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                SCNXArchiveCache(const SCNXArchiveCache &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                SCNXArchiveCache& operator=(const SCNXArchiveCache &);
+
+            public:
+                /** Identifier at the beginning of every cache file. */
+                const static string MAGIC;
+
+                /** Version of the cache file's format; increase it whenever the serialization of the data structures changes. */
+                const static uint32_t VERSION;
+
+                /**
+                 * Constructor. An existing cache file is read immediately;
+                 * a missing, foreign or outdated file results in an empty cache.
+                 *
+                 * @param fileName Name of the cache file.
+                 */
+                SCNXArchiveCache(const string &fileName);
+
+                virtual ~SCNXArchiveCache();
+
+                /**
+                 * This method returns the name of the cache file
+                 * belonging to the given SCNX archive.
+                 *
+                 * @param archiveFileName Name of the SCNX archive.
+                 * @return Name of the cache file.
+                 */
+                static const string getCacheFileNameFor(const string &archiveFileName);
+
+                /**
+                 * This method returns the cached scenario for the given entry.
+                 *
+                 * @param entry Name of the entry in the archive.
+                 * @param source Text of the entry.
+                 * @param scenario Scenario to be filled.
+                 * @return true if an up-to-date scenario was found in the cache.
+                 */
+                bool getScenario(const string &entry, const string &source, data::scenario::Scenario &scenario);
+
+                /**
+                 * This method stores the parsed scenario for the given entry.
+                 *
+                 * @param entry Name of the entry in the archive.
+                 * @param source Text of the entry.
+                 * @param scenario Scenario parsed from the text.
+                 */
+                void putScenario(const string &entry, const string &source, const data::scenario::Scenario &scenario);
+
+                /**
+                 * This method returns the cached situation for the given entry.
+                 *
+                 * @param entry Name of the entry in the archive.
+                 * @param source Text of the entry.
+                 * @param situation Situation to be filled.
+                 * @return true if an up-to-date situation was found in the cache.
+                 */
+                bool getSituation(const string &entry, const string &source, data::situation::Situation &situation);
+
+                /**
+                 * This method stores the parsed situation for the given entry.
+                 *
+                 * @param entry Name of the entry in the archive.
+                 * @param source Text of the entry.
+                 * @param situation Situation parsed from the text.
+                 */
+                void putSituation(const string &entry, const string &source, const data::situation::Situation &situation);
+
+                /**
+                 * This method writes the cache file if entries were
+                 * added since it was read. The file is replaced
+                 * atomically where the platform allows it so that
+                 * concurrently starting processes never read a
+                 * partially written cache.
+                 */
+                void save();
+
+            private:
+                /**
+                 * This class describes one cached entry.
+                 */
+                class CacheEntry {
+                    public:
+                        CacheEntry();
+
+                        uint64_t m_length;
+                        uint64_t m_hash;
+                        string m_data;
+                };
+
+                /**
+                 * This method computes the 64-bit FNV-1a hash of the given text.
+                 *
+                 * @param source Text to hash.
+                 * @return Hash.
+                 */
+                static uint64_t getHash(const string &source);
+
+                /**
+                 * This method returns the serialized data for
+                 * the given entry if it is up-to-date.
+                 *
+                 * @param entry Name of the entry in the archive.
+                 * @param source Text of the entry.
+                 * @param data Serialized data.
+                 * @return true if the entry is up-to-date.
+                 */
+                bool find(const string &entry, const string &source, string &data);
+
+                /**
+                 * This method stores serialized data for the given entry.
+                 *
+                 * @param entry Name of the entry in the archive.
+                 * @param source Text of the entry.
+                 * @param data Serialized data.
+                 */
+                void store(const string &entry, const string &source, const string &data);
+
+                /**
+                 * This method reads the cache file.
+                 */
+                void load();
+
+                core::base::Mutex m_mutex;
+                string m_fileName;
+                map<string, CacheEntry, core::wrapper::StringComparator> m_mapOfEntries;
+                bool m_modified;
+        };
+
+    }
+} // hesperia::scenario
+
+#endif /*HESPERIA_SCENARIO_SCNXARCHIVECACHE_H_*/
@@ -84,6 +84,7 @@ namespace hesperia {
                 static core::base::Mutex m_singletonMutex;
                 static SCNXArchiveFactory* m_singleton;
 
+                core::base::Mutex m_mutex;
                 map<string, SCNXArchive*, core::wrapper::StringComparator> m_mapOfSCNXArchives;
         };
 
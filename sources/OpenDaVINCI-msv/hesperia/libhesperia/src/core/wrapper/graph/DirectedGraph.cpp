@@ -17,11 +17,12 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <queue>
 #include <sstream>
 
-#include <boost/graph/astar_search.hpp>
-
 #include "core/macros.h"
 #include "core/wrapper/graph/DirectedGraph.h"
 
@@ -31,7 +32,7 @@ namespace core {
 
             // Euclidean Distances, see: http://www.cs.rpi.edu/~beevek/research/astar_bgl04.pdf
             template<class Graph, class EdgeWeight>
-            class DistanceHeuristic : public boost::astar_heuristic<Graph, EdgeWeight> {
+            class DistanceHeuristic {
                 public:
                     typedef typename boost::graph_traits<Graph>::vertex_descriptor Vertex;
 
@@ -44,8 +45,8 @@ namespace core {
                         if ( (m_graph[m_goal] != NULL) && (m_graph[u] != NULL) ) {
                             value = m_graph[m_goal]->getDistanceTo(*(m_graph[u]));
                         }
-                        cerr << "Value = " << value << endl;
-                        return value;
+                        // Invalid vertices must not be preferred.
+                        return (value > 0) ? value : 0;
                     }
 
                 private:
@@ -53,35 +54,18 @@ namespace core {
                     Vertex m_goal;
             };
 
-            // This class is thrown as exception if the goal was found.
-            struct found_goal {};
-
-            // This class is used as visitor to find the goal.
-            template <class Vertex>
-            class AStarGoalVisitor : public boost::default_astar_visitor {
-                public:
-                    AStarGoalVisitor(Vertex goal) :
-                        m_goal(goal) {}
-
-                    template <class Graph>
-                    void examine_vertex(Vertex u, Graph &/*g*/) {
-                        if (u == m_goal) {
-                            throw found_goal();
-                        }
-                    }
-
-                private:
-                    Vertex m_goal;
-            };
-
             ////////////////////////////////////////////////////////////////////
 
+            const uint32_t DirectedGraph::MAXIMUM_NUMBER_OF_CACHED_ROUTES = 32;
+
             DirectedGraph::DirectedGraph() :
                 m_graph(),
                 m_weightMap(),
                 m_mapOfVertices(),
                 m_listOfVertices(),
-                m_listOfEdges() {}
+                m_listOfEdges(),
+                m_cachedRoutes(),
+                m_mapOfCachedRoutes() {}
 
             DirectedGraph::~DirectedGraph() {
                 // Delete all vertices.
@@ -111,6 +95,9 @@ namespace core {
 
                     // Actually add vertex to graph.
                     m_graph[vertex] = v;
+
+                    // Cached routes might not be the shortest ones anymore.
+                    clearCachedRoutes();
                 }
             }
 
@@ -134,6 +121,9 @@ namespace core {
                     boost::tie(edge, found) = boost::add_edge(vertex1, vertex2, m_graph);
                     m_weightMap[edge] = e->getCosts();
 
+                    // Cached routes might not be the shortest ones anymore.
+                    clearCachedRoutes();
+
                     clog << "Edge " << e->toString() << " between " << v1->toString() << " and " << v2->toString() << " added to graph." << endl;
                 }
             }
@@ -153,41 +143,107 @@ namespace core {
             vector<const Vertex*> DirectedGraph::getShortestPath(const Vertex &v1, const Vertex &v2) {
                 vector<const Vertex*> route;
                 if (hasVertex(v1) && hasVertex(v2)) {
-                    clog << "Getting route from " << v1.toString() << " to " << v2.toString() << endl;
+                    const RouteKey key(v1.getIdentifier(), v2.getIdentifier());
+
+                    map<RouteKey, ListOfRoutes::iterator>::iterator it = m_mapOfCachedRoutes.find(key);
+                    if (it != m_mapOfCachedRoutes.end()) {
+                        // Mark the cached route as most recently used.
+                        m_cachedRoutes.splice(m_cachedRoutes.begin(), m_cachedRoutes, it->second);
+                        route = it->second->second;
+                    }
+                    else {
+                        clog << "Getting route from " << v1.toString() << " to " << v2.toString() << endl;
+
+                        computeShortestPath(m_mapOfVertices[v1.getIdentifier()], m_mapOfVertices[v2.getIdentifier()], route);
+
+                        // Unreachable vertices are cached as well.
+                        m_cachedRoutes.push_front(make_pair(key, route));
+                        m_mapOfCachedRoutes[key] = m_cachedRoutes.begin();
 
-                    GraphDefinition::vertex_descriptor start = m_mapOfVertices[v1.getIdentifier()];
-                    GraphDefinition::vertex_descriptor end = m_mapOfVertices[v2.getIdentifier()];
+                        // Remove the least recently used route.
+                        if (m_mapOfCachedRoutes.size() > MAXIMUM_NUMBER_OF_CACHED_ROUTES) {
+                            m_mapOfCachedRoutes.erase(m_cachedRoutes.back().first);
+                            m_cachedRoutes.pop_back();
+                        }
+                    }
+                }
+                return route;
+            }
+
+            uint32_t DirectedGraph::getNumberOfCachedRoutes() const {
+                return m_mapOfCachedRoutes.size();
+            }
+
+            void DirectedGraph::clearCachedRoutes() {
+                m_cachedRoutes.clear();
+                m_mapOfCachedRoutes.clear();
+            }
+
+            void DirectedGraph::computeShortestPath(const GraphDefinition::vertex_descriptor &start, const GraphDefinition::vertex_descriptor &end, vector<const Vertex*> &route) {
+                typedef GraphDefinition::vertex_descriptor VertexDescriptor;
+                typedef pair<double, VertexDescriptor> Candidate; // Estimated costs via the vertex and the vertex.
 
-                    vector<GraphDefinition::vertex_descriptor> p(boost::num_vertices(m_graph));
-                    vector<double> d(boost::num_vertices(m_graph));
+                const uint32_t numberOfVertices = boost::num_vertices(m_graph);
+                vector<VertexDescriptor> p(numberOfVertices);
+                vector<double> d(numberOfVertices, numeric_limits<double>::max());
+                vector<bool> examined(numberOfVertices, false);
 
-                    try {
-                        // Call A* algorithm.
-                        boost::astar_search(m_graph, start,
-                                          DistanceHeuristic<GraphDefinition, double>(m_graph, end),
-                                          boost::predecessor_map(&p[0]).distance_map(&d[0]).visitor(AStarGoalVisitor<GraphDefinition::vertex_descriptor>(end)));
+                DistanceHeuristic<GraphDefinition, double> heuristic(m_graph, end);
+
+                // Vertices to be examined ordered by their estimated costs.
+                priority_queue<Candidate, vector<Candidate>, greater<Candidate> > candidates;
+
+                p[start] = start;
+                d[start] = 0;
+                candidates.push(Candidate(heuristic(start), start));
+
+                bool foundGoal = false;
+                while (!candidates.empty() && !foundGoal) {
+                    const VertexDescriptor u = candidates.top().second;
+                    candidates.pop();
+
+                    // Skip outdated candidates for vertices which have been examined already.
+                    if (examined[u]) {
+                        continue;
                     }
-                    catch(found_goal &/*fg*/) {
-                        // An exception is thrown if end was found.
-                        list<GraphDefinition::vertex_descriptor> path;
-                        for (GraphDefinition::vertex_descriptor v = end; ; v = p[v]) {
-                            path.push_front(v);
-                            if (v == p[v]) {
-                                break;
-                            }
+                    examined[u] = true;
+
+                    // Stop as soon as the goal is examined; its costs are final.
+                    foundGoal = (u == end);
+
+                    boost::graph_traits<GraphDefinition>::out_edge_iterator ei, ei_end;
+                    for(boost::tie(ei, ei_end) = boost::out_edges(u, m_graph); (ei != ei_end) && !foundGoal; ei++) {
+                        const VertexDescriptor v = boost::target(*ei, m_graph);
+                        const double costs = d[u] + m_weightMap[*ei];
+
+                        if (costs < d[v]) {
+                            // Cheaper path to v found; re-examine v if necessary.
+                            d[v] = costs;
+                            p[v] = u;
+                            examined[v] = false;
+                            candidates.push(Candidate(costs + heuristic(v), v));
                         }
+                    }
+                }
 
-                        list<GraphDefinition::vertex_descriptor>::iterator it = path.begin();
-                        stringstream sstr;
-                        while (it != path.end()) {
-                            route.push_back(m_graph[*it]);
-                            sstr << m_graph[*it]->toString() << " ";
-                            it++;
+                if (foundGoal) {
+                    list<VertexDescriptor> path;
+                    for (VertexDescriptor v = end; ; v = p[v]) {
+                        path.push_front(v);
+                        if (v == p[v]) {
+                            break;
                         }
-                        cout << "Route: " << sstr.str() << endl;
                     }
+
+                    list<VertexDescriptor>::iterator it = path.begin();
+                    stringstream sstr;
+                    while (it != path.end()) {
+                        route.push_back(m_graph[*it]);
+                        sstr << m_graph[*it]->toString() << " ";
+                        it++;
+                    }
+                    cout << "Route: " << sstr.str() << endl;
                 }
-                return route;
             }
         }
     }
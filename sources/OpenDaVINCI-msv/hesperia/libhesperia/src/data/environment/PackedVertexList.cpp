@@ -0,0 +1,113 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <cstring>
+#include <sstream>
+
+#include "core/base/Hash.h"
+
+#include "hesperia/data/environment/PackedVertexList.h"
+
+namespace hesperia {
+    namespace data {
+        namespace environment {
+
+            using namespace std;
+            using namespace core::base;
+            using namespace core::data::environment;
+
+            void PackedVertexList::write(Serializer &s, const uint32_t &numberOfVerticesID, const uint32_t &verticesID, const vector<Point3> &listOfVertices) {
+                // Write number of vertices.
+                uint32_t numberOfVertices = static_cast<uint32_t>(listOfVertices.size());
+                s.write(numberOfVerticesID, numberOfVertices);
+
+                uint32_t version = PACKED;
+                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL7('v', 'e', 'r', 's', 'i', 'o', 'n') >::RESULT,
+                        version);
+
+                // Write all coordinates as one block; its length lets the reader validate the number of vertices.
+                if (numberOfVertices > 0) {
+                    vector<double> coordinates;
+                    coordinates.reserve(3 * numberOfVertices);
+                    vector<Point3>::const_iterator it = listOfVertices.begin();
+                    while (it != listOfVertices.end()) {
+                        coordinates.push_back(Serializer::htond(it->getX()));
+                        coordinates.push_back(Serializer::htond(it->getY()));
+                        coordinates.push_back(Serializer::htond(it->getZ()));
+                        it++;
+                    }
+
+                    s.write(verticesID, string(reinterpret_cast<const char*>(&coordinates[0]), coordinates.size() * sizeof(double)));
+                }
+            }
+
+            bool PackedVertexList::read(Deserializer &d, const uint32_t &numberOfVerticesID, const uint32_t &verticesID, vector<Point3> &listOfVertices) {
+                // Read number of vertices.
+                uint32_t numberOfVertices = 0;
+                d.read(numberOfVerticesID, numberOfVertices);
+
+                if (numberOfVertices == 0) {
+                    return true;
+                }
+
+                // Data written before the version field was introduced uses the nested layout.
+                uint32_t version = NESTED;
+                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL7('v', 'e', 'r', 's', 'i', 'o', 'n') >::RESULT,
+                       version);
+
+                // Read string of vertices.
+                string vertices;
+                d.read(verticesID, vertices);
+
+                if (version == PACKED) {
+                    // The number of vertices must not be trusted before it is checked against the stored coordinates.
+                    const uint32_t SIZE_OF_VERTEX = 3 * sizeof(double);
+                    if ( ((vertices.size() % SIZE_OF_VERTEX) != 0) || ((vertices.size() / SIZE_OF_VERTEX) != numberOfVertices) ) {
+                        return false;
+                    }
+
+                    listOfVertices.reserve(listOfVertices.size() + numberOfVertices);
+
+                    const char *coordinates = vertices.data();
+                    for (uint32_t i = 0; i < numberOfVertices; i++) {
+                        double xyz[3];
+                        ::memcpy(xyz, coordinates + i * SIZE_OF_VERTEX, SIZE_OF_VERTEX);
+                        listOfVertices.push_back(Point3(Deserializer::ntohd(xyz[0]),
+                                                        Deserializer::ntohd(xyz[1]),
+                                                        Deserializer::ntohd(xyz[2])));
+                    }
+                }
+                else {
+                    stringstream sstr(vertices);
+
+                    // Read actual vertices from stringstream but not beyond its end.
+                    for (uint32_t i = 0; (i < numberOfVertices) && sstr.good(); i++) {
+                        Point3 p;
+                        sstr >> p;
+                        listOfVertices.push_back(p);
+                    }
+                }
+
+                return true;
+            }
+
+        }
+    }
+} // hesperia::data::environment
@@ -19,14 +19,16 @@
 
 #include <cmath>
 #include <algorithm>
+#include <limits>
 #include <sstream>
+#include <utility>
 
 #include "core/base/Hash.h"
 #include "core/base/Deserializer.h"
 #include "core/base/SerializationFactory.h"
 #include "core/base/Serializer.h"
 
-#include "hesperia/data/environment/Line.h"
+#include "hesperia/data/environment/PackedVertexList.h"
 #include "hesperia/data/environment/Polygon.h"
 
 namespace hesperia {
@@ -39,16 +41,107 @@ namespace hesperia {
 
             const double Polygon::EPSILON = 1e-10;
 
+            const double Polygon::SEPARATION = 1e-6;
+
+            /**
+             * This function intersects the edge A-B with the edge C-D
+             * ignoring the Z coordinate.
+             *
+             * @param ax X coordinate of A.
+             * @param ay Y coordinate of A.
+             * @param bx X coordinate of B.
+             * @param by Y coordinate of B.
+             * @param cx X coordinate of C.
+             * @param cy Y coordinate of C.
+             * @param dx X coordinate of D.
+             * @param dy Y coordinate of D.
+             * @param x X coordinate of the intersection point.
+             * @param y Y coordinate of the intersection point.
+             * @return true, if both edges intersect.
+             */
+            static bool intersectEdgesIgnoreZ(const double &ax, const double &ay, const double &bx, const double &by,
+                                              const double &cx, const double &cy, const double &dx, const double &dy,
+                                              double &x, double &y) {
+                const double EPSILON = 1e-10;
+
+                // Intersect both lines using homogeneous coordinates.
+                const double line1X = ay - by;
+                const double line1Y = bx - ax;
+                const double line1Z = ax * by - ay * bx;
+                const double line2X = cy - dy;
+                const double line2Y = dx - cx;
+                const double line2Z = cx * dy - cy * dx;
+
+                const double resultZ = line1X * line2Y - line1Y * line2X;
+                if (fabs(resultZ) < EPSILON) {
+                    // Parallel lines.
+                    return false;
+                }
+
+                // C and D must be on different sides of the line through A and B.
+                const double thisDX = bx - ax;
+                const double thisDY = by - ay;
+                const double det_c = (cx - ax) * thisDY - (cy - ay) * thisDX;
+                const double det_d = (dx - ax) * thisDY - (dy - ay) * thisDX;
+
+                bool retVal = false;
+                if ( (-1 * det_c > EPSILON && det_d > EPSILON) || (det_c > EPSILON && -1 * det_d > EPSILON) ) {
+                    retVal = true;
+                }
+                else if (fabs(det_c) < EPSILON) {
+                    // C-D is degenerated to a point on the line through A and B.
+                    retVal = ( (fabs(det_d) < EPSILON) || ((fabs(dx - cx) < EPSILON) && (fabs(dy - cy) < EPSILON)) );
+                }
+                else if (fabs(det_d) < EPSILON) {
+                    // A-B is degenerated to a point.
+                    retVal = ( (fabs(thisDX) < EPSILON) && (fabs(thisDY) < EPSILON) );
+                }
+
+                if (retVal) {
+                    // A and B must not be on the same side of the line through C and D.
+                    const double otherDX = dx - cx;
+                    const double otherDY = dy - cy;
+                    const double det_a = (ax - cx) * otherDY - (ay - cy) * otherDX;
+                    const double det_b = (bx - cx) * otherDY - (by - cy) * otherDX;
+                    if ( (det_a > EPSILON && det_b > EPSILON) || (det_a < -EPSILON && det_b < -EPSILON) ) {
+                        return false;
+                    }
+
+                    const double inverse = 1 / resultZ;
+                    x = (line1Y * line2Z - line1Z * line2Y) * inverse;
+                    y = (line1Z * line2X - line1X * line2Z) * inverse;
+                }
+
+                return retVal;
+            }
+
             Polygon::Polygon() :
-                m_listOfVertices() {}
+                m_listOfVertices(),
+                m_coordinatesXY(),
+                m_minX(0),
+                m_minY(0),
+                m_maxX(0),
+                m_maxY(0) {
+                updateCoordinates();
+            }
 
             Polygon::Polygon(const vector<Point3> &vertices) :
-                m_listOfVertices(vertices) {
+                m_listOfVertices(vertices),
+                m_coordinatesXY(),
+                m_minX(0),
+                m_minY(0),
+                m_maxX(0),
+                m_maxY(0) {
                 sort();            
             }
 
             Polygon::Polygon(const Polygon &obj) :
-                m_listOfVertices(obj.m_listOfVertices) {
+                m_listOfVertices(obj.m_listOfVertices),
+                m_coordinatesXY(),
+                m_minX(0),
+                m_minY(0),
+                m_maxX(0),
+                m_maxY(0) {
                 sort();            
             }
 
@@ -61,8 +154,41 @@ namespace hesperia {
                 return (*this);
             }
 
+            void Polygon::updateCoordinates() {
+                m_coordinatesXY.clear();
+                m_coordinatesXY.reserve(2 * m_listOfVertices.size());
+
+                // An empty polygon's bounding box does not overlap with anything.
+                m_minX = m_minY = numeric_limits<double>::max();
+                m_maxX = m_maxY = -numeric_limits<double>::max();
+
+                vector<Point3>::const_iterator it = m_listOfVertices.begin();
+                while (it != m_listOfVertices.end()) {
+                    const double x = it->getX();
+                    const double y = it->getY();
+                    m_coordinatesXY.push_back(x);
+                    m_coordinatesXY.push_back(y);
+
+                    m_minX = (x < m_minX) ? x : m_minX;
+                    m_minY = (y < m_minY) ? y : m_minY;
+                    m_maxX = (x > m_maxX) ? x : m_maxX;
+                    m_maxY = (y > m_maxY) ? y : m_maxY;
+                    it++;
+                }
+            }
+
             void Polygon::add(const Point3 &p) {
                 m_listOfVertices.push_back(p);
+
+                const double x = p.getX();
+                const double y = p.getY();
+                m_coordinatesXY.push_back(x);
+                m_coordinatesXY.push_back(y);
+
+                m_minX = (x < m_minX) ? x : m_minX;
+                m_minY = (y < m_minY) ? y : m_minY;
+                m_maxX = (x > m_maxX) ? x : m_maxX;
+                m_maxY = (y > m_maxY) ? y : m_maxY;
             }
 
             uint32_t Polygon::getSize() const {
@@ -74,44 +200,56 @@ namespace hesperia {
             }
 
             bool Polygon::containsIgnoreZ(const Point3 &p) const {
+                return containsIgnoreZ(p.getX(), p.getY());
+            }
+
+            bool Polygon::containsIgnoreZ(const double &x, const double &y) const {
                 // http://rw7.de/ralf/inffaq/polygon.html
                 bool retVal = false;
 
-                if (getSize() > 0) {
-                    Point3 oldPoint = m_listOfVertices.back();
-                    Point3 currentPoint;
+                // Points outside the bounding box have a winding number of zero.
+                if ( (x < m_minX - Polygon::EPSILON) || (x > m_maxX + Polygon::EPSILON) ||
+                     (y < m_minY - Polygon::EPSILON) || (y > m_maxY + Polygon::EPSILON) ) {
+                    return false;
+                }
+
+                const uint32_t size = getSize();
+                if (size > 0) {
+                    double oldX = m_coordinatesXY[2 * (size - 1)];
+                    double oldY = m_coordinatesXY[2 * (size - 1) + 1];
 
                     int32_t alpha = 0;
                     int32_t quadrant = 0;
                     int32_t currentQuadrant = 0;
 
-                    if ( (oldPoint.getY() < p.getY()) || (oldPoint.getY() - p.getY() < Polygon::EPSILON) ) {
-                        if ( (oldPoint.getX() < p.getX()) || (oldPoint.getX() - p.getX() < Polygon::EPSILON) ) {
+                    if ( (oldY < y) || (oldY - y < Polygon::EPSILON) ) {
+                        if ( (oldX < x) || (oldX - x < Polygon::EPSILON) ) {
                             quadrant = 0;
                         }
                         else {
                             quadrant = 1;
                         }
                     }
-                    else if ( (oldPoint.getX() <= p.getX()) || (oldPoint.getX() - p.getX() < Polygon::EPSILON) ) {
+                    else if ( (oldX <= x) || (oldX - x < Polygon::EPSILON) ) {
                         quadrant = 3;
                     }
                     else {
                         quadrant = 2;
                     }
 
-                    for(uint32_t i = 0; i < getSize(); i++) {
-                        currentPoint = m_listOfVertices.at(i);
+                    for(uint32_t i = 0; i < size; i++) {
+                        const double currentX = m_coordinatesXY[2 * i];
+                        const double currentY = m_coordinatesXY[2 * i + 1];
 
-                        if ( (currentPoint.getY() < p.getY()) || (currentPoint.getY() - p.getY() < Polygon::EPSILON) ) {
-                            if ( (currentPoint.getX() < p.getX()) || (currentPoint.getX() - p.getX() < Polygon::EPSILON) ) {
+                        if ( (currentY < y) || (currentY - y < Polygon::EPSILON) ) {
+                            if ( (currentX < x) || (currentX - x < Polygon::EPSILON) ) {
                                 currentQuadrant = 0;
                             }
                             else {
                                 currentQuadrant = 1;
                             }
                         }
-                        else if ( (currentPoint.getX() < p.getX()) || (currentPoint.getX() - p.getX() < Polygon::EPSILON) ) {
+                        else if ( (currentX < x) || (currentX - x < Polygon::EPSILON) ) {
                             currentQuadrant = 3;
                         }
                         else {
@@ -128,16 +266,16 @@ namespace hesperia {
                                 alpha--;
                             break;
                             default: {
-                                const double nominator = (currentPoint.getX() - oldPoint.getX()) * (p.getY() - oldPoint.getY());
-                                const double denominator = (currentPoint.getY() - oldPoint.getY());
+                                const double nominator = (currentX - oldX) * (y - oldY);
+                                const double denominator = (currentY - oldY);
                                 if (fabs(denominator) > Polygon::EPSILON) {
-                                    const double value = nominator / denominator + oldPoint.getX();
+                                    const double value = nominator / denominator + oldX;
 
-                                    if (fabs(p.getX() - value) < Polygon::EPSILON) {
+                                    if (fabs(x - value) < Polygon::EPSILON) {
                                         return false;
                                     }
 
-                                    if ( (p.getX() > value) == (currentPoint.getY() > oldPoint.getY()) ) {
+                                    if ( (x > value) == (currentY > oldY) ) {
                                         alpha -= 2;
                                     }
                                     else {
@@ -147,7 +285,8 @@ namespace hesperia {
                             }
                         }
 
-                        oldPoint = currentPoint;
+                        oldX = currentX;
+                        oldY = currentY;
                         quadrant = currentQuadrant;
                     }
 
@@ -157,6 +296,73 @@ namespace hesperia {
                 return retVal;
             }
 
+            bool Polygon::overlapsBoundingBoxIgnoreZ(const Polygon &other) const {
+                return ( (m_minX <= other.m_maxX + Polygon::SEPARATION) && (other.m_minX <= m_maxX + Polygon::SEPARATION) &&
+                         (m_minY <= other.m_maxY + Polygon::SEPARATION) && (other.m_minY <= m_maxY + Polygon::SEPARATION) );
+            }
+
+            bool Polygon::isConvexIgnoreZ() const {
+                const uint32_t size = getSize();
+                if (size < 3) {
+                    return false;
+                }
+
+                // All turns between consecutive edges must have the same direction.
+                bool hasLeftTurn = false;
+                bool hasRightTurn = false;
+                for(uint32_t i = 0; i < size; i++) {
+                    const uint32_t j = (i + 1) % size;
+                    const uint32_t k = (i + 2) % size;
+                    const double cross = (m_coordinatesXY[2 * j] - m_coordinatesXY[2 * i]) * (m_coordinatesXY[2 * k + 1] - m_coordinatesXY[2 * j + 1]) -
+                                         (m_coordinatesXY[2 * j + 1] - m_coordinatesXY[2 * i + 1]) * (m_coordinatesXY[2 * k] - m_coordinatesXY[2 * j]);
+                    hasLeftTurn |= (cross > Polygon::EPSILON);
+                    hasRightTurn |= (cross < -Polygon::EPSILON);
+                }
+
+                return (hasLeftTurn != hasRightTurn);
+            }
+
+            bool Polygon::isSeparatedIgnoreZ(const Polygon &other) const {
+                const Polygon *polygons[2] = { this, &other };
+
+                for(uint32_t p = 0; p < 2; p++) {
+                    const vector<double> &coordinates = polygons[p]->m_coordinatesXY;
+                    const uint32_t size = polygons[p]->getSize();
+
+                    for(uint32_t i = 0; i < size; i++) {
+                        const uint32_t j = (i + 1) % size;
+
+                        // Normal of the edge i-j.
+                        double axisX = coordinates[2 * i + 1] - coordinates[2 * j + 1];
+                        double axisY = coordinates[2 * j] - coordinates[2 * i];
+                        const double length = sqrt(axisX * axisX + axisY * axisY);
+                        if (length < Polygon::EPSILON) {
+                            continue;
+                        }
+                        axisX /= length;
+                        axisY /= length;
+
+                        // Project both polygons onto the axis.
+                        double minimum[2] = { numeric_limits<double>::max(), numeric_limits<double>::max() };
+                        double maximum[2] = { -numeric_limits<double>::max(), -numeric_limits<double>::max() };
+                        for(uint32_t q = 0; q < 2; q++) {
+                            const vector<double> &projected = polygons[q]->m_coordinatesXY;
+                            for(uint32_t k = 0; k < projected.size(); k += 2) {
+                                const double d = projected[k] * axisX + projected[k + 1] * axisY;
+                                minimum[q] = (d < minimum[q]) ? d : minimum[q];
+                                maximum[q] = (d > maximum[q]) ? d : maximum[q];
+                            }
+                        }
+
+                        if ( (maximum[0] + Polygon::SEPARATION < minimum[1]) || (maximum[1] + Polygon::SEPARATION < minimum[0]) ) {
+                            return true;
+                        }
+                    }
+                }
+
+                return false;
+            }
+
             Polygon Polygon::intersectIgnoreZ(const Polygon &other) const {
                 // Algorithm:
                 // For every pair<Vertex, Vertex> from other determine the intersection point P with every pair<Vertex, Vertex> from this.
@@ -165,38 +371,43 @@ namespace hesperia {
 
                 Polygon resultingPolygon;
 
-                vector<Point3> thisPolygon = getVertices();
-                vector<Point3> otherPolygon = other.getVertices();
+                const uint32_t thisSize = getSize();
+                const uint32_t otherSize = other.getSize();
+
+                if ( (thisSize > 0) && (otherSize > 0) ) {
+                    // Polygons with disjoint bounding boxes or convex polygons with a separating axis cannot overlap.
+                    if (!overlapsBoundingBoxIgnoreZ(other)) {
+                        return resultingPolygon;
+                    }
+                    if (isConvexIgnoreZ() && other.isConvexIgnoreZ() && isSeparatedIgnoreZ(other)) {
+                        return resultingPolygon;
+                    }
 
-                if ( (thisPolygon.size() > 0) && (otherPolygon.size() > 0) ) {
-                    // Modify vertices by adding the first vertex at the end of both lists for closing the polygon.
-                    thisPolygon.push_back((*thisPolygon.begin()));
-                    otherPolygon.push_back((*otherPolygon.begin()));
+                    const vector<double> &thisXY = m_coordinatesXY;
+                    const vector<double> &otherXY = other.m_coordinatesXY;
 
-                    for(uint32_t i = 0; i < thisPolygon.size() - 1; i++) {
-                        Point3 thisA = thisPolygon.at(i);
-                        Point3 thisB = thisPolygon.at(i+1);
-                        Line thisLine(thisA, thisB);
+                    for(uint32_t i = 0; i < thisSize; i++) {
+                        // The last edge closes the polygon.
+                        const uint32_t nextI = (i + 1) % thisSize;
 
-                        for(uint32_t j = 0; j < otherPolygon.size() - 1; j++) {
-                            Point3 otherA = otherPolygon.at(j);
-                            Point3 otherB = otherPolygon.at(j+1);
-                            Line otherLine(otherA, otherB);
+                        for(uint32_t j = 0; j < otherSize; j++) {
+                            const uint32_t nextJ = (j + 1) % otherSize;
 
-                            Point3 result;
-                            if (thisLine.intersectIgnoreZ(otherLine, result)) {
+                            double x = 0;
+                            double y = 0;
+                            if (intersectEdgesIgnoreZ(thisXY[2 * i], thisXY[2 * i + 1], thisXY[2 * nextI], thisXY[2 * nextI + 1],
+                                                      otherXY[2 * j], otherXY[2 * j + 1], otherXY[2 * nextJ], otherXY[2 * nextJ + 1],
+                                                      x, y)) {
                                 // Intersection point found.
-                                resultingPolygon.add(result);
+                                resultingPolygon.add(Point3(x, y, 0));
                             }
                         }
                     }
 
                     // Now, check if one vertex from other is within this polygon.
-                    for(uint32_t j = 0; j < otherPolygon.size()-1; j++) {
-                        Point3 otherVertex = otherPolygon.at(j);
-
-                        if (containsIgnoreZ(otherVertex)) {
-                            resultingPolygon.add(otherVertex);
+                    for(uint32_t j = 0; j < otherSize; j++) {
+                        if (containsIgnoreZ(otherXY[2 * j], otherXY[2 * j + 1])) {
+                            resultingPolygon.add(other.m_listOfVertices[j]);
                         }
                     }
 
@@ -207,30 +418,31 @@ namespace hesperia {
                 return resultingPolygon;
             }
 
-            /**
-             * This class can be used to sort lines by angle.
-             */
-            class AngleXYComparator {
-                public:
-                    /**
-                     * Constructor.
-                     *
-                     * @param point Point to be used for sorting.
-                     */
-                    AngleXYComparator(const Point3 &point) :
-                        m_point(point) {}
-
-                    bool operator()(const Point3 &p1, const Point3 &p2) {
-                        return ((p1-m_point).getAngleXY() < (p2-m_point).getAngleXY());
+            void Polygon::sort() {
+                updateCoordinates();
+
+                const uint32_t size = getSize();
+                if (size > 1) {
+                    // Compute every vertex's angle around the center only once.
+                    const double centerX = (m_minX + m_maxX) * 0.5;
+                    const double centerY = (m_minY + m_maxY) * 0.5;
+
+                    vector<pair<double, uint32_t> > angles;
+                    angles.reserve(size);
+                    for(uint32_t i = 0; i < size; i++) {
+                        angles.push_back(make_pair(atan2(m_coordinatesXY[2 * i + 1] - centerY, m_coordinatesXY[2 * i] - centerX), i));
                     }
+                    std::sort(angles.begin(), angles.end());
 
-                private:
-                    Point3 m_point;
-            };
+                    vector<Point3> sortedVertices;
+                    sortedVertices.reserve(size);
+                    for(uint32_t i = 0; i < size; i++) {
+                        sortedVertices.push_back(m_listOfVertices[angles[i].second]);
+                    }
+                    m_listOfVertices.swap(sortedVertices);
 
-            void Polygon::sort() {
-                AngleXYComparator angleXYComparator(getCenter());
-                std::sort(m_listOfVertices.begin(), m_listOfVertices.end(), angleXYComparator);
+                    updateCoordinates();
+                }
             }
 
             Polygon Polygon::getVisiblePolygonIgnoreZ(const Point3 &point) const {
@@ -242,47 +454,45 @@ namespace hesperia {
                 //    If no such point exists, the vertex is directly visible.
                 Polygon contour;
 
-                vector<Point3> thisPolygon = getVertices();
-
-                if (thisPolygon.size() > 0) {
+                const uint32_t size = getSize();
+                if (size > 0) {
                     vector<Point3> resultingVertices;
 
-                    // Add the first vertex to the end to close the polygon.
-                    vector<Point3> thisPolygonCyclic = getVertices();
-                    thisPolygonCyclic.push_back((*thisPolygonCyclic.begin()));
+                    const double pointX = point.getX();
+                    const double pointY = point.getY();
 
-                    for(uint32_t i = 0; i < thisPolygon.size(); i++) {
-                        Point3 thisA = thisPolygon.at(i);
-                        Line viewingPositionLine(point, thisA);
+                    for(uint32_t i = 0; i < size; i++) {
+                        const double thisAX = m_coordinatesXY[2 * i];
+                        const double thisAY = m_coordinatesXY[2 * i + 1];
 
-                        // ALL sides of the other polygon must be tested.
+                        // ALL sides of the other polygon must be tested until one hides the vertex.
                         bool thisACanBeSeenDirectly = true;
-                        for(uint32_t j = 0; j < thisPolygonCyclic.size() - 1; j++) {
+                        for(uint32_t j = 0; (j < size) && thisACanBeSeenDirectly; j++) {
                             // Skip the vertex to be checked itself.
                             if ((i == j) || (i == j+1)) {
                                 continue;
                             }
 
-                            Point3 thisPolygonA = thisPolygonCyclic.at(j);
-                            Point3 thisPolygonB = thisPolygonCyclic.at(j+1);
-                            Line thisPolygonLine(thisPolygonA, thisPolygonB);
+                            // The last side closes the polygon.
+                            const uint32_t nextJ = (j + 1) % size;
 
-                            Point3 result;
-                            if (viewingPositionLine.intersectIgnoreZ(thisPolygonLine, result)) {
-                                // Found one side of the polygon that is intersect by viewingPositionLine.
+                            double x = 0;
+                            double y = 0;
+                            if (intersectEdgesIgnoreZ(pointX, pointY, thisAX, thisAY,
+                                                      m_coordinatesXY[2 * j], m_coordinatesXY[2 * j + 1], m_coordinatesXY[2 * nextJ], m_coordinatesXY[2 * nextJ + 1],
+                                                      x, y)) {
+                                // Found one side of the polygon that is intersect by the viewing line.
                                 thisACanBeSeenDirectly = false;
                             }
                         }
 
                         // This vertex is not hidden.
                         if (thisACanBeSeenDirectly) {
-                            resultingVertices.push_back(thisA);
+                            resultingVertices.push_back(m_listOfVertices[i]);
                         }
                     }
 
-                    // Remove crossing from viewing position.
-                    AngleXYComparator angleXYComparator(point);
-                    std::sort(resultingVertices.begin(), resultingVertices.end(), angleXYComparator);
+                    // Remove crossing lines.
                     contour = Polygon(resultingVertices);
                 }
 
@@ -348,22 +558,9 @@ namespace hesperia {
 
                 Serializer &s = sf.getSerializer(out);
 
-                // Write number of vertices.
-                uint32_t numberOfVertices = static_cast<uint32_t>(m_listOfVertices.size());
-                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('n', 'u', 'm', 'v', 'e', 'r', 't', 's') >::RESULT,
-                        numberOfVertices);
-
-                // Write actual vertices to stringstream.
-                stringstream sstr;
-                for (uint32_t i = 0; i < numberOfVertices; i++) {
-                    sstr << m_listOfVertices.at(i);
-                }
-
-                // Write string of vertices.
-                if (numberOfVertices > 0) {
-                    s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('v', 'e', 'r', 't', 'i', 'c', 'e', 's') >::RESULT,
-                            sstr.str());
-                }
+                PackedVertexList::write(s, CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('n', 'u', 'm', 'v', 'e', 'r', 't', 's') >::RESULT,
+                                        CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('v', 'e', 'r', 't', 'i', 'c', 'e', 's') >::RESULT,
+                                        m_listOfVertices);
 
                 return out;
             }
@@ -376,26 +573,10 @@ namespace hesperia {
                 // Clean up.
                 m_listOfVertices.clear();
 
-                // Read number of vertices.
-                uint32_t numberOfVertices = 0;
-                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('n', 'u', 'm', 'v', 'e', 'r', 't', 's') >::RESULT,
-                       numberOfVertices);
-
-                if (numberOfVertices > 0) {
-                    // Read string of vertices.
-                    string vertices;
-                    d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('v', 'e', 'r', 't', 'i', 'c', 'e', 's') >::RESULT,
-                           vertices);
-
-                    stringstream sstr(vertices);
-
-                    // Read actual vertices from stringstream.
-                    for (uint32_t i = 0; i < numberOfVertices; i++) {
-                        Point3 p;
-                        sstr >> p;
-                        add(p);
-                    }
-                }
+                PackedVertexList::read(d, CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('n', 'u', 'm', 'v', 'e', 'r', 't', 's') >::RESULT,
+                                       CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('v', 'e', 'r', 't', 'i', 'c', 'e', 's') >::RESULT,
+                                       m_listOfVertices);
+                updateCoordinates();
 
                 return in;
             }
@@ -24,6 +24,7 @@
 #include "core/base/SerializationFactory.h"
 #include "core/base/Serializer.h"
 
+#include "hesperia/data/environment/PackedVertexList.h"
 #include "hesperia/data/planning/Route.h"
 
 namespace hesperia {
@@ -33,6 +34,7 @@ namespace hesperia {
             using namespace std;
             using namespace core::base;
             using namespace core::data::environment;
+            using namespace hesperia::data::environment;
 
             Route::Route() :
                 m_listOfVertices() {}
@@ -89,22 +91,9 @@ namespace hesperia {
 
                 Serializer &s = sf.getSerializer(out);
 
-                // Write number of vertices.
-                uint32_t numberOfVertices = static_cast<uint32_t>(m_listOfVertices.size());
-                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('n', 'u', 'm', 'v', 'e', 'r', 't', 's') >::RESULT,
-                        numberOfVertices);
-
-                // Write actual vertices to stringstream.
-                stringstream sstr;
-                for (uint32_t i = 0; i < numberOfVertices; i++) {
-                    sstr << m_listOfVertices.at(i);
-                }
-
-                // Write string of vertices.
-                if (numberOfVertices > 0) {
-                    s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('v', 'e', 'r', 't', 'i', 'c', 'e', 's') >::RESULT,
-                            sstr.str());
-                }
+                PackedVertexList::write(s, CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('n', 'u', 'm', 'v', 'e', 'r', 't', 's') >::RESULT,
+                                        CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('v', 'e', 'r', 't', 'i', 'c', 'e', 's') >::RESULT,
+                                        m_listOfVertices);
 
                 return out;
             }
@@ -117,26 +106,9 @@ namespace hesperia {
                 // Clean up.
                 m_listOfVertices.clear();
 
-                // Read number of vertices.
-                uint32_t numberOfVertices = 0;
-                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('n', 'u', 'm', 'v', 'e', 'r', 't', 's') >::RESULT,
-                       numberOfVertices);
-
-                if (numberOfVertices > 0) {
-                    // Read string of vertices.
-                    string vertices;
-                    d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('v', 'e', 'r', 't', 'i', 'c', 'e', 's') >::RESULT,
-                           vertices);
-
-                    stringstream sstr(vertices);
-
-                    // Read actual vertices from stringstream.
-                    for (uint32_t i = 0; i < numberOfVertices; i++) {
-                        Point3 p;
-                        sstr >> p;
-                        add(p);
-                    }
-                }
+                PackedVertexList::read(d, CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('n', 'u', 'm', 'v', 'e', 'r', 't', 's') >::RESULT,
+                                       CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('v', 'e', 'r', 't', 'i', 'c', 'e', 's') >::RESULT,
+                                       m_listOfVertices);
 
                 return in;
             }
@@ -22,6 +22,7 @@
 #include "core/base/SerializationFactory.h"
 #include "core/base/Serializer.h"
 
+#include "hesperia/data/environment/PackedVertexList.h"
 #include "hesperia/data/sensor/ContouredObject.h"
 
 namespace hesperia {
@@ -31,6 +32,7 @@ namespace hesperia {
             using namespace std;
             using namespace core::base;
             using namespace core::data::environment;
+            using namespace hesperia::data::environment;
 
             ContouredObject::ContouredObject() :
                     PointShapedObject(), m_contour() {}
@@ -84,17 +86,9 @@ namespace hesperia {
                 Serializer &s = sf.getSerializer(out);
 
                 // Write contour.
-                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('c', 'o', 'n', 't', 's', 'i', 'z', 'e') >::RESULT,
-                        static_cast<uint32_t>(m_contour.size()));
-
-                // Coordinates.
-                stringstream sstr;
-                vector<Point3>::const_iterator it = m_contour.begin();
-                while (it != m_contour.end()) {
-                    sstr << (*it++);
-                }
-                s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL7('c', 'o', 'n', 't', 'o', 'u', 'r') >::RESULT,
-                        sstr.str());
+                PackedVertexList::write(s, CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('c', 'o', 'n', 't', 's', 'i', 'z', 'e') >::RESULT,
+                                        CRC32 < OPENDAVINCI_CORE_STRINGLITERAL7('c', 'o', 'n', 't', 'o', 'u', 'r') >::RESULT,
+                                        m_contour);
 
                 return out;
             }
@@ -109,22 +103,10 @@ namespace hesperia {
                 Deserializer &d = sf.getDeserializer(in);
 
                 // Read contour.
-                uint32_t numberOfContourPoints = 0;
-                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('c', 'o', 'n', 't', 's', 'i', 'z', 'e') >::RESULT,
-                       numberOfContourPoints);
                 m_contour.clear();
-
-                string contour;
-                d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL7('c', 'o', 'n', 't', 'o', 'u', 'r') >::RESULT,
-                       contour);
-                stringstream sstr;
-                sstr.str(contour);
-                while (numberOfContourPoints > 0) {
-                    Point3 cc;
-                    sstr >> cc;
-                    m_contour.push_back(cc);
-                    numberOfContourPoints--;
-                }
+                PackedVertexList::read(d, CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('c', 'o', 'n', 't', 's', 'i', 'z', 'e') >::RESULT,
+                                       CRC32 < OPENDAVINCI_CORE_STRINGLITERAL7('c', 'o', 'n', 't', 'o', 'u', 'r') >::RESULT,
+                                       m_contour);
 
                 return in;
             }
@@ -292,8 +292,8 @@ namespace hesperia {
         }
 
         void DataRenderer::loadComplexModel(const uint32_t &id, hesperia::data::situation::ComplexModel &cm) {
-            istream *in = m_scnxArchive->getModelData(cm.getModelFile());
-            if (in != NULL) {
+            core::SharedPointer<istream> in = m_scnxArchive->getModelData(cm.getModelFile());
+            if (in.isValid()) {
                 // Load model.
                 OBJXArchive *objxArchive = NULL;
                 if (cm.getModelFile().find(".objx") != string::npos) {
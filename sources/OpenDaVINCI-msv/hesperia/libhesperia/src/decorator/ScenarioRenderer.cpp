@@ -127,8 +127,8 @@ namespace hesperia {
         }
 
         void ScenarioRenderer::loadGroundBasedComplexModel(ComplexModel &cm) {
-            istream *in = m_scnxArchive->getModelData(cm.getModelFile());
-            if (in != NULL) {
+            core::SharedPointer<istream> in = m_scnxArchive->getModelData(cm.getModelFile());
+            if (in.isValid()) {
                 // Load model.
                 OBJXArchive *objxArchive = NULL;
                 if (cm.getModelFile().find(".objx") != string::npos) {
@@ -55,8 +55,8 @@ namespace hesperia {
             vector<ComplexModel*>::iterator jt = listOfComplexModels.begin();
             while (jt != listOfComplexModels.end()) {
                 ComplexModel *cm = (*jt++);
-                istream *in = scnxArchive.getModelData(cm->getModelFile());
-                if (in != NULL) {
+                core::SharedPointer<istream> in = scnxArchive.getModelData(cm->getModelFile());
+                if (in.isValid()) {
                     Node *model = NULL;
 
                     // Check model.
@@ -0,0 +1,234 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <cmath>
+#include <limits>
+
+#include "hesperia/scenario/LaneIndex.h"
+#include "hesperia/scenario/LaneVisitor.h"
+
+namespace hesperia {
+    namespace scenario {
+
+        using namespace std;
+        using namespace core::data::environment;
+        using namespace data::environment;
+
+        /**
+         * This function limits the given cell index to [0 .. size-1].
+         *
+         * @param value Unlimited cell index.
+         * @param size Number of cells.
+         * @return Limited cell index.
+         */
+        static int32_t clampCell(const double &value, const uint32_t &size) {
+            if (value < 0) {
+                return 0;
+            }
+            if (value >= size) {
+                return static_cast<int32_t>(size) - 1;
+            }
+            return static_cast<int32_t>(value);
+        }
+
+        LaneIndex::LaneIndex(data::scenario::Scenario &scenario) :
+            m_graph(),
+            m_listOfLines(),
+            m_coordinates(),
+            m_minX(0),
+            m_minY(0),
+            m_cellSize(1),
+            m_columns(0),
+            m_rows(0),
+            m_cellStart(),
+            m_cellEntries() {
+            LaneVisitor lv(m_graph, scenario);
+            scenario.accept(lv);
+            m_listOfLines = lv.getListOfLines();
+
+            buildGrid();
+        }
+
+        LaneIndex::LaneIndex(const vector<NamedLine> &listOfLines) :
+            m_graph(),
+            m_listOfLines(listOfLines),
+            m_coordinates(),
+            m_minX(0),
+            m_minY(0),
+            m_cellSize(1),
+            m_columns(0),
+            m_rows(0),
+            m_cellStart(),
+            m_cellEntries() {
+            buildGrid();
+        }
+
+        LaneIndex::~LaneIndex() {}
+
+        core::wrapper::graph::DirectedGraph& LaneIndex::getGraph() {
+            return m_graph;
+        }
+
+        const vector<NamedLine>& LaneIndex::getListOfLines() const {
+            return m_listOfLines;
+        }
+
+        void LaneIndex::buildGrid() {
+            const uint32_t SIZE = m_listOfLines.size();
+            if (SIZE == 0) {
+                return;
+            }
+
+            m_coordinates.reserve(4 * SIZE);
+            double maxX = -numeric_limits<double>::max();
+            double maxY = -numeric_limits<double>::max();
+            m_minX = numeric_limits<double>::max();
+            m_minY = numeric_limits<double>::max();
+            for (uint32_t i = 0; i < SIZE; i++) {
+                const Point3 a = m_listOfLines[i].getA();
+                const Point3 b = m_listOfLines[i].getB();
+                m_coordinates.push_back(a.getX());
+                m_coordinates.push_back(a.getY());
+                m_coordinates.push_back(b.getX());
+                m_coordinates.push_back(b.getY());
+
+                m_minX = min(m_minX, min(a.getX(), b.getX()));
+                m_minY = min(m_minY, min(a.getY(), b.getY()));
+                maxX = max(maxX, max(a.getX(), b.getX()));
+                maxY = max(maxY, max(a.getY(), b.getY()));
+            }
+
+            // Aim at roughly one segment per cell but avoid tiny cells.
+            const double MINIMUM_CELL_SIZE = 1.0;
+            m_cellSize = max(maxX - m_minX, maxY - m_minY) / ceil(sqrt(static_cast<double>(SIZE)));
+            if (m_cellSize < MINIMUM_CELL_SIZE) {
+                m_cellSize = MINIMUM_CELL_SIZE;
+            }
+            m_columns = static_cast<uint32_t>(floor((maxX - m_minX) / m_cellSize)) + 1;
+            m_rows = static_cast<uint32_t>(floor((maxY - m_minY) / m_cellSize)) + 1;
+
+            // First pass: count the segments per cell; second pass: store them.
+            m_cellStart.assign(m_columns * m_rows + 1, 0);
+            for (uint32_t pass = 0; pass < 2; pass++) {
+                vector<uint32_t> cursor;
+                if (pass == 1) {
+                    for (uint32_t i = 1; i < m_cellStart.size(); i++) {
+                        m_cellStart[i] += m_cellStart[i - 1];
+                    }
+                    m_cellEntries.resize(m_cellStart.back());
+                    cursor.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+                }
+
+                for (uint32_t i = 0; i < SIZE; i++) {
+                    const double *c = &m_coordinates[4 * i];
+                    const int32_t c0 = clampCell((min(c[0], c[2]) - m_minX) / m_cellSize, m_columns);
+                    const int32_t c1 = clampCell((max(c[0], c[2]) - m_minX) / m_cellSize, m_columns);
+                    const int32_t r0 = clampCell((min(c[1], c[3]) - m_minY) / m_cellSize, m_rows);
+                    const int32_t r1 = clampCell((max(c[1], c[3]) - m_minY) / m_cellSize, m_rows);
+
+                    for (int32_t r = r0; r <= r1; r++) {
+                        for (int32_t col = c0; col <= c1; col++) {
+                            const uint32_t cell = r * m_columns + col;
+                            if (pass == 0) {
+                                m_cellStart[cell + 1]++;
+                            }
+                            else {
+                                m_cellEntries[cursor[cell]++] = i;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        double LaneIndex::getSquaredDistanceTo(const double &x, const double &y, const uint32_t &index) const {
+            const double *c = &m_coordinates[4 * index];
+            const double dx = c[2] - c[0];
+            const double dy = c[3] - c[1];
+            const double lengthSquared = dx * dx + dy * dy;
+
+            // Project onto the segment and limit to its end points.
+            double t = 0;
+            if (lengthSquared > 0) {
+                t = ((x - c[0]) * dx + (y - c[1]) * dy) / lengthSquared;
+                t = max(0.0, min(1.0, t));
+            }
+
+            const double ex = x - (c[0] + t * dx);
+            const double ey = y - (c[1] + t * dy);
+            return ex * ex + ey * ey;
+        }
+
+        bool LaneIndex::getNearestLine(const Point3 &position, NamedLine &line, double &distance) const {
+            if (m_listOfLines.empty()) {
+                return false;
+            }
+
+            const double x = position.getX();
+            const double y = position.getY();
+            const int32_t cx = clampCell((x - m_minX) / m_cellSize, m_columns);
+            const int32_t cy = clampCell((y - m_minY) / m_cellSize, m_rows);
+
+            double best = numeric_limits<double>::max();
+            uint32_t bestIndex = 0;
+
+            // Search rings of cells around the position's cell. All segments
+            // not seen before ring r are at least (r-1) cells away.
+            const int32_t MAXIMUM_RING = static_cast<int32_t>(max(m_columns, m_rows));
+            for (int32_t r = 0; r <= MAXIMUM_RING; r++) {
+                if (r > 0) {
+                    const double bound = (r - 1) * m_cellSize;
+                    if (best <= bound * bound) {
+                        break;
+                    }
+                }
+
+                for (int32_t row = cy - r; row <= cy + r; row++) {
+                    if ( (row < 0) || (row >= static_cast<int32_t>(m_rows)) ) {
+                        continue;
+                    }
+
+                    // Inner rows of the ring contribute only their first and last cell.
+                    const bool fullRow = (abs(row - cy) == r);
+                    const int32_t step = (fullRow || (r == 0)) ? 1 : 2 * r;
+                    for (int32_t col = cx - r; col <= cx + r; col += step) {
+                        if ( (col < 0) || (col >= static_cast<int32_t>(m_columns)) ) {
+                            continue;
+                        }
+
+                        const uint32_t cell = row * m_columns + col;
+                        for (uint32_t k = m_cellStart[cell]; k < m_cellStart[cell + 1]; k++) {
+                            const double d = getSquaredDistanceTo(x, y, m_cellEntries[k]);
+                            if (d < best) {
+                                best = d;
+                                bestIndex = m_cellEntries[k];
+                            }
+                        }
+                    }
+                }
+            }
+
+            line = m_listOfLines[bestIndex];
+            distance = sqrt(best);
+            return true;
+        }
+
+    }
+} // hesperia::scenario
@@ -44,13 +44,69 @@ namespace hesperia {
         using namespace hesperia::data::graph;
         using namespace hesperia::data::scenario;
 
+        /**
+         * This class collects all lanes of a scenario by their
+         * "layer.road.lane" identifier.
+         */
+        class LaneCollector : public ScenarioVisitor {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                LaneCollector(const LaneCollector &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                LaneCollector& operator=(const LaneCollector &);
+
+            public:
+                LaneCollector(map<string, Lane*> &mapOfLanes) :
+                    m_mapOfLanes(mapOfLanes) {}
+
+                virtual ~LaneCollector() {}
+
+                virtual void visit(ScenarioNode &node) {
+                    Lane *lane = dynamic_cast<Lane*>(&node);
+                    if ( (lane != NULL) && (lane->getRoad() != NULL) && (lane->getRoad()->getLayer() != NULL) ) {
+                        stringstream key;
+                        key << lane->getRoad()->getLayer()->getID() << "." << lane->getRoad()->getID() << "." << lane->getID();
+                        m_mapOfLanes[key.str()] = lane;
+                    }
+                }
+
+            private:
+                map<string, Lane*> &m_mapOfLanes;
+        };
+
         LaneVisitor::LaneVisitor(core::wrapper::graph::DirectedGraph &g, hesperia::data::scenario::Scenario &scenario) :
             m_graph(g),
             m_scenario(scenario),
-            m_listOfLines() {}
+            m_listOfLines(),
+            m_mapOfLanes(),
+            m_hasCollectedLanes(false) {}
 
         LaneVisitor::~LaneVisitor() {}
 
+        void LaneVisitor::find(FindNodeByPointIDVisitor &finder, const PointID &pointID) {
+            if (!m_hasCollectedLanes) {
+                LaneCollector collector(m_mapOfLanes);
+                m_scenario.accept(collector);
+                m_hasCollectedLanes = true;
+            }
+
+            stringstream key;
+            key << pointID.getLayerID() << "." << pointID.getRoadID() << "." << pointID.getLaneID();
+            map<string, Lane*>::iterator it = m_mapOfLanes.find(key.str());
+            if (it != m_mapOfLanes.end()) {
+                finder.visit(*(it->second));
+            }
+        }
+
         void LaneVisitor::visit(ScenarioNode &node) {
             try {
                 Lane &l = dynamic_cast<Lane&>(node);
@@ -127,11 +183,11 @@ namespace hesperia {
                     try {
                         // Find start vertex.
                         FindNodeByPointIDVisitor startVertexFinder(c.getSource());
-                        m_scenario.accept(startVertexFinder);
+                        find(startVertexFinder, c.getSource());
                         const PointModel *startPointModel = dynamic_cast<const PointModel*>(startVertexFinder.getLaneModel());
 
                         FindNodeByPointIDVisitor endVertexFinder(c.getTarget());
-                        m_scenario.accept(endVertexFinder);
+                        find(endVertexFinder, c.getTarget());
                         const PointModel *endPointModel = dynamic_cast<const PointModel*>(endVertexFinder.getLaneModel());
 
                         if ( (startPointModel != NULL) && (endPointModel != NULL) ) {
@@ -243,11 +299,11 @@ namespace hesperia {
                     try {
                         // Find start vertex.
                         FindNodeByPointIDVisitor startVertexFinder(c.getSource());
-                        m_scenario.accept(startVertexFinder);
+                        find(startVertexFinder, c.getSource());
                         const StraightLine *startStraightLine = dynamic_cast<const StraightLine*>(startVertexFinder.getLaneModel());
 
                         FindNodeByPointIDVisitor endVertexFinder(c.getTarget());
-                        m_scenario.accept(endVertexFinder);
+                        find(endVertexFinder, c.getTarget());
                         const StraightLine *endStraightLine = dynamic_cast<const StraightLine*>(endVertexFinder.getLaneModel());
 
                         if ( (startStraightLine != NULL) && (endStraightLine != NULL) ) {
@@ -328,11 +384,11 @@ namespace hesperia {
                     try {
                         // Find start vertex.
                         FindNodeByPointIDVisitor startVertexFinder(c.getSource());
-                        m_scenario.accept(startVertexFinder);
+                        find(startVertexFinder, c.getSource());
                         const StraightLine *startStraightLine = dynamic_cast<const StraightLine*>(startVertexFinder.getLaneModel());
 
                         FindNodeByPointIDVisitor endVertexFinder(c.getTarget());
-                        m_scenario.accept(endVertexFinder);
+                        find(endVertexFinder, c.getTarget());
                         const StraightLine *endStraightLine = dynamic_cast<const StraightLine*>(endVertexFinder.getLaneModel());
 
                         if ( (startStraightLine != NULL) && (endStraightLine != NULL) ) {
@@ -21,6 +21,7 @@
 #include <sstream>
 
 #include "core/macros.h"
+#include "core/base/Lock.h"
 #include "core/wrapper/Image.h"
 #include "core/wrapper/ImageFactory.h"
 
@@ -32,32 +33,23 @@ namespace hesperia {
     namespace scenario {
 
         using namespace std;
+        using namespace core::base;
 
-
-        SCNXArchive::SCNXArchive(const data::scenario::Scenario &scenario, core::wrapper::DecompressedData *dd) :
+        SCNXArchive::SCNXArchive(const data::scenario::Scenario &scenario, core::wrapper::DecompressedData *dd, SCNXArchiveCache *cache) :
                 m_scenario(scenario),
                 m_decompressedData(dd),
+                m_cache(cache),
                 m_aerialImage(NULL),
-                m_heightImage(NULL) {
-
-            // Try to read the images from the archive.
-            stringstream sstr;
-            sstr << scenario.getGround().getAerialImage().getFileName();
-            istream *stream = m_decompressedData->getInputStreamFor(sstr.str());
-            if (stream != NULL) {
-                m_aerialImage = core::wrapper::ImageFactory::getInstance().getImage(*stream);
-            }
-
-            sstr.str("");
-            sstr << scenario.getGround().getHeightImage().getFileName();
-            stream = m_decompressedData->getInputStreamFor(sstr.str());
-            if (stream != NULL) {
-                m_heightImage = core::wrapper::ImageFactory::getInstance().getImage(*stream);
-            }
-        }
+                m_heightImage(NULL),
+                m_hasLoadedAerialImage(false),
+                m_hasLoadedHeightImage(false),
+                m_laneIndex(NULL),
+                m_mutex() {}
 
         SCNXArchive::~SCNXArchive() {
             OPENDAVINCI_CORE_DELETE_POINTER(m_decompressedData);
+            OPENDAVINCI_CORE_DELETE_POINTER(m_cache);
+            OPENDAVINCI_CORE_DELETE_POINTER(m_laneIndex);
             OPENDAVINCI_CORE_DELETE_POINTER(m_aerialImage);
             OPENDAVINCI_CORE_DELETE_POINTER(m_heightImage);
         }
@@ -67,13 +59,43 @@ namespace hesperia {
         }
 
         core::wrapper::Image* SCNXArchive::getAerialImage() {
+            Lock l(m_mutex);
+            if (!m_hasLoadedAerialImage) {
+                m_aerialImage = loadImage(m_scenario.getGround().getAerialImage().getFileName());
+                m_hasLoadedAerialImage = true;
+            }
             return m_aerialImage;
         }
 
         core::wrapper::Image* SCNXArchive::getHeightImage() {
+            Lock l(m_mutex);
+            if (!m_hasLoadedHeightImage) {
+                m_heightImage = loadImage(m_scenario.getGround().getHeightImage().getFileName());
+                m_hasLoadedHeightImage = true;
+            }
             return m_heightImage;
         }
 
+        LaneIndex& SCNXArchive::getLaneIndex() {
+            Lock l(m_mutex);
+            if (m_laneIndex == NULL) {
+                m_laneIndex = new LaneIndex(m_scenario);
+            }
+            return *m_laneIndex;
+        }
+
+        core::wrapper::Image* SCNXArchive::loadImage(const string &fileName) {
+            core::wrapper::Image *image = NULL;
+
+            // Try to read the image from the archive; the caller holds m_mutex.
+            istream *stream = m_decompressedData->getInputStreamFor(fileName);
+            if (stream != NULL) {
+                image = core::wrapper::ImageFactory::getInstance().getImage(*stream);
+            }
+
+            return image;
+        }
+
         vector<data::scenario::ComplexModel*> SCNXArchive::getListOfGroundBasedComplexModels() const {
             const vector<data::scenario::Shape*> &listOfShapes = m_scenario.getGround().getSurroundings().getListOfShapes();
             vector<data::scenario::ComplexModel*> listOfComplexModels;
@@ -100,25 +122,50 @@ namespace hesperia {
             while (it != listOfEntries.end()) {
                 string entry = (*it++);
                 if (entry.find("situations/") != string::npos) {
-                    char c = 0;
                     stringstream s;
-                    istream* in = m_decompressedData->getInputStreamFor(entry);
-                    if ( (in != NULL) && (in->good()) ) {
-                        while ( in->get( c ) ) {
-                            s << c;
+                    {
+                        // The decompressed entry is shared with other readers of this archive.
+                        Lock l(m_mutex);
+                        istream* in = m_decompressedData->getInputStreamFor(entry);
+                        if ( (in != NULL) && (in->good()) ) {
+                            s << in->rdbuf();
+                        }
+                    }
+
+                    if (s.str().size() > 0) {
+                        // Parse the situation only if it is not cached yet.
+                        hesperia::data::situation::Situation sit;
+                        if ( (m_cache == NULL) || !m_cache->getSituation(entry, s.str(), sit) ) {
+                            sit = situation::SituationFactory::getInstance().getSituation(s.str());
+                            if (m_cache != NULL) {
+                                m_cache->putSituation(entry, s.str(), sit);
+                            }
                         }
-                        hesperia::data::situation::Situation sit = situation::SituationFactory::getInstance().getSituation(s.str());
                         listOfSituations.push_back(sit);
                     }
                 }
             }
+
+            if (m_cache != NULL) {
+                m_cache->save();
+            }
+
             return listOfSituations;
         }
 
-        istream* SCNXArchive::getModelData(const string &modelFile) const {
-            stringstream sstr;
-            sstr << modelFile;
-            return m_decompressedData->getInputStreamFor(sstr.str());
+        core::SharedPointer<istream> SCNXArchive::getModelData(const string &modelFile) const {
+            core::SharedPointer<istream> modelData;
+
+            // The decompressed entry is shared with other readers of this archive; hand out a copy.
+            Lock l(m_mutex);
+            istream *in = m_decompressedData->getInputStreamFor(modelFile);
+            if (in != NULL) {
+                stringstream *copy = new stringstream();
+                (*copy) << in->rdbuf();
+                modelData = core::SharedPointer<istream>(copy);
+            }
+
+            return modelData;
         }
     }
 } // hesperia::scenario
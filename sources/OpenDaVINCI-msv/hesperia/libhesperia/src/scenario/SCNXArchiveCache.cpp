@@ -0,0 +1,256 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "core/macros.h"
+#include "core/base/Lock.h"
+
+#include "hesperia/scenario/SCNXArchiveCache.h"
+
+namespace hesperia {
+    namespace scenario {
+
+        using namespace std;
+        using namespace core::base;
+        using namespace data::scenario;
+        using namespace data::situation;
+
+        const string SCNXArchiveCache::MAGIC = "SCNXCACHE";
+        const uint32_t SCNXArchiveCache::VERSION = 2;
+
+        SCNXArchiveCache::CacheEntry::CacheEntry() :
+            m_length(0),
+            m_hash(0),
+            m_data() {}
+
+        SCNXArchiveCache::SCNXArchiveCache(const string &fileName) :
+            m_mutex(),
+            m_fileName(fileName),
+            m_mapOfEntries(),
+            m_modified(false) {
+            load();
+        }
+
+        SCNXArchiveCache::~SCNXArchiveCache() {}
+
+        const string SCNXArchiveCache::getCacheFileNameFor(const string &archiveFileName) {
+            return archiveFileName + ".cache";
+        }
+
+        bool SCNXArchiveCache::getScenario(const string &entry, const string &source, Scenario &scenario) {
+            string data;
+            if (find(entry, source, data)) {
+                try {
+                    stringstream sstr(data);
+                    Scenario s;
+                    sstr >> s;
+                    scenario = s;
+                    return true;
+                }
+                catch(...) {
+                    clog << "SCNXArchiveCache: Ignoring corrupt cache entry '" << entry << "' in " << m_fileName << endl;
+                }
+            }
+            return false;
+        }
+
+        void SCNXArchiveCache::putScenario(const string &entry, const string &source, const Scenario &scenario) {
+            stringstream sstr;
+            sstr << scenario;
+            store(entry, source, sstr.str());
+        }
+
+        bool SCNXArchiveCache::getSituation(const string &entry, const string &source, Situation &situation) {
+            string data;
+            if (find(entry, source, data)) {
+                try {
+                    stringstream sstr(data);
+                    Situation s;
+                    sstr >> s;
+                    situation = s;
+                    return true;
+                }
+                catch(...) {
+                    clog << "SCNXArchiveCache: Ignoring corrupt cache entry '" << entry << "' in " << m_fileName << endl;
+                }
+            }
+            return false;
+        }
+
+        void SCNXArchiveCache::putSituation(const string &entry, const string &source, const Situation &situation) {
+            stringstream sstr;
+            sstr << situation;
+            store(entry, source, sstr.str());
+        }
+
+        uint64_t SCNXArchiveCache::getHash(const string &source) {
+            // 64-bit FNV-1a; the constants are composed as C++98 lacks 64-bit literals.
+            const uint64_t OFFSET_BASIS = (static_cast<uint64_t>(0xcbf29ce4U) << 32) | 0x84222325U;
+            const uint64_t PRIME = (static_cast<uint64_t>(1) << 40) | 0x1b3U;
+
+            uint64_t hash = OFFSET_BASIS;
+            for (uint32_t i = 0; i < source.size(); i++) {
+                hash ^= static_cast<unsigned char>(source[i]);
+                hash *= PRIME;
+            }
+            return hash;
+        }
+
+        bool SCNXArchiveCache::find(const string &entry, const string &source, string &data) {
+            Lock l(m_mutex);
+
+            map<string, CacheEntry, core::wrapper::StringComparator>::const_iterator it = m_mapOfEntries.find(entry);
+            if ( (it != m_mapOfEntries.end()) &&
+                 (it->second.m_length == source.size()) &&
+                 (it->second.m_hash == getHash(source)) ) {
+                data = it->second.m_data;
+                return true;
+            }
+            return false;
+        }
+
+        void SCNXArchiveCache::store(const string &entry, const string &source, const string &data) {
+            Lock l(m_mutex);
+
+            CacheEntry e;
+            e.m_length = source.size();
+            e.m_hash = getHash(source);
+            e.m_data = data;
+
+            m_mapOfEntries[entry] = e;
+            m_modified = true;
+        }
+
+        void SCNXArchiveCache::load() {
+            Lock l(m_mutex);
+
+            fstream fin(m_fileName.c_str(), ios::binary | ios::in);
+            if (!fin.good()) {
+                return;
+            }
+
+            string magic;
+            getline(fin, magic);
+
+            uint32_t version = 0;
+            uint32_t numberOfEntries = 0;
+            fin >> version >> numberOfEntries;
+            fin.get();
+
+            if ( !fin.good() || (magic != MAGIC) || (version != VERSION) ) {
+                clog << "SCNXArchiveCache: Ignoring outdated cache " << m_fileName << endl;
+                return;
+            }
+
+            // Only a completely readable file replaces the (empty) cache.
+            map<string, CacheEntry, core::wrapper::StringComparator> mapOfEntries;
+            for (uint32_t i = 0; i < numberOfEntries; i++) {
+                string entry;
+                getline(fin, entry);
+
+                CacheEntry e;
+                uint32_t size = 0;
+                fin >> e.m_length >> e.m_hash >> size;
+                fin.get();
+
+                if (fin.good() && (size > 0)) {
+                    vector<char> buffer(size);
+                    fin.read(&buffer[0], size);
+                    e.m_data.assign(&buffer[0], size);
+                }
+                fin.get();
+
+                if (!fin.good()) {
+                    clog << "SCNXArchiveCache: Ignoring truncated cache " << m_fileName << endl;
+                    return;
+                }
+
+                mapOfEntries[entry] = e;
+            }
+
+            m_mapOfEntries = mapOfEntries;
+        }
+
+        void SCNXArchiveCache::save() {
+            Lock l(m_mutex);
+
+            if (!m_modified) {
+                return;
+            }
+
+#ifdef WIN32
+            const string temporaryFileName = m_fileName;
+#else
+            // Write to a unique file in the same directory and rename it afterwards.
+            const string pattern = m_fileName + ".XXXXXX";
+            vector<char> buffer(pattern.begin(), pattern.end());
+            buffer.push_back('\0');
+
+            const int fd = mkstemp(&buffer[0]);
+            if (fd == -1) {
+                clog << "SCNXArchiveCache: Could not write cache " << m_fileName << endl;
+                return;
+            }
+            fchmod(fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+            close(fd);
+
+            const string temporaryFileName(&buffer[0]);
+#endif
+
+            fstream fout(temporaryFileName.c_str(), ios::binary | ios::out | ios::trunc);
+            fout << MAGIC << endl
+                 << VERSION << " " << m_mapOfEntries.size() << endl;
+
+            map<string, CacheEntry, core::wrapper::StringComparator>::const_iterator it = m_mapOfEntries.begin();
+            while (it != m_mapOfEntries.end()) {
+                fout << it->first << endl
+                     << it->second.m_length << " " << it->second.m_hash << " " << it->second.m_data.size() << endl;
+                fout.write(it->second.m_data.c_str(), it->second.m_data.size());
+                fout << endl;
+                it++;
+            }
+            fout.flush();
+
+            const bool written = fout.good();
+            fout.close();
+
+#ifdef WIN32
+            if (!written) {
+                UNLINK(temporaryFileName.c_str());
+                clog << "SCNXArchiveCache: Could not write cache " << m_fileName << endl;
+                return;
+            }
+#else
+            if ( !written || (rename(temporaryFileName.c_str(), m_fileName.c_str()) != 0) ) {
+                UNLINK(temporaryFileName.c_str());
+                clog << "SCNXArchiveCache: Could not write cache " << m_fileName << endl;
+                return;
+            }
+#endif
+
+            m_modified = false;
+        }
+
+    }
+} // hesperia::scenario
@@ -17,7 +17,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <fstream>
+#include <memory>
 #include <sstream>
 
 #include "core/macros.h"
@@ -26,6 +26,7 @@
 #include "core/wrapper/DecompressedData.h"
 #include "core/wrapper/DisposalService.h"
 #include "core/exceptions/Exceptions.h"
+#include "hesperia/scenario/SCNXArchiveCache.h"
 #include "hesperia/scenario/SCNXArchiveFactory.h"
 #include "hesperia/scenario/ScenarioFactory.h"
 #include "hesperia/data/scenario/Scenario.h"
@@ -45,12 +46,13 @@ namespace hesperia {
         SCNXArchiveFactory* SCNXArchiveFactory::m_singleton = NULL;
 
         SCNXArchiveFactory::SCNXArchiveFactory() :
+                m_mutex(),
                 m_mapOfSCNXArchives() {}
 
         SCNXArchiveFactory::~SCNXArchiveFactory() {
             map<string, SCNXArchive*, core::wrapper::StringComparator>::iterator it = m_mapOfSCNXArchives.begin();
             while (it != m_mapOfSCNXArchives.end()) {
-                SCNXArchive *s = it->second;
+                SCNXArchive *s = (it++)->second;
                 OPENDAVINCI_CORE_DELETE_POINTER(s);
             }
             m_mapOfSCNXArchives.clear();
@@ -74,6 +76,8 @@ namespace hesperia {
                 OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, "URL is invalid.");
             }
 
+            Lock l(m_mutex);
+
             SCNXArchive *scnxArchive = NULL;
 
             // Try to find an existing SCNXArchive in the map using the URL as key.
@@ -86,34 +90,35 @@ namespace hesperia {
             if (scnxArchive == NULL) {
                 clog << "Creating new SCNXArchive from " << url.toString() << endl;
 
+                // The archive is read directly from the file; its entries are decompressed on demand.
                 string fileName = url.getResource();
-                fstream fin(fileName.c_str(), ios::binary | ios::in);
-                core::wrapper::DecompressedData *data = core::wrapper::CompressionFactory::getContents(fin);
-                fin.close();
+                core::wrapper::DecompressedData *data = core::wrapper::CompressionFactory::getContents(fileName);
 
                 if (data != NULL) {
+                    // Parsed data structures are cached next to the archive.
+                    auto_ptr<SCNXArchiveCache> cache(new SCNXArchiveCache(SCNXArchiveCache::getCacheFileNameFor(fileName)));
+
                     Scenario scenario;
                     istream *stream = data->getInputStreamFor("scenario.scn");
                     if (stream != NULL) {
                         stringstream s;
-                        char c;
-                        while (stream->good()) {
-                            stream->get(c);
-                            s << c;
-                        }
+                        s << stream->rdbuf();
 
-                        // Trying to parse the input.
-                        scenario = ScenarioFactory::getInstance().getScenario(s.str());
+                        // Trying to parse the input unless it is cached already.
+                        if (!cache->getScenario("scenario.scn", s.str(), scenario)) {
+                            scenario = ScenarioFactory::getInstance().getScenario(s.str());
+                            cache->putScenario("scenario.scn", s.str(), scenario);
+                            cache->save();
+                        }
                     } else {
                         OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, "Archive from the given URL does not contain a valid SCN file.");
                     }
 
                     // Create SCNXArchive.
-                    scnxArchive = new SCNXArchive(scenario, data);
+                    scnxArchive = new SCNXArchive(scenario, data, cache.release());
 
-                    // Store SCNXArchive for further usage.
-                    // Somehow, there seems to be a bug because the data structure got corrupt...
-//                    m_mapOfSCNXArchives[url.toString()] = scnxArchive;
+                    // Store SCNXArchive for further usage; all consumers share the parsed scenario and its derived data.
+                    m_mapOfSCNXArchives[url.toString()] = scnxArchive;
                 }
                 else {
                     OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, "URL could not be used to read input data.");
@@ -25,11 +25,17 @@
 #include <sstream>
 #include <vector>
 
+#include "core/base/Hash.h"
+#include "core/base/SerializationFactory.h"
+#include "core/base/Serializer.h"
 #include "core/data/environment/Point3.h"
+#include "hesperia/data/environment/PointShapedObject.h"
 #include "hesperia/data/sensor/ContouredObject.h"
 
 using namespace std;
+using namespace core::base;
 using namespace hesperia::data;
+using namespace hesperia::data::environment;
 using namespace core::data::environment;
 using namespace hesperia::data::sensor;
 
@@ -63,6 +69,67 @@ class ContouredObjectTest : public CxxTest::TestSuite {
             TS_ASSERT(contour.at(0).toString() == c1.toString());
             TS_ASSERT(contour.at(1).toString() == c2.toString());
         }
+
+        void testContouredObjectSerializationIsExact() {
+            vector<Point3> contour;
+            for(uint32_t i = 0; i < 100; i++) {
+                contour.push_back(Point3(i / 3.0, -i * 1e-7, 1e9 + i / 7.0));
+            }
+
+            ContouredObject co(Point3(1, 2, 3), Point3(4, 5, 6), Point3(7, 8, 9), Point3(10, 11, 12));
+            co.setContour(contour);
+
+            stringstream s;
+            s << co;
+
+            ContouredObject co2;
+            s >> co2;
+
+            vector<Point3> contour2 = co2.getContour();
+            TS_ASSERT(co.toString() == co2.toString());
+            TS_ASSERT(contour2.size() == 100);
+            for(uint32_t i = 0; i < contour2.size(); i++) {
+                TS_ASSERT_DELTA(contour.at(i).getX(), contour2.at(i).getX(), 0);
+                TS_ASSERT_DELTA(contour.at(i).getY(), contour2.at(i).getY(), 0);
+                TS_ASSERT_DELTA(contour.at(i).getZ(), contour2.at(i).getZ(), 0);
+            }
+
+            // Empty contour.
+            stringstream s2;
+            s2 << ContouredObject();
+            s2 >> co2;
+            TS_ASSERT(co2.getContour().size() == 0);
+        }
+
+        void testContouredObjectDeserializationOfNestedContour() {
+            // Layout written before contours were packed.
+            PointShapedObject pso(Point3(1, 2, 3), Point3(4, 5, 6), Point3(7, 8, 9), Point3(10, 11, 12));
+
+            stringstream s;
+            s << pso;
+            {
+                SerializationFactory sf;
+                Serializer &ser = sf.getSerializer(s);
+
+                uint32_t numberOfContourPoints = 2;
+                ser.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('c', 'o', 'n', 't', 's', 'i', 'z', 'e') >::RESULT,
+                          numberOfContourPoints);
+
+                stringstream sstr;
+                sstr << Point3(13, 14, 15) << Point3(16, 17, 18);
+                ser.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL7('c', 'o', 'n', 't', 'o', 'u', 'r') >::RESULT,
+                          sstr.str());
+            }
+
+            ContouredObject co;
+            s >> co;
+
+            vector<Point3> contour = co.getContour();
+            TS_ASSERT(co.getPosition().getDistanceTo(Point3(1, 2, 3)) < 1e-6);
+            TS_ASSERT(contour.size() == 2);
+            TS_ASSERT(contour.at(0).getDistanceTo(Point3(13, 14, 15)) < 1e-6);
+            TS_ASSERT(contour.at(1).getDistanceTo(Point3(16, 17, 18)) < 1e-6);
+        }
 };
 
 #endif /*HESPERIA_CONTOUREDOBJECTTESTSUITE_H_*/
@@ -0,0 +1,114 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_DIRECTEDGRAPHTESTSUITE_H_
+#define HESPERIA_DIRECTEDGRAPHTESTSUITE_H_
+
+#include <vector>
+
+#include "cxxtest/TestSuite.h"
+
+#include "core/data/environment/Point3.h"
+#include "core/wrapper/graph/DirectedGraph.h"
+#include "hesperia/data/graph/WaypointVertex.h"
+#include "hesperia/data/graph/WaypointsEdge.h"
+
+using namespace std;
+using namespace core::data::environment;
+using namespace core::wrapper::graph;
+using namespace hesperia::data::graph;
+
+class DirectedGraphTest : public CxxTest::TestSuite {
+    public:
+        WaypointVertex* createVertex(const uint32_t &id, const double &x, const double &y) {
+            WaypointVertex *v = new WaypointVertex();
+            v->setWaypointID(id);
+            v->setPosition(Point3(x, y, 0));
+            return v;
+        }
+
+        WaypointsEdge* createEdge(const double &costs) {
+            WaypointsEdge *e = new WaypointsEdge();
+            e->setCosts(costs);
+            return e;
+        }
+
+        void testShortestPathAndCache() {
+            DirectedGraph g;
+
+            // a -> b -> d is cheaper than a -> c -> d.
+            WaypointVertex *a = createVertex(1, 0, 0);
+            WaypointVertex *b = createVertex(2, 1, 0);
+            WaypointVertex *c = createVertex(3, 0, 1);
+            WaypointVertex *d = createVertex(4, 1, 1);
+            g.updateEdge(a, b, createEdge(1));
+            g.updateEdge(b, d, createEdge(1));
+            g.updateEdge(a, c, createEdge(1));
+            g.updateEdge(c, d, createEdge(2));
+
+            vector<const Vertex*> route = g.getShortestPath(*a, *d);
+            TS_ASSERT(route.size() == 3);
+            TS_ASSERT(route.at(0) == a);
+            TS_ASSERT(route.at(1) == b);
+            TS_ASSERT(route.at(2) == d);
+            TS_ASSERT(g.getNumberOfCachedRoutes() == 1);
+
+            // Cached route.
+            TS_ASSERT(g.getShortestPath(*a, *d) == route);
+            TS_ASSERT(g.getNumberOfCachedRoutes() == 1);
+
+            // d cannot reach a.
+            TS_ASSERT(g.getShortestPath(*d, *a).size() == 0);
+            TS_ASSERT(g.getNumberOfCachedRoutes() == 2);
+
+            // A shortcut invalidates all cached routes.
+            g.updateEdge(a, d, createEdge(1.5));
+            TS_ASSERT(g.getNumberOfCachedRoutes() == 0);
+
+            route = g.getShortestPath(*a, *d);
+            TS_ASSERT(route.size() == 2);
+            TS_ASSERT(route.at(0) == a);
+            TS_ASSERT(route.at(1) == d);
+
+            // Route to itself.
+            route = g.getShortestPath(*b, *b);
+            TS_ASSERT(route.size() == 1);
+            TS_ASSERT(route.at(0) == b);
+        }
+
+        void testCacheIsLimited() {
+            DirectedGraph g;
+
+            // Chain of vertices.
+            vector<WaypointVertex*> vertices;
+            for(uint32_t i = 0; i < 50; i++) {
+                vertices.push_back(createVertex(i + 1, i, 0));
+                if (i > 0) {
+                    g.updateEdge(vertices.at(i - 1), vertices.at(i), createEdge(1));
+                }
+            }
+
+            for(uint32_t i = 1; i < vertices.size(); i++) {
+                TS_ASSERT(g.getShortestPath(*vertices.at(0), *vertices.at(i)).size() == (i + 1));
+            }
+            TS_ASSERT(g.getNumberOfCachedRoutes() == 32);
+        }
+};
+
+#endif /*HESPERIA_DIRECTEDGRAPHTESTSUITE_H_*/
@@ -0,0 +1,111 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_LANEINDEXTESTSUITE_H_
+#define HESPERIA_LANEINDEXTESTSUITE_H_
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+#include "cxxtest/TestSuite.h"
+
+#include "core/data/environment/Point3.h"
+#include "hesperia/data/environment/NamedLine.h"
+#include "hesperia/scenario/LaneIndex.h"
+
+using namespace std;
+using namespace core::data::environment;
+using namespace hesperia::data::environment;
+using namespace hesperia::scenario;
+
+class LaneIndexTest : public CxxTest::TestSuite {
+    public:
+        double getDistance(const Point3 &p, const NamedLine &l) {
+            const double dx = l.getB().getX() - l.getA().getX();
+            const double dy = l.getB().getY() - l.getA().getY();
+            const double length2 = dx * dx + dy * dy;
+            double t = 0;
+            if (length2 > 0) {
+                t = ((p.getX() - l.getA().getX()) * dx + (p.getY() - l.getA().getY()) * dy) / length2;
+                t = (t < 0) ? 0 : ((t > 1) ? 1 : t);
+            }
+            const double x = l.getA().getX() + t * dx - p.getX();
+            const double y = l.getA().getY() + t * dy - p.getY();
+            return sqrt(x * x + y * y);
+        }
+
+        void testNearestLineMatchesBruteForce() {
+            // Grid of short segments along roads in both directions.
+            vector<NamedLine> listOfLines;
+            for(int32_t i = 0; i < 20; i++) {
+                for(int32_t j = 0; j < 20; j++) {
+                    stringstream s;
+                    s << i << "." << j;
+                    listOfLines.push_back(NamedLine(s.str(), Point3(i * 10, j * 7, 0), Point3(i * 10 + 6, j * 7 + 1, 0)));
+                }
+            }
+            // One long segment crossing many cells.
+            listOfLines.push_back(NamedLine("long", Point3(-5, -5, 0), Point3(200, 150, 0)));
+
+            LaneIndex index(listOfLines);
+            TS_ASSERT(index.getListOfLines().size() == listOfLines.size());
+
+            for(int32_t x = -30; x < 240; x += 7) {
+                for(int32_t y = -30; y < 180; y += 11) {
+                    const Point3 p(x + 0.3, y + 0.7, 0);
+
+                    double expected = 1e10;
+                    for(uint32_t k = 0; k < listOfLines.size(); k++) {
+                        const double d = getDistance(p, listOfLines.at(k));
+                        expected = (d < expected) ? d : expected;
+                    }
+
+                    NamedLine line;
+                    double distance = 0;
+                    TS_ASSERT(index.getNearestLine(p, line, distance));
+                    TS_ASSERT_DELTA(distance, expected, 1e-9);
+                    TS_ASSERT_DELTA(getDistance(p, line), expected, 1e-9);
+                }
+            }
+        }
+
+        void testNearestLineOfEmptyIndex() {
+            vector<NamedLine> listOfLines;
+            LaneIndex index(listOfLines);
+
+            NamedLine line;
+            double distance = 0;
+            TS_ASSERT(!index.getNearestLine(Point3(1, 2, 0), line, distance));
+        }
+
+        void testNearestLineOfSinglePoint() {
+            vector<NamedLine> listOfLines;
+            listOfLines.push_back(NamedLine("point", Point3(3, 4, 0), Point3(3, 4, 0)));
+            LaneIndex index(listOfLines);
+
+            NamedLine line;
+            double distance = 0;
+            TS_ASSERT(index.getNearestLine(Point3(0, 0, 5), line, distance));
+            TS_ASSERT(line.getName() == "point");
+            TS_ASSERT_DELTA(distance, 5, 1e-9);
+        }
+};
+
+#endif /*HESPERIA_LANEINDEXTESTSUITE_H_*/
@@ -0,0 +1,269 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_POLYGONTESTSUITE_H_
+#define HESPERIA_POLYGONTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <sstream>
+
+#include "core/base/Hash.h"
+#include "core/base/SerializationFactory.h"
+#include "core/base/Serializer.h"
+#include "core/data/environment/Point3.h"
+#include "hesperia/data/environment/Obstacle.h"
+#include "hesperia/data/environment/Polygon.h"
+
+using namespace std;
+using namespace core::base;
+using namespace hesperia::data;
+using namespace core::data::environment;
+using namespace hesperia::data::environment;
+
+class PolygonTest : public CxxTest::TestSuite {
+    public:
+        void testPolygonContains() {
+            Polygon p;
+            p.add(Point3(0, 0, 0));
+            p.add(Point3(4, 0, 0));
+            p.add(Point3(4, 4, 0));
+            p.add(Point3(0, 4, 0));
+
+            TS_ASSERT(p.containsIgnoreZ(Point3(2, 2, 0)));
+            TS_ASSERT(p.containsIgnoreZ(Point3(3.9, 0.1, 5)));
+            TS_ASSERT(!p.containsIgnoreZ(Point3(5, 2, 0)));
+            TS_ASSERT(!p.containsIgnoreZ(Point3(-1, -1, 0)));
+
+            Polygon empty;
+            TS_ASSERT(!empty.containsIgnoreZ(Point3(0, 0, 0)));
+        }
+
+        void testPolygonIntersectOverlapping() {
+            Polygon p1;
+            p1.add(Point3(0, 0, 0));
+            p1.add(Point3(4, 0, 0));
+            p1.add(Point3(4, 4, 0));
+            p1.add(Point3(0, 4, 0));
+
+            Polygon p2;
+            p2.add(Point3(2, 2, 0));
+            p2.add(Point3(6, 2, 0));
+            p2.add(Point3(6, 6, 0));
+            p2.add(Point3(2, 6, 0));
+
+            // Two intersection points and the vertex (2, 2) from p2.
+            Polygon result = p1.intersectIgnoreZ(p2);
+            TS_ASSERT(result.getSize() == 3);
+
+            vector<Point3> vertices = result.getVertices();
+            bool foundA = false;
+            bool foundB = false;
+            bool foundC = false;
+            for(uint32_t i = 0; i < vertices.size(); i++) {
+                foundA |= (vertices.at(i).getDistanceTo(Point3(2, 2, 0)) < 1e-6);
+                foundB |= (vertices.at(i).getDistanceTo(Point3(4, 2, 0)) < 1e-6);
+                foundC |= (vertices.at(i).getDistanceTo(Point3(2, 4, 0)) < 1e-6);
+            }
+            TS_ASSERT(foundA && foundB && foundC);
+        }
+
+        void testPolygonIntersectContained() {
+            Polygon p1;
+            p1.add(Point3(0, 0, 0));
+            p1.add(Point3(10, 0, 0));
+            p1.add(Point3(10, 10, 0));
+            p1.add(Point3(0, 10, 0));
+
+            Polygon p2;
+            p2.add(Point3(2, 2, 0));
+            p2.add(Point3(3, 2, 0));
+            p2.add(Point3(3, 3, 0));
+
+            TS_ASSERT(p1.intersectIgnoreZ(p2).getSize() == 3);
+            TS_ASSERT(p2.intersectIgnoreZ(p1).getSize() == 0);
+        }
+
+        void testPolygonIntersectSeparated() {
+            Polygon p1;
+            p1.add(Point3(0, 0, 0));
+            p1.add(Point3(4, 0, 0));
+            p1.add(Point3(0, 4, 0));
+
+            // Disjoint bounding boxes.
+            Polygon p2;
+            p2.add(Point3(10, 10, 0));
+            p2.add(Point3(12, 10, 0));
+            p2.add(Point3(10, 12, 0));
+            TS_ASSERT(p1.intersectIgnoreZ(p2).getSize() == 0);
+
+            // Overlapping bounding boxes but separated by the hypotenuse.
+            Polygon p3;
+            p3.add(Point3(3, 3, 0));
+            p3.add(Point3(4, 3, 0));
+            p3.add(Point3(4, 4, 0));
+            TS_ASSERT(p1.intersectIgnoreZ(p3).getSize() == 0);
+
+            // Edges from p4 crossing the prolongation of p1's edges must not be reported.
+            Polygon p4;
+            p4.add(Point3(5, -1, 0));
+            p4.add(Point3(6, -1, 0));
+            p4.add(Point3(6, 1, 0));
+            p4.add(Point3(5, 1, 0));
+            TS_ASSERT(p1.intersectIgnoreZ(p4).getSize() == 0);
+        }
+
+        void testPolygonSort() {
+            vector<Point3> vertices;
+            vertices.push_back(Point3(0, 0, 0));
+            vertices.push_back(Point3(4, 4, 0));
+            vertices.push_back(Point3(4, 0, 0));
+            vertices.push_back(Point3(0, 4, 0));
+
+            // Vertices are sorted counterclockwise around the center.
+            Polygon p(vertices);
+            vector<Point3> sorted = p.getVertices();
+            TS_ASSERT(sorted.size() == 4);
+            TS_ASSERT(sorted.at(0).getDistanceTo(Point3(0, 0, 0)) < 1e-6);
+            TS_ASSERT(sorted.at(1).getDistanceTo(Point3(4, 0, 0)) < 1e-6);
+            TS_ASSERT(sorted.at(2).getDistanceTo(Point3(4, 4, 0)) < 1e-6);
+            TS_ASSERT(sorted.at(3).getDistanceTo(Point3(0, 4, 0)) < 1e-6);
+        }
+
+        void testPolygonSerialization() {
+            Polygon p;
+            p.add(Point3(1, 2, 3));
+            p.add(Point3(7, 2, 6));
+            p.add(Point3(4, 8, 9));
+
+            stringstream s;
+            s << p;
+            s.flush();
+
+            Polygon p2;
+            s >> p2;
+
+            TS_ASSERT(p.toString() == p2.toString());
+            TS_ASSERT(p2.containsIgnoreZ(p.getCenter()));
+        }
+
+        void testPolygonSerializationIsExact() {
+            Polygon p;
+            for(uint32_t i = 0; i < 100; i++) {
+                p.add(Point3(i / 3.0, -i * 1e-7, 1e9 + i / 7.0));
+            }
+
+            stringstream s;
+            s << p;
+
+            Polygon p2;
+            s >> p2;
+
+            vector<Point3> vertices = p.getVertices();
+            vector<Point3> vertices2 = p2.getVertices();
+            TS_ASSERT(vertices2.size() == 100);
+            for(uint32_t i = 0; i < vertices2.size(); i++) {
+                TS_ASSERT_DELTA(vertices.at(i).getX(), vertices2.at(i).getX(), 0);
+                TS_ASSERT_DELTA(vertices.at(i).getY(), vertices2.at(i).getY(), 0);
+                TS_ASSERT_DELTA(vertices.at(i).getZ(), vertices2.at(i).getZ(), 0);
+            }
+
+            // Empty polygon.
+            stringstream s2;
+            s2 << Polygon();
+            s2 >> p2;
+            TS_ASSERT(p2.getSize() == 0);
+        }
+
+        void testPolygonDeserializationOfNestedVertices() {
+            // Layout written before vertices were packed.
+            stringstream s;
+            {
+                SerializationFactory sf;
+                Serializer &ser = sf.getSerializer(s);
+
+                uint32_t numberOfVertices = 3;
+                ser.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('n', 'u', 'm', 'v', 'e', 'r', 't', 's') >::RESULT,
+                          numberOfVertices);
+
+                stringstream sstr;
+                sstr << Point3(1, 2, 3) << Point3(7, 2, 6) << Point3(4, 8, 9);
+                ser.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('v', 'e', 'r', 't', 'i', 'c', 'e', 's') >::RESULT,
+                          sstr.str());
+            }
+
+            Polygon p;
+            s >> p;
+
+            vector<Point3> vertices = p.getVertices();
+            TS_ASSERT(vertices.size() == 3);
+            TS_ASSERT(vertices.at(0).getDistanceTo(Point3(1, 2, 3)) < 1e-6);
+            TS_ASSERT(vertices.at(1).getDistanceTo(Point3(7, 2, 6)) < 1e-6);
+            TS_ASSERT(vertices.at(2).getDistanceTo(Point3(4, 8, 9)) < 1e-6);
+            TS_ASSERT(p.containsIgnoreZ(Point3(4, 4, 0)));
+        }
+
+        void testPolygonDeserializationRejectsMismatchingNumberOfVertices() {
+            // Packed layout announcing more vertices than stored.
+            stringstream s;
+            {
+                SerializationFactory sf;
+                Serializer &ser = sf.getSerializer(s);
+
+                uint32_t numberOfVertices = 1000000;
+                ser.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('n', 'u', 'm', 'v', 'e', 'r', 't', 's') >::RESULT,
+                          numberOfVertices);
+
+                uint32_t version = 1;
+                ser.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL7('v', 'e', 'r', 's', 'i', 'o', 'n') >::RESULT,
+                          version);
+
+                const double coordinates[] = { 1, 2, 3, 4, 5, 6 };
+                ser.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL8('v', 'e', 'r', 't', 'i', 'c', 'e', 's') >::RESULT,
+                          string(reinterpret_cast<const char*>(coordinates), sizeof(coordinates)));
+            }
+
+            Polygon p;
+            p.add(Point3(1, 2, 3));
+            s >> p;
+            TS_ASSERT(p.getSize() == 0);
+        }
+
+        void testObstacleSerialization() {
+            Polygon p;
+            p.add(Point3(1, 2, 0));
+            p.add(Point3(3, 2, 0));
+            p.add(Point3(3, 4, 0));
+
+            Obstacle o;
+            o.setID(5);
+            o.setPolygon(p);
+
+            stringstream s;
+            s << o;
+
+            Obstacle o2;
+            s >> o2;
+
+            TS_ASSERT(o2.getID() == 5);
+            TS_ASSERT(o2.getPolygon().toString() == p.toString());
+        }
+};
+
+#endif /*HESPERIA_POLYGONTESTSUITE_H_*/
@@ -0,0 +1,129 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_SCNXARCHIVECACHETESTSUITE_H_
+#define HESPERIA_SCNXARCHIVECACHETESTSUITE_H_
+
+#include <fstream>
+#include <string>
+
+#include "cxxtest/TestSuite.h"
+
+#include "core/platform.h"
+#include "hesperia/data/scenario/Header.h"
+#include "hesperia/data/scenario/Scenario.h"
+#include "hesperia/data/situation/Header.h"
+#include "hesperia/data/situation/Situation.h"
+#include "hesperia/scenario/SCNXArchiveCache.h"
+
+using namespace std;
+using namespace hesperia::scenario;
+
+class SCNXArchiveCacheTest : public CxxTest::TestSuite {
+    public:
+        void testScenarioRoundTrip() {
+            const string fileName = SCNXArchiveCache::getCacheFileNameFor("SCNXArchiveCacheTest.scnx");
+            UNLINK(fileName.c_str());
+
+            hesperia::data::scenario::Header header;
+            header.setName("Test-Scenario");
+            header.setVersion("v1.0");
+            hesperia::data::scenario::Scenario scenario;
+            scenario.setHeader(header);
+
+            hesperia::data::situation::Header sitHeader;
+            sitHeader.setName("Test-Situation");
+            sitHeader.setScenario("Test-Scenario");
+            hesperia::data::situation::Situation situation;
+            situation.setHeader(sitHeader);
+
+            {
+                SCNXArchiveCache cache(fileName);
+                hesperia::data::scenario::Scenario s;
+                TS_ASSERT(!cache.getScenario("scenario.scn", "SCENARIO Test-Scenario", s));
+
+                cache.putScenario("scenario.scn", "SCENARIO Test-Scenario", scenario);
+                cache.putSituation("situations/a.sit", "SITUATION Test-Situation", situation);
+                cache.save();
+            }
+
+            {
+                SCNXArchiveCache cache(fileName);
+                hesperia::data::scenario::Scenario s;
+                TS_ASSERT(cache.getScenario("scenario.scn", "SCENARIO Test-Scenario", s));
+                TS_ASSERT(s.getHeader().getName() == "Test-Scenario");
+                TS_ASSERT(s.getHeader().getVersion() == "v1.0");
+
+                hesperia::data::situation::Situation sit;
+                TS_ASSERT(cache.getSituation("situations/a.sit", "SITUATION Test-Situation", sit));
+                TS_ASSERT(sit.getHeader().getName() == "Test-Situation");
+                TS_ASSERT(sit.getHeader().getScenario() == "Test-Scenario");
+
+                // Modified sources are stale.
+                TS_ASSERT(!cache.getScenario("scenario.scn", "SCENARIO Test-Scenario2", s));
+                TS_ASSERT(!cache.getSituation("situations/b.sit", "SITUATION Test-Situation", sit));
+            }
+
+            UNLINK(fileName.c_str());
+        }
+
+        void testSourcesWithSame32BitHashAreDistinguished() {
+            const string fileName = SCNXArchiveCache::getCacheFileNameFor("SCNXArchiveCacheTest3.scnx");
+            UNLINK(fileName.c_str());
+
+            // Both sources have the same length and the same 32-bit FNV-1a hash.
+            const string source1 = "SCENARIO anxfrw";
+            const string source2 = "SCENARIO atkexa";
+
+            hesperia::data::scenario::Header header;
+            header.setName("anxfrw");
+            hesperia::data::scenario::Scenario scenario;
+            scenario.setHeader(header);
+
+            SCNXArchiveCache cache(fileName);
+            cache.putScenario("scenario.scn", source1, scenario);
+
+            hesperia::data::scenario::Scenario s;
+            TS_ASSERT(cache.getScenario("scenario.scn", source1, s));
+            TS_ASSERT(!cache.getScenario("scenario.scn", source2, s));
+
+            UNLINK(fileName.c_str());
+        }
+
+        void testOutdatedCacheIsIgnored() {
+            const string fileName = SCNXArchiveCache::getCacheFileNameFor("SCNXArchiveCacheTest2.scnx");
+
+            {
+                fstream fout(fileName.c_str(), ios::out | ios::trunc);
+                fout << SCNXArchiveCache::MAGIC << endl
+                     << (SCNXArchiveCache::VERSION + 1) << " 1" << endl
+                     << "scenario.scn" << endl
+                     << "3 0 4" << endl
+                     << "junk" << endl;
+            }
+
+            SCNXArchiveCache cache(fileName);
+            hesperia::data::scenario::Scenario s;
+            TS_ASSERT(!cache.getScenario("scenario.scn", "abc", s));
+
+            UNLINK(fileName.c_str());
+        }
+};
+
+#endif /*HESPERIA_SCNXARCHIVECACHETESTSUITE_H_*/
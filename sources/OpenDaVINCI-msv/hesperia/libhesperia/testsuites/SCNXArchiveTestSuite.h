@@ -0,0 +1,83 @@
+/**
+ * hesperia - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_SCNXARCHIVETESTSUITE_H_
+#define HESPERIA_SCNXARCHIVETESTSUITE_H_
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "cxxtest/TestSuite.h"
+
+#include "core/platform.h"
+#include "core/SharedPointer.h"
+#include "core/io/URL.h"
+#include "hesperia/scenario/SCNXArchive.h"
+#include "hesperia/scenario/SCNXArchiveCache.h"
+#include "hesperia/scenario/SCNXArchiveFactory.h"
+
+using namespace std;
+using namespace hesperia::scenario;
+
+class SCNXArchiveTest : public CxxTest::TestSuite {
+    public:
+        void testReadingModelDataTwice() {
+            // Create scnx file containing scenario.scn and models/Axes.objx.
+            stringstream archiveData;
+            archiveData.str("80 75 3 4 20 0 0 0 8 0 -50 98 83 93 -71 -84 114 78 -41 1 0 0 -125 3 0 0 12 0 0 0 115 99 101 110 97 114 105 111 46 115 99 110 -83 83 -63 114 -101 48 16 -67 -17 87 -24 7 32 2 -101 -32 28 101 35 99 77 1 49 2 -41 -72 23 15 -82 85 67 -29 64 6 -20 58 -7 -5 72 -126 100 -36 -114 -113 -67 44 -69 122 -53 62 -67 -73 -112 45 104 66 4 -29 40 95 -49 -69 -14 -46 -12 63 -85 -85 -84 -113 -16 -99 -118 -116 -15 4 -3 113 108 12 1 -55 41 90 -54 125 119 41 -69 119 11 123 -106 -117 -15 19 112 -63 66 -106 44 56 23 1 75 84 71 -74 -51 114 26 -61 38 -52 102 -45 17 -44 99 114 90 -72 80 32 -49 -75 93 127 50 125 -100 -64 22 57 -40 -10 92 -33 -13 38 32 120 78 114 -51 -125 33 20 124 -99 4 40 -20 -38 75 115 -120 -54 119 -39 1 -95 -126 -111 -120 -59 36 -92 96 34 -86 95 -54 -93 -20 31 74 -39 -43 -27 105 -73 -87 -22 -77 -76 95 -101 -29 72 87 -96 71 -57 27 -13 45 114 -97 124 -120 -45 -76 64 -40 -10 103 -114 -21 -23 98 -5 85 40 -26 31 -118 117 69 89 -72 -54 -17 80 84 -54 -123 -22 -4 63 40 6 97 3 -111 42 99 -106 -116 -71 -91 108 -128 -104 20 -97 -112 -86 -78 -75 48 -35 44 9 33 91 -111 84 45 39 -90 -120 -68 -55 126 -121 97 -63 -29 52 -94 69 -52 3 26 -127 -119 75 22 81 -12 -46 30 -28 -87 127 -48 77 118 -69 -1 -3 6 41 -49 -104 54 117 116 127 -94 -36 -57 -54 117 12 -6 54 -97 -114 -33 5 -25 35 -9 -100 23 55 -85 -77 60 -43 -32 -35 -18 -14 78 109 121 -1 -66 -95 2 77 -126 65 61 68 100 75 5 18 109 121 104 -28 -7 -38 118 -49 -61 9 11 -112 3 95 -6 29 117 59 18 -104 96 0 -99 24 3 -30 -117 -84 78 -78 121 -3 -43 118 -121 115 127 -18 -54 -66 -105 106 64 66 77 48 -67 58 -39 -80 32 95 -95 -87 -6 98 35 -70 -52 -11 73 76 -60 55 -91 7 -19 -69 -10 89 54 -69 -85 -34 38 8 77 119 -117 -10 -19 -87 62 -116 96 -54 89 -110 15 22 -101 -71 55 -94 92 -20 104 89 -82 -81 17 -9 47 -60 -15 -11 103 61 -103 105 -59 55 19 84 101 110 -87 -98 70 -103 -87 -107 108 -99 100 -29 -97 7 31 80 75 3 4 20 0 0 0 8 0 -50 98 83 93 -16 84 -20 -125 35 0 0 0 51 0 0 0 16 0 0 0 109 111 100 101 108 115 47 65 120 101 115 46 111 98 106 120 115 -53 44 42 46 81 -56 -55 -52 75 85 -56 79 83 40 -55 72 85 -56 -51 79 73 -51 -47 -29 10 78 77 -50 -49 75 -63 38 3 0 80 75 1 2 20 3 20 0 0 0 8 0 -50 98 83 93 -71 -84 114 78 -41 1 0 0 -125 3 0 0 12 0 0 0 0 0 0 0 0 0 0 0 -128 1 0 0 0 0 115 99 101 110 97 114 105 111 46 115 99 110 80 75 1 2 20 3 20 0 0 0 8 0 -50 98 83 93 -16 84 -20 -125 35 0 0 0 51 0 0 0 16 0 0 0 0 0 0 0 0 0 0 0 -128 1 1 2 0 0 109 111 100 101 108 115 47 65 120 101 115 46 111 98 106 120 80 75 5 6 0 0 0 0 2 0 2 0 120 0 0 0 82 2 0 0 0 0");
+            int32_t data = 0;
+            fstream fout("SCNXArchiveTest.scnx", ios::binary | ios::out);
+            while (archiveData.good()) {
+                archiveData >> data;
+                fout << (char)data;
+            }
+            fout.close();
+
+            const string firstLine = "First line of the model.";
+            const string secondLine = "Second line of the model.";
+
+            SCNXArchive &archive = SCNXArchiveFactory::getInstance().getSCNXArchive(core::io::URL("file://SCNXArchiveTest.scnx"));
+            TS_ASSERT(!archive.getModelData("models/Missing.objx").isValid());
+
+            // Start reading the model...
+            core::SharedPointer<istream> first = archive.getModelData("models/Axes.objx");
+            TS_ASSERT(first.isValid());
+            string line;
+            getline(*first, line);
+            TS_ASSERT(line == firstLine);
+
+            // ...read it completely through the same archive in between...
+            core::SharedPointer<istream> second = archive.getModelData("models/Axes.objx");
+            TS_ASSERT(second.isValid());
+            getline(*second, line);
+            TS_ASSERT(line == firstLine);
+            getline(*second, line);
+            TS_ASSERT(line == secondLine);
+
+            // ...and continue where the first reader stopped.
+            getline(*first, line);
+            TS_ASSERT(line == secondLine);
+
+            UNLINK("SCNXArchiveTest.scnx");
+            UNLINK(SCNXArchiveCache::getCacheFileNameFor("SCNXArchiveTest.scnx").c_str());
+        }
+};
+
+#endif /*HESPERIA_SCNXARCHIVETESTSUITE_H_*/
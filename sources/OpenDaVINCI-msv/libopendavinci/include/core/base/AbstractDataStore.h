@@ -43,6 +43,17 @@ namespace core {
                  */
                 virtual void waitForData();
 
+                /**
+                 * This method can be called to fall asleep until new
+                 * data is available but at most for the given time.
+                 * Contrary to waitForData(), a caller can periodically
+                 * check whether it shall continue running.
+                 *
+                 * @param timeout Maximum time to sleep in milliseconds.
+                 * @return true if data is available.
+                 */
+                virtual bool waitForData(const uint32_t &timeout);
+
                 /**
                  * This method wakes all waiting threads.
                  */
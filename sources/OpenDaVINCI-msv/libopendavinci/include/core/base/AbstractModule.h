@@ -78,6 +78,16 @@ namespace core {
                  */
                 ModuleState::MODULE_STATE getModuleState();
 
+                /**
+                 * This method returns the module MODULE_STATE without
+                 * waiting for the rest of the current time slice. It is
+                 * meant for modules that are driven by incoming data
+                 * rather than by their frequency.
+                 *
+                 * @return Module MODULE_STATE.
+                 */
+                ModuleState::MODULE_STATE getModuleStateWithoutWaiting();
+
                 /**
                  * This method returns the list of created modules for
                  * this class. This method can be used to broadcast
@@ -0,0 +1,138 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_CONFIGURATIONVALUE_H_
+#define OPENDAVINCI_CORE_BASE_CONFIGURATIONVALUE_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+#include "core/base/KeyValueConfiguration.h"
+#include "core/exceptions/Exceptions.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class holds the value for one key of a KeyValueConfiguration.
+         * The key is looked up and its value is converted only once when
+         * creating this object; afterwards, the value is accessed without
+         * any string handling and cannot be changed.
+         *
+         * Thus, a module can resolve its configuration once at setup into
+         * a simple class and use its values in every cycle:
+         *
+         * @code
+         * class MyConfiguration {
+         *     public:
+         *         MyConfiguration(const KeyValueConfiguration &kvc) :
+         *             carLength(kvc, "global.carLength"),
+         *             debug(kvc, "mymodule.debug", false) {}
+         *
+         *         const ConfigurationValue<double> carLength;
+         *         const ConfigurationValue<bool> debug;
+         * };
+         *
+         * const MyConfiguration configuration(getKeyValueConfiguration());
+         * while (getModuleState() == ModuleState::RUNNING) {
+         *     double d = configuration.carLength * 2;
+         *     ...
+         * }
+         * @endcode
+         */
+        template<class T>
+        class ConfigurationValue {
+            private:
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                ConfigurationValue& operator=(const ConfigurationValue &/*obj*/);
+
+            public:
+                /**
+                 * Constructor for mandatory keys.
+                 *
+                 * @param kvc Configuration to read the value from.
+                 * @param key Key to look up.
+                 * @throws ValueForKeyNotFoundException if the key is missing.
+                 */
+                ConfigurationValue(const KeyValueConfiguration &kvc, const string &key) throw (exceptions::ValueForKeyNotFoundException) :
+                    m_value(kvc.getValue<T>(key)) {}
+
+                /**
+                 * Constructor for optional keys.
+                 *
+                 * @param kvc Configuration to read the value from.
+                 * @param key Key to look up.
+                 * @param defaultValue Value to use if the key is missing.
+                 */
+                ConfigurationValue(const KeyValueConfiguration &kvc, const string &key, const T &defaultValue) :
+                    m_value(getValueOrDefault(kvc, key, defaultValue)) {}
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                ConfigurationValue(const ConfigurationValue &obj) :
+                    m_value(obj.m_value) {}
+
+                virtual ~ConfigurationValue() {}
+
+                /**
+                 * @return The configured value.
+                 */
+                inline const T& get() const {
+                    return m_value;
+                }
+
+                /**
+                 * This operator allows to use this object like the value itself.
+                 *
+                 * @return The configured value.
+                 */
+                inline operator const T&() const {
+                    return m_value;
+                }
+
+            private:
+                static T getValueOrDefault(const KeyValueConfiguration &kvc, const string &key, const T &defaultValue) {
+                    try {
+                        return kvc.getValue<T>(key);
+                    }
+                    catch (const exceptions::ValueForKeyNotFoundException &/*e*/) {
+                        return defaultValue;
+                    }
+                }
+
+            private:
+                const T m_value;
+        };
+
+    }
+} // core::base
+
+#endif /*OPENDAVINCI_CORE_BASE_CONFIGURATIONVALUE_H_*/
@@ -54,6 +54,14 @@ namespace core {
             public:
                 FIFOQueue();
 
+                /**
+                 * Constructor.
+                 *
+                 * @param maximumSize Maximum number of elements; when a new element
+                 *                    enters a full queue, the oldest one is discarded.
+                 */
+                FIFOQueue(const uint32_t &maximumSize);
+
                 virtual ~FIFOQueue();
 
                 virtual void clear();
@@ -81,6 +89,7 @@ namespace core {
             private:
                 mutable Mutex m_mutexQueue;
                 deque<data::Container> m_queue;
+                uint32_t m_maximumSize;
         };
 
     }
@@ -0,0 +1,134 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_RATELIMITEDLOGGER_H_
+#define OPENDAVINCI_CORE_BASE_RATELIMITEDLOGGER_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+#include "core/data/TimeStamp.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class writes status messages from a module's main loop
+         * to a stream but at most once per interval. Messages arriving
+         * meanwhile are dropped and counted so that a module can report
+         * its state in every cycle without flooding the console:
+         *
+         * @code
+         * RateLimitedLogger logger(cout, 1000);
+         * while (getModuleState() == ModuleState::RUNNING) {
+         *     TimeStamp now;
+         *     if (logger.isDue(now)) {
+         *         stringstream s;
+         *         s << "Current state: " << state;
+         *         logger.log(now, s.str());
+         *     }
+         *
+         *     if (stateChanged) {
+         *         logger.logEvent("New state.");
+         *     }
+         * }
+         * @endcode
+         */
+        class OPENDAVINCI_API RateLimitedLogger {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                RateLimitedLogger(const RateLimitedLogger &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                RateLimitedLogger& operator=(const RateLimitedLogger &/*obj*/);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param out Stream to write to.
+                 * @param interval Minimum time between two messages in milliseconds.
+                 */
+                RateLimitedLogger(ostream &out, const uint32_t &interval);
+
+                virtual ~RateLimitedLogger();
+
+                /**
+                 * This method returns true if the next message passed
+                 * to log(...) would be written. It can be used to avoid
+                 * composing messages which would be dropped anyway.
+                 *
+                 * @param now Current time.
+                 * @return true if a message would be written at now.
+                 */
+                bool isDue(const core::data::TimeStamp &now) const;
+
+                /**
+                 * This method writes the message if the interval since
+                 * the last written message has elapsed; otherwise, the
+                 * message is dropped. The number of messages dropped
+                 * meanwhile is appended to the next written message.
+                 *
+                 * @param now Current time.
+                 * @param message Message to write.
+                 */
+                void log(const core::data::TimeStamp &now, const string &message);
+
+                /**
+                 * This method writes the message regardless of the
+                 * interval. It is meant for rare events like state
+                 * changes and does not delay the next call to log(...).
+                 *
+                 * @param message Message to write.
+                 */
+                void logEvent(const string &message);
+
+                /**
+                 * @return Number of messages dropped so far.
+                 */
+                uint32_t getNumberOfSuppressedMessages() const;
+
+            private:
+                ostream &m_out;
+                long m_interval;
+                bool m_hasLogged;
+                core::data::TimeStamp m_lastLog;
+                uint32_t m_suppressedSinceLastLog;
+                uint32_t m_numberOfSuppressedMessages;
+        };
+
+    }
+} // core::base
+
+#endif /*OPENDAVINCI_CORE_BASE_RATELIMITEDLOGGER_H_*/
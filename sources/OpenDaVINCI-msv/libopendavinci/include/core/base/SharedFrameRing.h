@@ -0,0 +1,257 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_SHAREDFRAMERING_H_
+#define OPENDAVINCI_CORE_BASE_SHAREDFRAMERING_H_
+
+// core/platform.h must be included to setup platform-dependent header files and configurations.
+#include "core/platform.h"
+
+#include "core/SharedPointer.h"
+#include "core/wrapper/SharedMemory.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class organizes a shared memory segment as a ring of
+         * frame slots for one producer and many consumers. Every slot
+         * carries a sequence counter which is odd while the producer
+         * writes into the slot; consumers copy the most recently
+         * published slot and retry if its sequence counter changed
+         * meanwhile. Thus, neither side ever waits for the other and
+         * a slow consumer simply skips frames.
+         *
+         * Producer:
+         *
+         * @code
+         * SharedPointer<SharedMemory> memory = SharedMemoryFactory::createSharedMemory(name, SharedFrameRing::getRequiredSize(size, 3));
+         * SharedFrameRing ring(memory, size, 3);
+         * ...
+         * char *dest = ring.beginWrite();
+         * // Fill dest with up to ring.getFrameSize() bytes.
+         * ring.endWrite();
+         * @endcode
+         *
+         * Consumer:
+         *
+         * @code
+         * SharedFrameRing ring(SharedMemoryFactory::attachToSharedMemory(name));
+         * uint32_t frameNumber = 0;
+         * if (ring.read(dest, size, frameNumber)) {
+         *     ...
+         * }
+         * @endcode
+         *
+         * If the attached segment was not created as frame ring (for
+         * example by the player replaying a recording), read() falls
+         * back to lock the segment and to copy it entirely.
+         */
+        class OPENDAVINCI_API SharedFrameRing {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                SharedFrameRing(const SharedFrameRing &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                SharedFrameRing& operator=(const SharedFrameRing &);
+
+            public:
+                enum {
+                    DEFAULT_NUMBER_OF_SLOTS = 3
+                };
+
+                /**
+                 * This method returns the size of a shared memory segment
+                 * that is required to hold the given number of frames.
+                 *
+                 * @param frameSize Size of one frame in bytes.
+                 * @param numberOfSlots Number of frames in the ring.
+                 * @return Required size of the shared memory segment.
+                 */
+                static uint32_t getRequiredSize(const uint32_t &frameSize, const uint32_t &numberOfSlots);
+
+                /**
+                 * Constructor for the producer. The shared memory segment
+                 * is formatted as frame ring and must therefore be at least
+                 * getRequiredSize(frameSize, numberOfSlots) bytes large.
+                 *
+                 * @param memory Shared memory segment created by this process.
+                 * @param frameSize Size of one frame in bytes.
+                 * @param numberOfSlots Number of frames in the ring (at least 2).
+                 */
+                SharedFrameRing(core::SharedPointer<core::wrapper::SharedMemory> memory, const uint32_t &frameSize, const uint32_t &numberOfSlots);
+
+                /**
+                 * Constructor for consumers.
+                 *
+                 * @param memory Shared memory segment attached by this process.
+                 */
+                SharedFrameRing(core::SharedPointer<core::wrapper::SharedMemory> memory);
+
+                virtual ~SharedFrameRing();
+
+                /**
+                 * @return true if the underlying shared memory segment is usable.
+                 */
+                bool isValid() const;
+
+                /**
+                 * @return true if the shared memory segment is organized as frame ring.
+                 */
+                bool isFrameRing() const;
+
+                /**
+                 * @return Size of one frame in bytes.
+                 */
+                uint32_t getFrameSize() const;
+
+                /**
+                 * @return Number of slots in the ring.
+                 */
+                uint32_t getNumberOfSlots() const;
+
+                /**
+                 * @return Number of the most recently published frame (0 if no frame was published yet).
+                 */
+                uint32_t getLatestFrameNumber() const;
+
+                /**
+                 * This method returns the slot to be filled by the producer.
+                 * The slot is not visible to consumers until endWrite()
+                 * is called.
+                 *
+                 * @return Pointer to getFrameSize() bytes or NULL if this ring is not writable.
+                 */
+                char* beginWrite();
+
+                /**
+                 * This method publishes the slot returned by beginWrite()
+                 * as latest frame.
+                 */
+                void endWrite();
+
+                /**
+                 * This method copies the latest frame without blocking
+                 * the producer.
+                 *
+                 * @param dest Destination to copy the frame to.
+                 * @param size Maximum number of bytes to copy.
+                 * @param frameNumber Number of the copied frame.
+                 * @return true if a consistent frame was copied.
+                 */
+                bool read(char *dest, const uint32_t &size, uint32_t &frameNumber);
+
+                /**
+                 * This method grants read access to the latest frame in
+                 * place, i.e. without copying it. The access must be
+                 * short and finished by endRead(): Frame rings are not
+                 * blocked meanwhile but can overwrite the frame, which is
+                 * reported by endRead(); plain shared memory segments are
+                 * locked until endRead() is called.
+                 *
+                 * @code
+                 * uint32_t frameNumber = 0;
+                 * const char *data = ring.beginRead(frameNumber);
+                 * if (data != NULL) {
+                 *     // Use up to ring.getFrameSize() bytes from data.
+                 *     if (ring.endRead()) {
+                 *         // data was consistent.
+                 *     }
+                 * }
+                 * @endcode
+                 *
+                 * @param frameNumber Number of the frame.
+                 * @return Pointer to getFrameSize() bytes or NULL if no frame is available.
+                 */
+                const char* beginRead(uint32_t &frameNumber);
+
+                /**
+                 * This method returns the slot holding the latest frame to
+                 * access it later using beginRead(slot, frameNumber).
+                 *
+                 * @param slot Slot of the latest frame.
+                 * @param frameNumber Number of the latest frame.
+                 * @return true if a frame was published already.
+                 */
+                bool getLatestFrame(uint32_t &slot, uint32_t &frameNumber) const;
+
+                /**
+                 * This method grants read access to the given frame in
+                 * place like beginRead(frameNumber) but fails if the
+                 * producer has overwritten the slot with another frame
+                 * meanwhile. For plain shared memory segments, slot and
+                 * frameNumber are ignored.
+                 *
+                 * @param slot Slot as returned by getLatestFrame().
+                 * @param frameNumber Number of the frame as returned by getLatestFrame().
+                 * @return Pointer to getFrameSize() bytes or NULL if the frame is not available anymore.
+                 */
+                const char* beginRead(const uint32_t &slot, const uint32_t &frameNumber);
+
+                /**
+                 * This method finishes the access started by beginRead().
+                 *
+                 * @return true if the frame was not modified during the access.
+                 */
+                bool endRead();
+
+            private:
+                /**
+                 * This method enforces the ordering of the accesses to the
+                 * shared memory segment between producer and consumers.
+                 */
+                static void memoryBarrier();
+
+                volatile uint32_t* getHeader() const;
+
+                volatile uint32_t* getSlot(const uint32_t &slot) const;
+
+            private:
+                core::SharedPointer<core::wrapper::SharedMemory> m_memory;
+                bool m_isFrameRing;
+                bool m_isProducer;
+                uint32_t m_frameSize;
+                uint32_t m_numberOfSlots;
+                uint32_t m_slotStride;
+                uint32_t m_writeSlot;
+                uint32_t m_frameCounter;
+                bool m_isReading;
+                uint32_t m_readSlot;
+                uint32_t m_readSequence;
+        };
+
+    }
+} // core::base
+
+#endif /*OPENDAVINCI_CORE_BASE_SHAREDFRAMERING_H_*/
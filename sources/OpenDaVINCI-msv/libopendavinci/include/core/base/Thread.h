@@ -24,6 +24,10 @@
 #include "core/platform.h"
 
 namespace core {
+    namespace data {
+        class TimeStamp;
+    }
+
     namespace base {
 
         /**
@@ -37,6 +41,16 @@ namespace core {
                  * @param microseconds Time to sleep.
                  */
                 static void usleep(const long &microseconds);
+
+                /**
+                 * This method sleeps until the specified point in time
+                 * has been reached. Contrary to consecutive calls to usleep,
+                 * waiting for absolute points in time does not accumulate
+                 * any scheduling errors.
+                 *
+                 * @param deadline Point in time to wake up.
+                 */
+                static void usleepUntil(const core::data::TimeStamp &deadline);
         };
 
     }
@@ -119,6 +119,14 @@ namespace core {
                  */
                 DATATYPE getDataType() const;
 
+                /**
+                 * This method returns the size of the serialized data
+                 * contained in this container without copying it.
+                 *
+                 * @return Size of the contained data in bytes.
+                 */
+                uint32_t getSerializedDataSize() const;
+
                 virtual ostream& operator<<(ostream &out) const;
                 virtual istream& operator>>(istream &in);
 
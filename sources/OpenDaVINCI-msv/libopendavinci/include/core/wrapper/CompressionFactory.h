@@ -57,6 +57,16 @@ namespace core {
         struct OPENDAVINCI_API CompressionFactory
         {
             static DecompressedData* getContents(istream &in);
+
+            /**
+             * This method reads the compressed file directly without
+             * buffering its contents; entries are decompressed when
+             * they are requested for the first time.
+             *
+             * @param fileName Compressed file.
+             * @return Decompressed data or NULL.
+             */
+            static DecompressedData* getContents(const string &fileName);
         };
 
     }
@@ -49,6 +49,15 @@ namespace core {
              * @return Compressed file based on the type of instance this factory is.
              */
             static DecompressedData* getContents(istream &in);
+
+            /**
+             * This method creates a DecompressedData object based on a given
+             * file. Entries are decompressed on demand.
+             *
+             * @param fileName The file from which the compressed data should be read.
+             * @return Compressed file based on the type of instance this factory is.
+             */
+            static DecompressedData* getContents(const string &fileName);
         };
 
     }
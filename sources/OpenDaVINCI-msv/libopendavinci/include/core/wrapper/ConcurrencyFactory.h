@@ -52,6 +52,17 @@ namespace core {
              * @param microseconds Time to sleep in ms.
              */
             static void usleep(const long &microseconds);
+
+            /**
+             * This method causes the calling thread to sleep until the
+             * specified absolute point in time, measured with the same
+             * clock as TimeFactory::now(). It returns immediately if the
+             * point in time has already passed.
+             *
+             * @param seconds Seconds of the point in time to wake up.
+             * @param partialMicroseconds Partial microseconds of the point in time to wake up.
+             */
+            static void usleepUntil(const long &seconds, const long &partialMicroseconds);
         };
 
     }
@@ -48,7 +48,8 @@ namespace core {
                 /**
                  * This method returns an input stream for
                  * one specific entry. The look up for the specified
-                 * entry is done case insensitively.
+                 * entry is done case insensitively. The returned
+                 * stream is positioned at its beginning.
                  *
                  * @return Input stream or NULL if the specified file could not be found.
                  */
@@ -57,6 +57,32 @@ namespace core {
 
                     nanosleep(&delay, NULL);
                 };
+
+                static void usleepUntil(const long &seconds, const long &partialMicroseconds)
+                {
+                    const long NANOSECONDS_PER_SECOND = 1000 * 1000 * 1000;
+
+                    struct timespec deadline;
+                    deadline.tv_sec = seconds;
+                    deadline.tv_nsec = partialMicroseconds * 1000;
+                    while (deadline.tv_nsec >= NANOSECONDS_PER_SECOND) {
+                        deadline.tv_nsec -= NANOSECONDS_PER_SECOND;
+                        deadline.tv_sec++;
+                    }
+
+#ifdef HAVE_LINUX_RT
+                    // TimeFactory::now() uses gettimeofday(), i.e. CLOCK_REALTIME.
+                    while (clock_nanosleep(CLOCK_REALTIME, TIMER_ABSTIME, &deadline, NULL) == EINTR) {}
+#else
+                    struct timeval now;
+                    gettimeofday(&now, NULL);
+
+                    const long remaining = (deadline.tv_sec - now.tv_sec) * 1000 * 1000 + (deadline.tv_nsec / 1000 - now.tv_usec);
+                    if (remaining > 0) {
+                        usleep(remaining);
+                    }
+#endif
+                };
         };
     }
 } // core::wrapper::POSIX
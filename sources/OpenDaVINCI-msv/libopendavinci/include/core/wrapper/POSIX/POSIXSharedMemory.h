@@ -33,7 +33,16 @@ namespace core {
         namespace POSIX {
 
             /**
-             * This class implements a shared memory using POSIX.
+             * This class implements a shared memory using POSIX. If
+             * available, the segment is created with shm_open/mmap;
+             * otherwise, a SysV segment is used whose key is derived
+             * from the CRC32 of its name.
+             *
+             * Every segment starts with a header containing a magic
+             * number, the usable size, and the segment's name. The
+             * header is used to detect SysV key collisions between
+             * differently named segments and to attach to an existing
+             * segment with one single mapping.
              *
              * @See SharedMemory.
              */
@@ -87,13 +96,58 @@ namespace core {
                     virtual uint32_t getSize() const;
 
                 private:
-                    string m_name;
-                    string m_internalName;
-                    bool m_releaseSharedMemory;
-                    int32_t m_shmID;
-                    sem_t* m_mutexSharedMemory;
-                    void *m_sharedMemory;
-                    uint32_t m_size;
+                    /**
+                     * This method opens the semaphore protecting the segment.
+                     *
+                     * @param create true if the semaphore shall be created.
+                     * @return true if the semaphore is available.
+                     */
+                    bool openSemaphore(const bool &create);
+
+                    /**
+                     * This method creates and maps a segment using shm_open.
+                     *
+                     * @return true if the segment is available.
+                     */
+                    bool createMappedSegment();
+
+                    /**
+                     * This method maps an existing segment created by shm_open.
+                     *
+                     * @return true if the segment is available.
+                     */
+                    bool attachMappedSegment();
+
+                    /**
+                     * This method creates a SysV segment and probes subsequent
+                     * keys if the key derived from the name is already used
+                     * by a segment with a different name.
+                     *
+                     * @return true if the segment is available.
+                     */
+                    bool createSysVSegment();
+
+                    /**
+                     * This method attaches to an existing SysV segment.
+                     *
+                     * @return true if the segment is available.
+                     */
+                    bool attachSysVSegment();
+
+                    /**
+                     * This method writes the header to a newly created segment.
+                     */
+                    void writeHeader();
+
+                    /**
+                     * This method checks whether the given memory starts
+                     * with a header carrying this segment's name.
+                     *
+                     * @param memory Pointer to the beginning of the segment.
+                     * @param length Length of the segment.
+                     * @return true if the header matches.
+                     */
+                    bool hasMatchingHeader(const void *memory, const size_t &length) const;
 
                     /**
                      * This method computes a CRC32 hash for the given string.
@@ -101,7 +155,19 @@ namespace core {
                      * @param s String for which the CRC32 hash value should be computed.
                      * @retval CRC32 hash value.
                      */
-                    uint32_t getCRC32(const string &s) const;
+                    static uint32_t getCRC32(const string &s);
+
+                private:
+                    string m_name;
+                    string m_internalName;
+                    bool m_releaseSharedMemory;
+                    bool m_isMapped;
+                    int32_t m_shmID;
+                    sem_t* m_mutexSharedMemory;
+                    void *m_sharedMemory;
+                    uint32_t m_headerSize;
+                    size_t m_mappedSize;
+                    uint32_t m_size;
             };
 
         }
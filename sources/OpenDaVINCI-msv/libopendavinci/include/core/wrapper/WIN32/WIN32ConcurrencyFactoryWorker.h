@@ -45,6 +45,11 @@ namespace core {
 
 				static void usleep(const long &microseconds) {
 					std::this_thread::sleep_until(std::chrono::steady_clock::now() + std::chrono::microseconds(microseconds));
+                };
+
+				static void usleepUntil(const long &seconds, const long &partialMicroseconds) {
+					// WIN32Time is based on the system_clock.
+					std::this_thread::sleep_until(std::chrono::system_clock::time_point(std::chrono::seconds(seconds) + std::chrono::microseconds(partialMicroseconds)));
                 };
         };
     }
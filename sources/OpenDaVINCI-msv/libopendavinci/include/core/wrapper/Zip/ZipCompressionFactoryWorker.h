@@ -36,6 +36,11 @@ namespace core {
             {
                 return new Zip::ZipDecompressedData(in);
             };
+
+            static DecompressedData* getContents(const string &fileName)
+            {
+                return new Zip::ZipDecompressedData(fileName);
+            };
         };
 
     }
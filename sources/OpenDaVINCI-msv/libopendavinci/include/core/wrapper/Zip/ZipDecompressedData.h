@@ -24,11 +24,15 @@
 #include "core/platform.h"
 
 #include "core/wrapper/DecompressedData.h"
+#include "core/wrapper/Mutex.h"
 #include "core/wrapper/StringComparator.h"
 
 #include "core/wrapper/CompressionFactoryWorker.h"
 #include "core/wrapper/CompressionLibraryProducts.h"
 
+// Forward declaration to avoid including libzip's header.
+struct zip;
+
 namespace core {
     namespace wrapper {
         namespace Zip {
@@ -38,6 +42,9 @@ namespace core {
             /**
              * This class implements an abstract object containing
              * the decompressed contents of a compressed archive.
+             * Only the archive's directory is read on construction;
+             * an entry is decompressed when it is requested for the
+             * first time.
              *
              * @See DecompressedData.
              */
@@ -51,12 +58,21 @@ namespace core {
                     friend struct CompressionFactoryWorker<CompressionLibraryZIP>;
 
                     /**
-                     * Constructor.
+                     * Constructor. As libzip reads from files only, the
+                     * stream is buffered in a temporary file which is
+                     * removed on destruction.
                      *
                      * @param in Stream to be used for reading the contents.
                      */
                     ZipDecompressedData(istream &in);
 
+                    /**
+                     * Constructor.
+                     *
+                     * @param fileName Archive to be read.
+                     */
+                    ZipDecompressedData(const string &fileName);
+
                 private:
                     /**
                      * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -80,15 +96,27 @@ namespace core {
                     virtual istream* getInputStreamFor(const string &entry);
 
                 private:
+                    struct zip *m_archive;
+                    string m_temporaryFileName;
+                    auto_ptr<Mutex> m_mutex;
+                    map<string, int32_t, StringComparator> m_mapOfEntries; // Name of an entry and its index in the archive.
                     map<string, stringstream*, StringComparator> m_mapOfDecompressedEntries;
 
                     /**
-                     * This method tries to decompress the given archive and
-                     * read the complete content into memory.
+                     * This method opens the given archive and reads
+                     * the names of all entries.
                      *
-                     * @param in Stream to be used for reading the contents.
+                     * @param fileName Archive to be read.
+                     */
+                    void openArchive(const string &fileName);
+
+                    /**
+                     * This method decompresses the given entry.
+                     *
+                     * @param index Index of the entry in the archive.
+                     * @return Stream containing the decompressed entry or NULL.
                      */
-                    void decompressData(istream &in);
+                    stringstream* decompressEntry(const int32_t &index);
             };
 
         }
@@ -32,6 +32,8 @@ namespace tools {
             uint32_t m_size;
             uint32_t m_consumedSize;
             uint32_t m_id;
+            uint32_t m_slot;
+            uint32_t m_frameNumber;
 
         public:
             /**
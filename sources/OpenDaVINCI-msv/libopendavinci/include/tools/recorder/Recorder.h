@@ -70,6 +70,22 @@ namespace tools {
                  */
                 Recorder(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading);
 
+                /**
+                 * Constructor.
+                 *
+                 * @param url URL of the resource to be used for writing containers to.
+                 * @param memorySegmentSize Cf. constructor above; only used if recordInPlace is false.
+                 * @param numberOfSegments Cf. constructor above; if recordInPlace is true, maximum number of frames waiting to be written.
+                 * @param threading Cf. constructor above.
+                 * @param recordInPlace If true, SharedImages and SharedData are written directly from their
+                 *                      shared memory segments to disk instead of being copied into memory
+                 *                      segments first; this saves one copy per frame and the buffers. The
+                 *                      frame that was latest during store() is written when the writer gets
+                 *                      to it, i.e. in its own thread if threading is true, during store()
+                 *                      otherwise; it is dropped if its producer has overwritten it meanwhile.
+                 */
+                Recorder(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &recordInPlace);
+
                 virtual ~Recorder();
 
                 /**
@@ -104,6 +120,9 @@ namespace tools {
                  */
                 void store(core::data::Container c);
 
+            private:
+                void createOutputs(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &recordInPlace);
+
             private:
                 core::base::FIFOQueue m_fifo;
                 SharedDataListener *m_sharedDataListener;
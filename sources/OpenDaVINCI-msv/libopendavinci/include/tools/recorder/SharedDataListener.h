@@ -26,6 +26,7 @@
 #include "core/SharedPointer.h"
 #include "core/base/ConferenceClientModule.h"
 #include "core/base/FIFOQueue.h"
+#include "core/base/SharedFrameRing.h"
 #include "core/data/Container.h"
 #include "core/data/SerializableData.h"
 #include "core/data/SharedData.h"
@@ -72,8 +73,9 @@ namespace tools {
                  * @param memorySegmentSize Size of one memory segment.
                  * @param numberOfMemorySegments Number of available memory segments.
                  * @param threading Cf. constructor of Recorder.
+                 * @param recordInPlace Cf. constructor of Recorder.
                  */
-                SharedDataListener(ostream &out, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading);
+                SharedDataListener(ostream &out, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading, const bool &recordInPlace);
 
                 virtual ~SharedDataListener();
 
@@ -85,6 +87,16 @@ namespace tools {
 
                 virtual bool isEmpty() const;
 
+                /**
+                 * @return Number of SharedData and SharedImages recorded so far.
+                 */
+                uint32_t getNumberOfRecordedSharedMemories() const;
+
+                /**
+                 * @return Number of SharedData and SharedImages dropped so far.
+                 */
+                uint32_t getNumberOfDroppedSharedMemories() const;
+
             private:
                 /**
                  * This method copies the data pointed to by SharedData
@@ -96,8 +108,23 @@ namespace tools {
                  */
                 bool copySharedMemoryToMemorySegment(const string &name, const core::data::Container &header);
 
+                /**
+                 * This method hands the given SharedData or SharedImage
+                 * together with the currently latest frame of its shared
+                 * memory to the SharedDataWriter, which writes exactly
+                 * this frame directly from the shared memory to the output
+                 * stream. At most as many entries as memory segments would
+                 * be used for copying are pending.
+                 *
+                 * @param name Name of SharedPointer to be used.
+                 * @param header Container that contains the meta-data for this shared memory segment which shall be used as header in the file.
+                 * @return true if the entry was accepted.
+                 */
+                bool enqueueForWritingInPlace(const string &name, const core::data::Container &header);
+
             private:
                 bool m_threading;
+                bool m_recordInPlace;
                 SharedDataWriter *m_sharedDataWriter;
                 map<string, core::data::SharedData> m_mapOfAvailableSharedData;
                 map<string, core::data::image::SharedImage> m_mapOfAvailableSharedImages;
@@ -107,9 +134,11 @@ namespace tools {
                 core::base::FIFOQueue m_bufferIn;
                 core::base::FIFOQueue m_bufferOut;
 
+                uint32_t m_maximumPendingEntries;
+                uint32_t m_recordedSharedMemories;
                 uint32_t m_droppedSharedMemories;
 
-                map<string, core::SharedPointer<core::wrapper::SharedMemory> > m_sharedPointers;
+                map<string, core::SharedPointer<core::base::SharedFrameRing> > m_sharedPointers;
 
                 ostream &m_out;
         };
@@ -22,10 +22,16 @@
 
 #include <iostream>
 #include <map>
+#include <string>
 
+#include "core/SharedPointer.h"
 #include "core/base/Mutex.h"
 #include "core/base/Service.h"
 #include "core/base/FIFOQueue.h"
+#include "core/base/SharedFrameRing.h"
+#include "core/data/Container.h"
+
+#include "tools/MemorySegment.h"
 
 namespace tools {
 
@@ -35,6 +41,9 @@ namespace tools {
 
         /**
          * This class writes the FIFO of MemorySegments to an outstream.
+         * MemorySegments without memory in this FIFO are written in
+         * place instead: the frame of the shared memory announced by
+         * their header is written straight from the shared memory.
          */
         class SharedDataWriter : public core::base::Service {
             private:
@@ -69,7 +78,33 @@ namespace tools {
 
                 void recordEntries();
 
+                /**
+                 * This method registers a shared memory to be written
+                 * in place.
+                 *
+                 * @param name Name of the shared memory.
+                 * @param ring Access to the shared memory.
+                 */
+                void addSharedMemory(const string &name, core::SharedPointer<core::base::SharedFrameRing> ring);
+
+                /**
+                 * @return Number of entries to be written in place that could not be written.
+                 */
+                uint32_t getNumberOfFailedEntries() const;
+
             private:
+                /**
+                 * This method writes the frame of the shared memory
+                 * described by the given entry directly from the shared
+                 * memory to the output stream. Large writes bypass the
+                 * stream's buffer (libstdc++ passes its buffered header
+                 * and the data together to writev()).
+                 *
+                 * @param ms Entry with the header to be written and the slot and number of the frame to be written.
+                 * @return true if the frame was written; false if it was overwritten by its producer meanwhile.
+                 */
+                bool writeSharedMemoryToStream(const MemorySegment &ms);
+
                 virtual void beforeStop();
 
                 virtual void run();
@@ -81,6 +116,12 @@ namespace tools {
 
                 core::base::FIFOQueue &m_bufferIn;
                 core::base::FIFOQueue &m_bufferOut;
+
+                core::base::Mutex m_sharedPointersMutex;
+                map<string, core::SharedPointer<core::base::SharedFrameRing> > m_sharedPointers;
+
+                mutable core::base::Mutex m_failedEntriesMutex;
+                uint32_t m_failedEntries;
         };
 
     } // recorder
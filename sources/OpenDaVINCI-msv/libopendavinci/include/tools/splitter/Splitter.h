@@ -21,6 +21,11 @@
 #define OPENDAVINCI_TOOLS_SPLITTER_SPLITTER_H_
 
 #include <string>
+#include <vector>
+
+#include "core/data/Container.h"
+
+#include "tools/splitter/SplitterOutput.h"
 
 namespace tools {
     namespace splitter {
@@ -66,6 +71,29 @@ namespace tools {
                  * @param end End container (including) in the splitting.
                  */
                 void process(const string &source, const uint32_t &memorySegmentSize, const uint32_t &start, const uint32_t &end);
+
+                /**
+                 * This method processes the given source file in one single
+                 * pass and stores each container into all outputs accepting it.
+                 * Data from shared memory segments is copied directly from the
+                 * source's .mem file to the outputs' .mem files without
+                 * replaying it through a shared memory.
+                 *
+                 * @param source Recording file to be split.
+                 * @param outputs List of outputs to be created.
+                 * @return Number of processed containers.
+                 */
+                uint32_t process(const string &source, const vector<SplitterOutput> &outputs);
+
+            private:
+                /**
+                 * This method returns the size of the shared memory segment
+                 * described by the given container.
+                 *
+                 * @param c Container describing a SharedData or SharedImage.
+                 * @return Size of the shared memory segment.
+                 */
+                uint32_t getSizeOfSharedMemory(core::data::Container &c) const;
         };
 
     } // splitter
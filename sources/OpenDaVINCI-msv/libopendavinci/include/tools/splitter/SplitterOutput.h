@@ -0,0 +1,140 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_TOOLS_SPLITTER_SPLITTEROUTPUT_H_
+#define OPENDAVINCI_TOOLS_SPLITTER_SPLITTEROUTPUT_H_
+
+#include <set>
+#include <string>
+
+#include "core/data/Container.h"
+#include "core/data/TimeStamp.h"
+
+namespace tools {
+    namespace splitter {
+
+        using namespace std;
+
+        /**
+         * This class describes one output file to be created by the
+         * Splitter. An output selects containers by their index in the
+         * recording, by their received time stamp relative to the first
+         * container in the recording, and by their data type. All
+         * criteria that are set must be fulfilled; criteria that are
+         * not set accept all containers.
+         */
+        class SplitterOutput {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param url URL of the .rec file to be written; shared memory dumps are written to url + ".mem".
+                 */
+                SplitterOutput(const string &url);
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                SplitterOutput(const SplitterOutput &obj);
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                SplitterOutput& operator=(const SplitterOutput &obj);
+
+                virtual ~SplitterOutput();
+
+                /**
+                 * This method returns the URL of the .rec file to be written.
+                 *
+                 * @return URL of the output file.
+                 */
+                const string getURL() const;
+
+                /**
+                 * This method restricts this output to the containers between
+                 * and including start and end.
+                 *
+                 * @param start First container to be stored.
+                 * @param end Last container (including) to be stored.
+                 */
+                void setContainerRange(const uint32_t &start, const uint32_t &end);
+
+                /**
+                 * This method restricts this output to the containers received
+                 * between and including start and end; both time stamps are
+                 * relative to the first container in the recording.
+                 *
+                 * @param start Begin of the time range.
+                 * @param end End of the time range.
+                 */
+                void setTimeRange(const core::data::TimeStamp &start, const core::data::TimeStamp &end);
+
+                /**
+                 * This method adds a data type to be stored by this output.
+                 * If no data type is added, all data types are stored.
+                 *
+                 * @param dataType Data type to be stored.
+                 */
+                void addDataType(const core::data::Container::DATATYPE &dataType);
+
+                /**
+                 * This method returns true if the given container shall be
+                 * stored by this output.
+                 *
+                 * @param index Index of the container in the recording.
+                 * @param relativeTime Received time stamp relative to the first container.
+                 * @param dataType Data type of the container.
+                 * @return true if the container shall be stored.
+                 */
+                bool accept(const uint32_t &index, const core::data::TimeStamp &relativeTime, const core::data::Container::DATATYPE &dataType) const;
+
+                /**
+                 * This method returns true if no further container following
+                 * the given one can be accepted by this output.
+                 *
+                 * @param index Index of the container in the recording.
+                 * @param relativeTime Received time stamp relative to the first container.
+                 * @return true if this output is completed.
+                 */
+                bool isCompleted(const uint32_t &index, const core::data::TimeStamp &relativeTime) const;
+
+            private:
+                string m_url;
+
+                bool m_hasContainerRange;
+                uint32_t m_start;
+                uint32_t m_end;
+
+                bool m_hasTimeRange;
+                core::data::TimeStamp m_startTime;
+                core::data::TimeStamp m_endTime;
+
+                set<int32_t> m_dataTypes;
+        };
+
+    } // splitter
+} // tools
+
+#endif /*OPENDAVINCI_TOOLS_SPLITTER_SPLITTEROUTPUT_H_*/
@@ -35,6 +35,14 @@ namespace core {
             }
         }
 
+        bool AbstractDataStore::waitForData(const uint32_t &timeout) {
+            Lock l(m_condition);
+            if (isEmpty()) {
+                m_condition.waitOnSignalWithTimeout(timeout);
+            }
+            return !isEmpty();
+        }
+
         void AbstractDataStore::wait() {
           Lock l(m_condition);
           m_condition.waitOnSignal();
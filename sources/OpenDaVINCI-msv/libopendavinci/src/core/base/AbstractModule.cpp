@@ -130,6 +130,10 @@ namespace core {
         ModuleState::MODULE_STATE AbstractModule::getModuleState() {
             calledGetModuleState();
 
+            return getModuleStateWithoutWaiting();
+        }
+
+        ModuleState::MODULE_STATE AbstractModule::getModuleStateWithoutWaiting() {
             Lock l(m_moduleStateMutex);
             return m_moduleState;
         }
@@ -27,7 +27,13 @@ namespace core {
 
         FIFOQueue::FIFOQueue() :
                 m_mutexQueue(),
-                m_queue() {}
+                m_queue(),
+                m_maximumSize(numeric_limits<uint32_t>::max()) {}
+
+        FIFOQueue::FIFOQueue(const uint32_t &maximumSize) :
+                m_mutexQueue(),
+                m_queue(),
+                m_maximumSize(maximumSize) {}
 
         FIFOQueue::~FIFOQueue() {
             wakeAll();
@@ -45,6 +51,9 @@ namespace core {
             {
                 Lock l(m_mutexQueue);
                 m_queue.push_back(container);
+                while (m_queue.size() > m_maximumSize) {
+                    m_queue.pop_front();
+                }
             }
             wakeAll();
         }
@@ -0,0 +1,71 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <ostream>
+
+#include "core/base/RateLimitedLogger.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+        using namespace data;
+
+        RateLimitedLogger::RateLimitedLogger(ostream &out, const uint32_t &interval) :
+            m_out(out),
+            m_interval(static_cast<long>(interval) * 1000),
+            m_hasLogged(false),
+            m_lastLog(),
+            m_suppressedSinceLastLog(0),
+            m_numberOfSuppressedMessages(0) {}
+
+        RateLimitedLogger::~RateLimitedLogger() {}
+
+        bool RateLimitedLogger::isDue(const TimeStamp &now) const {
+            return (!m_hasLogged || ((now - m_lastLog).toMicroseconds() >= m_interval));
+        }
+
+        void RateLimitedLogger::log(const TimeStamp &now, const string &message) {
+            if (isDue(now)) {
+                m_out << message;
+                if (m_suppressedSinceLastLog > 0) {
+                    m_out << " (" << m_suppressedSinceLastLog << " messages suppressed)";
+                }
+                m_out << endl;
+
+                m_hasLogged = true;
+                m_lastLog = now;
+                m_suppressedSinceLastLog = 0;
+            }
+            else {
+                m_suppressedSinceLastLog++;
+                m_numberOfSuppressedMessages++;
+            }
+        }
+
+        void RateLimitedLogger::logEvent(const string &message) {
+            m_out << message << endl;
+        }
+
+        uint32_t RateLimitedLogger::getNumberOfSuppressedMessages() const {
+            return m_numberOfSuppressedMessages;
+        }
+
+    }
+} // core::base
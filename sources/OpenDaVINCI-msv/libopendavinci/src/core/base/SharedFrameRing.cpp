@@ -0,0 +1,414 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "core/base/SharedFrameRing.h"
+
+namespace core {
+    namespace base {
+
+        using namespace std;
+
+        // Layout of the shared memory segment: One header followed by
+        // numberOfSlots slots; every slot starts with its own header
+        // followed by the frame's data. Headers are padded to a cache
+        // line to avoid false sharing between producer and consumers.
+        static const uint32_t FRAME_RING_MAGIC = 0x4F445652; // 'ODVR'
+        static const uint32_t FRAME_RING_ALIGNMENT = 64;
+
+        // Indices of the uint32_t fields in the ring's header.
+        static const uint32_t HEADER_MAGIC = 0;
+        static const uint32_t HEADER_NUMBER_OF_SLOTS = 1;
+        static const uint32_t HEADER_FRAME_SIZE = 2;
+        static const uint32_t HEADER_SLOT_STRIDE = 3;
+        static const uint32_t HEADER_LATEST_SLOT = 4;
+        static const uint32_t HEADER_FRAME_COUNTER = 5;
+
+        // Indices of the uint32_t fields in a slot's header.
+        static const uint32_t SLOT_SEQUENCE = 0;
+        static const uint32_t SLOT_FRAME_NUMBER = 1;
+
+        static uint32_t alignToCacheLine(const uint32_t &size) {
+            return ((size + FRAME_RING_ALIGNMENT - 1) / FRAME_RING_ALIGNMENT) * FRAME_RING_ALIGNMENT;
+        }
+
+        uint32_t SharedFrameRing::getRequiredSize(const uint32_t &frameSize, const uint32_t &numberOfSlots) {
+            return FRAME_RING_ALIGNMENT + numberOfSlots * (FRAME_RING_ALIGNMENT + alignToCacheLine(frameSize));
+        }
+
+        SharedFrameRing::SharedFrameRing(core::SharedPointer<core::wrapper::SharedMemory> memory, const uint32_t &frameSize, const uint32_t &numberOfSlots) :
+            m_memory(memory),
+            m_isFrameRing(false),
+            m_isProducer(true),
+            m_frameSize(frameSize),
+            m_numberOfSlots(numberOfSlots),
+            m_slotStride(FRAME_RING_ALIGNMENT + alignToCacheLine(frameSize)),
+            m_writeSlot(0),
+            m_frameCounter(0),
+            m_isReading(false),
+            m_readSlot(0),
+            m_readSequence(0) {
+
+            if ( isValid() &&
+                 (numberOfSlots > 1) &&
+                 (m_memory->getSize() >= getRequiredSize(frameSize, numberOfSlots)) ) {
+                volatile uint32_t *header = getHeader();
+
+                // Invalidate the segment while (re-)formatting.
+                header[HEADER_MAGIC] = 0;
+                memoryBarrier();
+
+                for (uint32_t slot = 0; slot < m_numberOfSlots; slot++) {
+                    getSlot(slot)[SLOT_SEQUENCE] = 0;
+                    getSlot(slot)[SLOT_FRAME_NUMBER] = 0;
+                }
+
+                header[HEADER_NUMBER_OF_SLOTS] = m_numberOfSlots;
+                header[HEADER_FRAME_SIZE] = m_frameSize;
+                header[HEADER_SLOT_STRIDE] = m_slotStride;
+                header[HEADER_LATEST_SLOT] = 0;
+                header[HEADER_FRAME_COUNTER] = 0;
+                memoryBarrier();
+
+                header[HEADER_MAGIC] = FRAME_RING_MAGIC;
+                memoryBarrier();
+
+                m_isFrameRing = true;
+            }
+        }
+
+        SharedFrameRing::SharedFrameRing(core::SharedPointer<core::wrapper::SharedMemory> memory) :
+            m_memory(memory),
+            m_isFrameRing(false),
+            m_isProducer(false),
+            m_frameSize(0),
+            m_numberOfSlots(0),
+            m_slotStride(0),
+            m_writeSlot(0),
+            m_frameCounter(0),
+            m_isReading(false),
+            m_readSlot(0),
+            m_readSequence(0) {
+
+            if (isValid()) {
+                // Segments not created by a SharedFrameRing are used as one single frame.
+                m_frameSize = m_memory->getSize();
+
+                if (m_memory->getSize() >= FRAME_RING_ALIGNMENT) {
+                    volatile uint32_t *header = getHeader();
+                    const uint32_t magic = header[HEADER_MAGIC];
+                    memoryBarrier();
+
+                    const uint32_t numberOfSlots = header[HEADER_NUMBER_OF_SLOTS];
+                    const uint32_t frameSize = header[HEADER_FRAME_SIZE];
+                    const uint32_t slotStride = header[HEADER_SLOT_STRIDE];
+
+                    if ( (magic == FRAME_RING_MAGIC) &&
+                         (numberOfSlots > 1) &&
+                         (slotStride == (FRAME_RING_ALIGNMENT + alignToCacheLine(frameSize))) &&
+                         (m_memory->getSize() >= getRequiredSize(frameSize, numberOfSlots)) ) {
+                        m_isFrameRing = true;
+                        m_frameSize = frameSize;
+                        m_numberOfSlots = numberOfSlots;
+                        m_slotStride = slotStride;
+                    }
+                }
+            }
+        }
+
+        SharedFrameRing::~SharedFrameRing() {}
+
+        bool SharedFrameRing::isValid() const {
+            return (m_memory.isValid() && m_memory->isValid());
+        }
+
+        bool SharedFrameRing::isFrameRing() const {
+            return m_isFrameRing;
+        }
+
+        uint32_t SharedFrameRing::getFrameSize() const {
+            return m_frameSize;
+        }
+
+        uint32_t SharedFrameRing::getNumberOfSlots() const {
+            return m_numberOfSlots;
+        }
+
+        uint32_t SharedFrameRing::getLatestFrameNumber() const {
+            uint32_t retVal = 0;
+            if (m_isFrameRing) {
+                retVal = getHeader()[HEADER_FRAME_COUNTER];
+            }
+            return retVal;
+        }
+
+        char* SharedFrameRing::beginWrite() {
+            char *retVal = NULL;
+            if (m_isFrameRing && m_isProducer) {
+                // Never overwrite the latest published frame.
+                m_writeSlot = (getHeader()[HEADER_LATEST_SLOT] + 1) % m_numberOfSlots;
+
+                volatile uint32_t *slot = getSlot(m_writeSlot);
+
+                // Odd sequence: Consumers will discard what they read from this slot.
+                slot[SLOT_SEQUENCE] = slot[SLOT_SEQUENCE] + 1;
+                memoryBarrier();
+
+                retVal = const_cast<char*>(reinterpret_cast<volatile char*>(slot)) + FRAME_RING_ALIGNMENT;
+            }
+            return retVal;
+        }
+
+        void SharedFrameRing::endWrite() {
+            if (m_isFrameRing && m_isProducer) {
+                volatile uint32_t *header = getHeader();
+                volatile uint32_t *slot = getSlot(m_writeSlot);
+
+                m_frameCounter++;
+                // The frame counter never returns to 0 which denotes "no frame yet".
+                if (m_frameCounter == 0) {
+                    m_frameCounter = 1;
+                }
+
+                memoryBarrier();
+                slot[SLOT_FRAME_NUMBER] = m_frameCounter;
+                memoryBarrier();
+
+                // Even sequence: The slot is consistent again.
+                slot[SLOT_SEQUENCE] = slot[SLOT_SEQUENCE] + 1;
+                memoryBarrier();
+
+                header[HEADER_LATEST_SLOT] = m_writeSlot;
+                memoryBarrier();
+                header[HEADER_FRAME_COUNTER] = m_frameCounter;
+                memoryBarrier();
+            }
+        }
+
+        bool SharedFrameRing::read(char *dest, const uint32_t &size, uint32_t &frameNumber) {
+            bool retVal = false;
+
+            if ( (dest != NULL) && isValid() ) {
+                const uint32_t bytesToCopy = min(size, m_frameSize);
+
+                if (m_isFrameRing) {
+                    // The producer can overwrite the slot being read only if
+                    // it published more than numberOfSlots - 1 frames meanwhile;
+                    // in that case, simply retry with the then latest slot.
+                    const uint32_t MAX_ATTEMPTS = 2 * m_numberOfSlots;
+                    volatile uint32_t *header = getHeader();
+
+                    for (uint32_t attempt = 0; (attempt < MAX_ATTEMPTS) && !retVal; attempt++) {
+                        memoryBarrier();
+                        if (header[HEADER_FRAME_COUNTER] == 0) {
+                            // Nothing published yet.
+                            break;
+                        }
+
+                        const uint32_t latestSlot = header[HEADER_LATEST_SLOT] % m_numberOfSlots;
+                        volatile uint32_t *slot = getSlot(latestSlot);
+
+                        const uint32_t sequenceBefore = slot[SLOT_SEQUENCE];
+                        if ((sequenceBefore & 1) != 0) {
+                            continue;
+                        }
+                        memoryBarrier();
+
+                        const uint32_t number = slot[SLOT_FRAME_NUMBER];
+                        ::memcpy(dest, const_cast<char*>(reinterpret_cast<volatile char*>(slot)) + FRAME_RING_ALIGNMENT, bytesToCopy);
+
+                        memoryBarrier();
+                        const uint32_t sequenceAfter = slot[SLOT_SEQUENCE];
+
+                        if (sequenceBefore == sequenceAfter) {
+                            frameNumber = number;
+                            retVal = true;
+                        }
+                    }
+                }
+                else {
+                    // Plain shared memory segment protected by its semaphore.
+                    m_memory->lock();
+                        ::memcpy(dest, m_memory->getSharedMemory(), bytesToCopy);
+                    m_memory->unlock();
+
+                    frameNumber = 0;
+                    retVal = true;
+                }
+            }
+
+            return retVal;
+        }
+
+        const char* SharedFrameRing::beginRead(uint32_t &frameNumber) {
+            const char *retVal = NULL;
+
+            if ( !m_isReading && isValid() ) {
+                if (m_isFrameRing) {
+                    const uint32_t MAX_ATTEMPTS = 2 * m_numberOfSlots;
+                    volatile uint32_t *header = getHeader();
+
+                    for (uint32_t attempt = 0; (attempt < MAX_ATTEMPTS) && (retVal == NULL); attempt++) {
+                        memoryBarrier();
+                        if (header[HEADER_FRAME_COUNTER] == 0) {
+                            // Nothing published yet.
+                            break;
+                        }
+
+                        const uint32_t latestSlot = header[HEADER_LATEST_SLOT] % m_numberOfSlots;
+                        volatile uint32_t *slot = getSlot(latestSlot);
+
+                        const uint32_t sequence = slot[SLOT_SEQUENCE];
+                        if ((sequence & 1) != 0) {
+                            continue;
+                        }
+                        memoryBarrier();
+
+                        frameNumber = slot[SLOT_FRAME_NUMBER];
+                        m_readSlot = latestSlot;
+                        m_readSequence = sequence;
+                        m_isReading = true;
+
+                        retVal = const_cast<char*>(reinterpret_cast<volatile char*>(slot)) + FRAME_RING_ALIGNMENT;
+                    }
+                }
+                else {
+                    // Plain shared memory segment protected by its semaphore until endRead().
+                    m_memory->lock();
+                    frameNumber = 0;
+                    m_isReading = true;
+
+                    retVal = static_cast<const char*>(m_memory->getSharedMemory());
+                }
+            }
+
+            return retVal;
+        }
+
+        bool SharedFrameRing::getLatestFrame(uint32_t &slot, uint32_t &frameNumber) const {
+            bool retVal = false;
+
+            if (isValid()) {
+                if (m_isFrameRing) {
+                    const uint32_t MAX_ATTEMPTS = 2 * m_numberOfSlots;
+                    volatile uint32_t *header = getHeader();
+
+                    for (uint32_t attempt = 0; (attempt < MAX_ATTEMPTS) && !retVal; attempt++) {
+                        memoryBarrier();
+                        if (header[HEADER_FRAME_COUNTER] == 0) {
+                            // Nothing published yet.
+                            break;
+                        }
+
+                        const uint32_t latestSlot = header[HEADER_LATEST_SLOT] % m_numberOfSlots;
+                        volatile uint32_t *s = getSlot(latestSlot);
+
+                        const uint32_t sequenceBefore = s[SLOT_SEQUENCE];
+                        if ((sequenceBefore & 1) != 0) {
+                            continue;
+                        }
+                        memoryBarrier();
+
+                        const uint32_t number = s[SLOT_FRAME_NUMBER];
+
+                        memoryBarrier();
+                        if (sequenceBefore == s[SLOT_SEQUENCE]) {
+                            slot = latestSlot;
+                            frameNumber = number;
+                            retVal = true;
+                        }
+                    }
+                }
+                else {
+                    slot = 0;
+                    frameNumber = 0;
+                    retVal = true;
+                }
+            }
+
+            return retVal;
+        }
+
+        const char* SharedFrameRing::beginRead(const uint32_t &slot, const uint32_t &frameNumber) {
+            const char *retVal = NULL;
+
+            if ( !m_isReading && isValid() ) {
+                if (m_isFrameRing) {
+                    if (slot < m_numberOfSlots) {
+                        volatile uint32_t *s = getSlot(slot);
+
+                        memoryBarrier();
+                        const uint32_t sequence = s[SLOT_SEQUENCE];
+                        memoryBarrier();
+
+                        // Reject the slot while being written or after being reused for another frame.
+                        if ( ((sequence & 1) == 0) && (s[SLOT_FRAME_NUMBER] == frameNumber) ) {
+                            m_readSlot = slot;
+                            m_readSequence = sequence;
+                            m_isReading = true;
+
+                            retVal = const_cast<char*>(reinterpret_cast<volatile char*>(s)) + FRAME_RING_ALIGNMENT;
+                        }
+                    }
+                }
+                else {
+                    uint32_t unused = 0;
+                    retVal = beginRead(unused);
+                }
+            }
+
+            return retVal;
+        }
+
+        bool SharedFrameRing::endRead() {
+            bool retVal = false;
+
+            if (m_isReading) {
+                if (m_isFrameRing) {
+                    memoryBarrier();
+                    retVal = (getSlot(m_readSlot)[SLOT_SEQUENCE] == m_readSequence);
+                }
+                else {
+                    m_memory->unlock();
+                    retVal = true;
+                }
+                m_isReading = false;
+            }
+
+            return retVal;
+        }
+
+        void SharedFrameRing::memoryBarrier() {
+#ifdef WIN32
+            MemoryBarrier();
+#else
+            __sync_synchronize();
+#endif
+        }
+
+        volatile uint32_t* SharedFrameRing::getHeader() const {
+            return static_cast<volatile uint32_t*>(m_memory->getSharedMemory());
+        }
+
+        volatile uint32_t* SharedFrameRing::getSlot(const uint32_t &slot) const {
+            volatile char *base = static_cast<volatile char*>(m_memory->getSharedMemory());
+            return reinterpret_cast<volatile uint32_t*>(base + FRAME_RING_ALIGNMENT + slot * m_slotStride);
+        }
+
+    }
+} // core::base
@@ -18,6 +18,7 @@
  */
 
 #include "core/base/Thread.h"
+#include "core/data/TimeStamp.h"
 #include "core/wrapper/ConcurrencyFactory.h"
 
 namespace core {
@@ -29,5 +30,9 @@ namespace core {
             }
         }
 
+        void Thread::usleepUntil(const core::data::TimeStamp &deadline) {
+            wrapper::ConcurrencyFactory::usleepUntil(deadline.getSeconds(), deadline.getFractionalMicroseconds());
+        }
+
     }
 } // core::base
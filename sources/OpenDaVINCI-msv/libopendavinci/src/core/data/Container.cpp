@@ -68,6 +68,16 @@ namespace core {
             return m_dataType;
         }
 
+        uint32_t Container::getSerializedDataSize() const {
+            // Determine the end of the read area and restore the current read position.
+            stringbuf *buffer = m_serializedData.rdbuf();
+            const streampos current = buffer->pubseekoff(0, ios::cur, ios::in);
+            const streampos end = buffer->pubseekoff(0, ios::end, ios::in);
+            buffer->pubseekpos(current, ios::in);
+
+            return (end > 0) ? static_cast<uint32_t>(end) : 0;
+        }
+
         const TimeStamp Container::getSentTimeStamp() const {
             return m_sent;
         }
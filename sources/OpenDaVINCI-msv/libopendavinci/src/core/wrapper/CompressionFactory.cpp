@@ -34,5 +34,12 @@ namespace core {
 
             return CompressionFactoryWorker<configuration::value>::getContents(in);
         }
+
+        DecompressedData* CompressionFactory::getContents(const string &fileName)
+        {
+            typedef ConfigurationTraits<CompressionLibraryProducts>::configuration configuration;
+
+            return CompressionFactoryWorker<configuration::value>::getContents(fileName);
+        }
     }
 } // core::wrapper
@@ -48,5 +48,12 @@ namespace core {
 
             return ConcurrencyFactoryWorker<configuration::value>::usleep(microseconds);
         }
+
+        void ConcurrencyFactory::usleepUntil(const long &seconds, const long &partialMicroseconds)
+        {
+            typedef ConfigurationTraits<SystemLibraryProducts>::configuration configuration;
+
+            return ConcurrencyFactoryWorker<configuration::value>::usleepUntil(seconds, partialMicroseconds);
+        }
     }
 } // core::wrapper
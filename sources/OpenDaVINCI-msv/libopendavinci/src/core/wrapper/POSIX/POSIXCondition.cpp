@@ -62,6 +62,12 @@ namespace core {
                 timeout.tv_sec += seconds;
                 timeout.tv_nsec += milliseconds * 1000 * 1000;
 
+                // pthread_cond_timedwait rejects nanoseconds beyond one second.
+                if (timeout.tv_nsec >= 1000 * 1000 * 1000) {
+                    timeout.tv_sec++;
+                    timeout.tv_nsec -= 1000 * 1000 * 1000;
+                }
+
                 int32_t error = pthread_cond_timedwait(&m_condition, &m_mutex.getNativeMutex(), &timeout);
 
                 return (error == 0);
@@ -19,6 +19,10 @@
 
 #include <algorithm>
 #include <climits>
+#include <iomanip>
+#include <sstream>
+
+#include <sys/mman.h>
 
 #include "core/wrapper/POSIX/POSIXSharedMemory.h"
 
@@ -28,46 +32,81 @@ namespace core {
 
             using namespace std;
 
+            // Every segment starts with a header: magic number, size of
+            // the header, usable size, length of the name, and the name.
+            static const uint32_t SHARED_MEMORY_MAGIC = 0x4F445653; // 'ODVS'
+            static const uint32_t HEADER_MAGIC = 0;
+            static const uint32_t HEADER_HEADER_SIZE = 1;
+            static const uint32_t HEADER_SIZE = 2;
+            static const uint32_t HEADER_NAME_LENGTH = 3;
+            static const uint32_t HEADER_NAME_OFFSET = 4 * sizeof(uint32_t);
+
+            // The data following the header is aligned to a cache line.
+            static const uint32_t HEADER_ALIGNMENT = 64;
+
+            // Number of subsequent SysV keys to try if a key is already used by a segment with a different name.
+            static const uint32_t MAX_NUMBER_OF_KEY_PROBES = 16;
+
+            // Segments of this size or larger are backed by huge pages if possible.
+            static const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+            static uint32_t getHeaderSize(const string &name) {
+                const uint32_t size = HEADER_NAME_OFFSET + name.size() + 1;
+                return ((size + HEADER_ALIGNMENT - 1) / HEADER_ALIGNMENT) * HEADER_ALIGNMENT;
+            }
+
+            static string getInternalName(const string &name, const uint32_t &crc) {
+                string internalName(name);
+
+                // FreeBSD requires that the semaphore must start with / and does not contain any furhter /'s.
+                replace(internalName.begin(), internalName.end(), '/', '_'); // Replace all / by _
+                internalName.insert(0, "/");
+
+                #ifdef _POSIX_NAME_MAX
+                    const uint32_t MAX_NAME_LENGTH = _POSIX_NAME_MAX;
+                #else
+                    const uint32_t MAX_NAME_LENGTH = 12;
+                #endif
+                if (internalName.length() > MAX_NAME_LENGTH) {
+                    // Keep truncated names unique by appending the name's checksum.
+                    stringstream sstr;
+                    sstr << hex << setw(8) << setfill('0') << crc;
+                    internalName.resize(MAX_NAME_LENGTH - sstr.str().length());
+                    internalName += sstr.str();
+                }
+
+                return internalName;
+            }
+
             POSIXSharedMemory::POSIXSharedMemory(const string &name, const uint32_t &size) :
                     m_name(name),
                     m_internalName(name),
                     m_releaseSharedMemory(true),
-                    m_shmID(0),
+                    m_isMapped(false),
+                    m_shmID(-1),
                     m_mutexSharedMemory(NULL),
                     m_sharedMemory(NULL),
+                    m_headerSize(getHeaderSize(name)),
+                    m_mappedSize(0),
                     m_size(size) {
 
                 if (m_name.size() > 0) {
-                    // FreeBSD requires that the semaphore must start with / and does not contain any furhter /'s.
-                    replace(m_internalName.begin(), m_internalName.end(), '/', '_'); // Replace all / by _
-                    m_internalName.insert(0, "/");
+                    m_internalName = getInternalName(m_name, getCRC32(m_name));
 
-                    #ifdef _POSIX_NAME_MAX
-                        const uint32_t MAX_NAME_LENGTH = _POSIX_NAME_MAX;
-                    #else
-                        const uint32_t MAX_NAME_LENGTH = 12;
-                    #endif
-                    if (m_internalName.length() > MAX_NAME_LENGTH) {
-                        m_internalName.resize(MAX_NAME_LENGTH);
-                    }
+                    if (openSemaphore(true)) {
+                        bool created = false;
+#ifdef HAVE_LINUX_RT
+                        created = createMappedSegment();
+#endif
+                        if (!created) {
+                            created = createSysVSegment();
+                        }
 
-                    m_mutexSharedMemory = sem_open(m_internalName.c_str(), O_CREAT, S_IRUSR | S_IWUSR, 1);
-                    if (m_mutexSharedMemory == SEM_FAILED) {
-                        clog << "Semaphore could not be created, errno: " << errno << endl;
-                        sem_unlink(m_internalName.c_str());
-                        m_mutexSharedMemory = NULL;
-                    } else {
-                        // Create the shared memory segment with this name.
-                        const uint32_t hash = getCRC32(m_internalName);
-                        m_shmID = shmget(hash, size + sizeof(uint32_t), IPC_CREAT | S_IRUSR | S_IWUSR);
-                        if (m_shmID < 0) {
+                        if (!created) {
                             clog << "Shared memory could not be requested." << endl;
+                            sem_close(m_mutexSharedMemory);
                             sem_unlink(m_internalName.c_str());
                             m_mutexSharedMemory = NULL;
-                        } else {
-                            // Attach to virtual memory and store its size to the beginning of the shared memory.
-                            m_sharedMemory = shmat(m_shmID, NULL, 0);
-                            *(uint32_t *) m_sharedMemory = m_size;
                         }
                     }
                 }
@@ -77,77 +116,325 @@ namespace core {
                     m_name(name),
                     m_internalName(name),
                     m_releaseSharedMemory(false),
-                    m_shmID(0),
+                    m_isMapped(false),
+                    m_shmID(-1),
                     m_mutexSharedMemory(NULL),
                     m_sharedMemory(NULL),
+                    m_headerSize(getHeaderSize(name)),
+                    m_mappedSize(0),
                     m_size(0) {
 
                 if (m_name.size() > 0) {
-                    // FreeBSD requires that the semaphore must start with / and does not contain any furhter /'s.
-                    replace(m_internalName.begin(), m_internalName.end(), '/', '_'); // Replace all / by _
-                    m_internalName.insert(0, "/");
+                    m_internalName = getInternalName(m_name, getCRC32(m_name));
 
-                    #ifdef _POSIX_NAME_MAX
-                        const uint32_t MAX_NAME_LENGTH = _POSIX_NAME_MAX;
-                    #else
-                        const uint32_t MAX_NAME_LENGTH = 12;
-                    #endif
-                    if (m_internalName.length() > MAX_NAME_LENGTH) {
-                        m_internalName.resize(MAX_NAME_LENGTH);
-                    }
+                    if (openSemaphore(false)) {
+                        bool attached = false;
+#ifdef HAVE_LINUX_RT
+                        attached = attachMappedSegment();
+#endif
+                        if (!attached) {
+                            attached = attachSysVSegment();
+                        }
 
-                    m_mutexSharedMemory = sem_open(m_internalName.c_str(), 0, S_IRUSR | S_IWUSR, 0);
-                    if (m_mutexSharedMemory == SEM_FAILED) {
-                        clog << "Semaphore could not be created, errno: " << errno << endl;
-                        sem_close(m_mutexSharedMemory);
-                        m_mutexSharedMemory = NULL;
-                    } else {
-                        // Create the shared memory segment with this key.
-                        const uint32_t hash = getCRC32(m_internalName);
-                        m_shmID = shmget(hash, sizeof(uint32_t), S_IRUSR | S_IWUSR);
-                        if (m_shmID < 0) {
-                            clog << "Intermediate shared memory could not be requested." << endl;
+                        if (!attached) {
+                            clog << "Shared memory " << m_name << " could not be attached." << endl;
                             sem_close(m_mutexSharedMemory);
                             m_mutexSharedMemory = NULL;
-                        } else {
-                            // Attach to virtual memory and try to read its entire size.
-                            m_sharedMemory = shmat(m_shmID, NULL, 0);
-                            m_size = *(uint32_t *) m_sharedMemory;
-
-                            // Detach and try to attach to entire size.
-                            shmdt(m_sharedMemory);
-
-                            m_shmID = shmget(hash, m_size + sizeof(uint32_t), S_IRUSR | S_IWUSR);
-                            if (m_shmID < 0) {
-                                clog << "Final shared memory could not be requested." << endl;
-                                sem_close(m_mutexSharedMemory);
-                                m_mutexSharedMemory = NULL;
-                            } else {
-                                // Attach this segment to virtual memory.
-                                m_sharedMemory = shmat(m_shmID, NULL, 0);
-                            }
                         }
                     }
                 }
             }
 
             POSIXSharedMemory::~POSIXSharedMemory() {
-                if (m_releaseSharedMemory) {
-                    if (m_mutexSharedMemory != NULL) {
-                        sem_close(m_mutexSharedMemory);
-                    }
+                if (m_mutexSharedMemory != NULL) {
+                    sem_close(m_mutexSharedMemory);
+                }
 
+                if (m_releaseSharedMemory) {
                     // Remove semaphore.
                     sem_unlink(m_internalName.c_str());
+                }
+
+                if (m_sharedMemory != NULL) {
+                    if (m_isMapped) {
+                        munmap(m_sharedMemory, m_mappedSize);
+
+                        if (m_releaseSharedMemory) {
+                            // Remove shared memory; processes still having it mapped are not affected.
+                            shm_unlink(m_internalName.c_str());
+                        }
+                    }
+                    else {
+                        // Detach shared memory.
+                        shmdt(m_sharedMemory);
+
+                        if (m_releaseSharedMemory) {
+                            // Remove shared memory if released by other processes.
+                            shmctl(m_shmID, IPC_RMID, 0);
+                        }
+                    }
+                }
+            }
+
+            bool POSIXSharedMemory::openSemaphore(const bool &create) {
+                if (create) {
+                    m_mutexSharedMemory = sem_open(m_internalName.c_str(), O_CREAT, S_IRUSR | S_IWUSR, 1);
+                }
+                else {
+                    m_mutexSharedMemory = sem_open(m_internalName.c_str(), 0, S_IRUSR | S_IWUSR, 0);
+                }
+
+                if (m_mutexSharedMemory == SEM_FAILED) {
+                    clog << "Semaphore could not be created, errno: " << errno << endl;
+                    if (create) {
+                        sem_unlink(m_internalName.c_str());
+                    }
+                    m_mutexSharedMemory = NULL;
+                }
+
+                return (m_mutexSharedMemory != NULL);
+            }
+
+            bool POSIXSharedMemory::createMappedSegment() {
+                const int fd = shm_open(m_internalName.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+                if (fd < 0) {
+                    return false;
+                }
+
+                // Do not take over a segment which belongs to a differently named one.
+                struct stat info;
+                if ( (fstat(fd, &info) == 0) && (info.st_size >= static_cast<off_t>(HEADER_NAME_OFFSET)) ) {
+                    void *existing = mmap(NULL, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+                    if (existing != MAP_FAILED) {
+                        const bool isForeign = (static_cast<uint32_t*>(existing)[HEADER_MAGIC] == SHARED_MEMORY_MAGIC) &&
+                                               !hasMatchingHeader(existing, info.st_size);
+                        munmap(existing, info.st_size);
+
+                        if (isForeign) {
+                            clog << "Shared memory " << m_internalName << " is used by a segment with a different name." << endl;
+                            close(fd);
+                            return false;
+                        }
+                    }
+                }
+
+                m_mappedSize = m_headerSize + m_size;
+                if (ftruncate(fd, m_mappedSize) != 0) {
+                    close(fd);
+                    shm_unlink(m_internalName.c_str());
+                    return false;
+                }
+
+                void *memory = mmap(NULL, m_mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                // The mapping remains valid after closing its file descriptor.
+                close(fd);
+
+                if (memory == MAP_FAILED) {
+                    shm_unlink(m_internalName.c_str());
+                    return false;
+                }
+
+#ifdef MADV_HUGEPAGE
+                if (m_mappedSize >= HUGE_PAGE_SIZE) {
+                    // Best effort: Only honored if transparent huge pages are enabled for shared memory.
+                    madvise(memory, m_mappedSize, MADV_HUGEPAGE);
+                }
+#endif
+
+                m_sharedMemory = memory;
+                m_isMapped = true;
+                writeHeader();
 
-                    // Detach shared memory.
-                    shmdt(m_sharedMemory);
+                return true;
+            }
+
+            bool POSIXSharedMemory::attachMappedSegment() {
+                const int fd = shm_open(m_internalName.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+                if (fd < 0) {
+                    return false;
+                }
+
+                struct stat info;
+                if ( (fstat(fd, &info) != 0) || (info.st_size < static_cast<off_t>(m_headerSize)) ) {
+                    close(fd);
+                    return false;
+                }
+
+                void *memory = mmap(NULL, info.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                close(fd);
+
+                if (memory == MAP_FAILED) {
+                    return false;
+                }
+
+                if (!hasMatchingHeader(memory, info.st_size)) {
+                    clog << "Shared memory " << m_internalName << " does not belong to " << m_name << "." << endl;
+                    munmap(memory, info.st_size);
+                    return false;
+                }
+
+                m_sharedMemory = memory;
+                m_mappedSize = info.st_size;
+                m_isMapped = true;
+                m_size = static_cast<uint32_t*>(memory)[HEADER_SIZE];
+
+                return true;
+            }
+
+            bool POSIXSharedMemory::createSysVSegment() {
+                const uint32_t hash = getCRC32(m_name);
+                const size_t requiredSize = m_headerSize + m_size;
+
+                for (uint32_t probe = 0; probe < MAX_NUMBER_OF_KEY_PROBES; probe++) {
+                    const key_t key = static_cast<key_t>(hash + probe);
+                    if (key == IPC_PRIVATE) {
+                        continue;
+                    }
+
+                    // errno is only meaningful directly after a failed shmget().
+                    int32_t shmID = -1;
+                    int32_t error = 0;
+#ifdef SHM_HUGETLB
+                    if (requiredSize >= HUGE_PAGE_SIZE) {
+                        shmID = shmget(key, requiredSize, IPC_CREAT | IPC_EXCL | SHM_HUGETLB | S_IRUSR | S_IWUSR);
+                        error = (shmID < 0) ? errno : 0;
+                    }
+                    if ( (shmID < 0) && (error != EEXIST) ) {
+                        // No huge pages available; use regular pages.
+                        shmID = shmget(key, requiredSize, IPC_CREAT | IPC_EXCL | S_IRUSR | S_IWUSR);
+                        error = (shmID < 0) ? errno : 0;
+                    }
+#else
+                    shmID = shmget(key, requiredSize, IPC_CREAT | IPC_EXCL | S_IRUSR | S_IWUSR);
+                    error = (shmID < 0) ? errno : 0;
+#endif
+
+                    if ( (shmID < 0) && (error == EEXIST) ) {
+                        // The key is in use: Check whether it is a left-over of this segment or a collision.
+                        shmID = shmget(key, 0, S_IRUSR | S_IWUSR);
+                        if (shmID < 0) {
+                            continue;
+                        }
+
+                        struct shmid_ds info;
+                        void *existing = shmat(shmID, NULL, 0);
+                        if ( (existing == reinterpret_cast<void*>(-1)) || (shmctl(shmID, IPC_STAT, &info) != 0) ) {
+                            if (existing != reinterpret_cast<void*>(-1)) {
+                                shmdt(existing);
+                            }
+                            continue;
+                        }
+
+                        if (!hasMatchingHeader(existing, info.shm_segsz)) {
+                            clog << "Shared memory key " << key << " for " << m_name << " collides with another segment, trying next key." << endl;
+                            shmdt(existing);
+                            continue;
+                        }
+
+                        if (info.shm_segsz < requiredSize) {
+                            // Left-over of this segment which is too small: Remove and create it again.
+                            shmdt(existing);
+                            shmctl(shmID, IPC_RMID, 0);
+                            shmID = shmget(key, requiredSize, IPC_CREAT | IPC_EXCL | S_IRUSR | S_IWUSR);
+                            if (shmID < 0) {
+                                continue;
+                            }
+                        }
+                        else {
+                            m_shmID = shmID;
+                            m_sharedMemory = existing;
+                            writeHeader();
+                            return true;
+                        }
+                    }
 
-                    // Remove shared memory if released by other processes.
-                    shmctl(m_shmID, IPC_RMID, 0);
-                } else {
-                    shmdt(m_sharedMemory);
+                    if (shmID < 0) {
+                        return false;
+                    }
+
+                    void *memory = shmat(shmID, NULL, 0);
+                    if (memory == reinterpret_cast<void*>(-1)) {
+                        shmctl(shmID, IPC_RMID, 0);
+                        return false;
+                    }
+
+                    m_shmID = shmID;
+                    m_sharedMemory = memory;
+                    writeHeader();
+                    return true;
                 }
+
+                return false;
+            }
+
+            bool POSIXSharedMemory::attachSysVSegment() {
+                const uint32_t hash = getCRC32(m_name);
+
+                for (uint32_t probe = 0; probe < MAX_NUMBER_OF_KEY_PROBES; probe++) {
+                    const key_t key = static_cast<key_t>(hash + probe);
+                    if (key == IPC_PRIVATE) {
+                        continue;
+                    }
+
+                    // Size 0 refers to the existing segment regardless of its actual size.
+                    const int32_t shmID = shmget(key, 0, S_IRUSR | S_IWUSR);
+                    if (shmID < 0) {
+                        continue;
+                    }
+
+                    struct shmid_ds info;
+                    if (shmctl(shmID, IPC_STAT, &info) != 0) {
+                        continue;
+                    }
+
+                    void *memory = shmat(shmID, NULL, 0);
+                    if (memory == reinterpret_cast<void*>(-1)) {
+                        continue;
+                    }
+
+                    if (hasMatchingHeader(memory, info.shm_segsz)) {
+                        m_shmID = shmID;
+                        m_sharedMemory = memory;
+                        m_size = static_cast<uint32_t*>(memory)[HEADER_SIZE];
+                        return true;
+                    }
+
+                    shmdt(memory);
+                }
+
+                return false;
+            }
+
+            void POSIXSharedMemory::writeHeader() {
+                uint32_t *header = static_cast<uint32_t*>(m_sharedMemory);
+
+                // Invalidate the header while it is written.
+                header[HEADER_MAGIC] = 0;
+                __sync_synchronize();
+
+                header[HEADER_HEADER_SIZE] = m_headerSize;
+                header[HEADER_SIZE] = m_size;
+                header[HEADER_NAME_LENGTH] = m_name.size();
+                ::memcpy(static_cast<char*>(m_sharedMemory) + HEADER_NAME_OFFSET, m_name.c_str(), m_name.size() + 1);
+                __sync_synchronize();
+
+                header[HEADER_MAGIC] = SHARED_MEMORY_MAGIC;
+                __sync_synchronize();
+            }
+
+            bool POSIXSharedMemory::hasMatchingHeader(const void *memory, const size_t &length) const {
+                if ( (memory == NULL) || (length < m_headerSize) ) {
+                    return false;
+                }
+
+                const uint32_t *header = static_cast<const uint32_t*>(memory);
+                const char *name = static_cast<const char*>(memory) + HEADER_NAME_OFFSET;
+
+                return (header[HEADER_MAGIC] == SHARED_MEMORY_MAGIC) &&
+                       (header[HEADER_HEADER_SIZE] == m_headerSize) &&
+                       (header[HEADER_NAME_LENGTH] == m_name.size()) &&
+                       (static_cast<size_t>(m_headerSize) + header[HEADER_SIZE] <= length) &&
+                       (::memcmp(name, m_name.c_str(), m_name.size()) == 0);
             }
 
             bool POSIXSharedMemory::isValid() const {
@@ -168,23 +455,26 @@ namespace core {
 
             void* POSIXSharedMemory::getSharedMemory() const {
                 // Adjust the address of the shared memory's beginning.
-                return static_cast<void*>(static_cast<char*>(m_sharedMemory) + sizeof(uint32_t));
+                return static_cast<void*>(static_cast<char*>(m_sharedMemory) + m_headerSize);
             }
 
             uint32_t POSIXSharedMemory::getSize() const {
                 return m_size;
             }
 
-            uint32_t POSIXSharedMemory::getCRC32(const string &s) const {
-                // The CRC32 polynomial.
-                const uint32_t CRC32POLYNOMIAL = 0x04C11DB7;
+            uint32_t POSIXSharedMemory::getCRC32(const string &s) {
+                // The reversed CRC32 polynomial.
+                const uint32_t CRC32POLYNOMIAL = 0xEDB88320;
 
-                uint32_t retVal = 0;
+                uint32_t retVal = 0xFFFFFFFF;
                 for (uint32_t i = 0; i < s.size(); i++) {
-                    retVal = retVal ^ (s.at(i) ^ CRC32POLYNOMIAL);
+                    retVal = retVal ^ static_cast<uint8_t>(s.at(i));
+                    for (uint32_t bit = 0; bit < 8; bit++) {
+                        retVal = (retVal >> 1) ^ (CRC32POLYNOMIAL & (0 - (retVal & 1)));
+                    }
                 }
 
-                return retVal;
+                return ~retVal;
             }
 
         }
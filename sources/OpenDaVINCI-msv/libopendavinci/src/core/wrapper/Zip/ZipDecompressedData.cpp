@@ -19,6 +19,7 @@
 
 #include <zip.h>
 
+#include "core/wrapper/MutexFactory.h"
 #include "core/wrapper/Zip/ZipDecompressedData.h"
 
 namespace core {
@@ -27,28 +28,12 @@ namespace core {
 
             using namespace std;
 
-            ZipDecompressedData::ZipDecompressedData(istream &in)
-                    : m_mapOfDecompressedEntries() {
-                decompressData(in);
-            }
-
-            ZipDecompressedData::~ZipDecompressedData() {
-                // Clean up.
-                map<string, stringstream*, StringComparator>::iterator it = m_mapOfDecompressedEntries.begin();
-                while (it != m_mapOfDecompressedEntries.end()) {
-                    stringstream *data = it->second;
-                    if (data != NULL) {
-                        delete data;
-                    }
-                    data = NULL;
-
-                    // Iterate.
-                    it++;
-                }
-                m_mapOfDecompressedEntries.clear();
-            }
-
-            void ZipDecompressedData::decompressData(istream &in) {
+            ZipDecompressedData::ZipDecompressedData(istream &in) :
+                m_archive(NULL),
+                m_temporaryFileName(),
+                m_mutex(MutexFactory::createMutex()),
+                m_mapOfEntries(),
+                m_mapOfDecompressedEntries() {
                 // TODO: libzip needs a file to read from. Therefore, we need to buffer the istream...
                 char *tempFileName;
 #ifdef WIN32
@@ -59,95 +44,108 @@ namespace core {
                     cerr << "ZipDecompressedData: temporary file cannot be created" << endl;
                 }
 #endif
-                fstream fout(tempFileName, ios::binary | ios::out);
+                m_temporaryFileName = string(tempFileName);
+                free(tempFileName);
 
+                fstream fout(m_temporaryFileName.c_str(), ios::binary | ios::out);
                 if (fout.good()) {
-                    char c = 0;
-                    while (in.get(c)) {
-                        fout << c;
-                    }
+                    fout << in.rdbuf();
                     fout.flush();
                     fout.close();
 
-                    // Do decompression.
-                    struct zip *zipArchive = NULL;
-
-                    // Open the ZIP archive.
-                    zipArchive = zip_open(tempFileName, 0, NULL);
-                    if (zipArchive != NULL) {
-
-                        // Get the number of compressed entries.
-                        int32_t numberOfEntries = zip_get_num_files(zipArchive);
-                        if (numberOfEntries > 0) {
-
-                            // Allocate memory for decompression.
-                            char *buffer = new char[ZipDecompressedData::BUFFER_SIZE];
-                            if (buffer != NULL) {
+                    openArchive(m_temporaryFileName);
+                }
+            }
 
-                                // Start decompression.
-                                for (int32_t i = 0; i < numberOfEntries; i++) {
+            ZipDecompressedData::ZipDecompressedData(const string &fileName) :
+                m_archive(NULL),
+                m_temporaryFileName(),
+                m_mutex(MutexFactory::createMutex()),
+                m_mapOfEntries(),
+                m_mapOfDecompressedEntries() {
+                openArchive(fileName);
+            }
 
-                                    // Get i-th entry.
-                                    const char *nameOfEntry = zip_get_name(zipArchive, i, 0);
-                                    if (nameOfEntry != NULL) {
-                                        string name(nameOfEntry);
+            ZipDecompressedData::~ZipDecompressedData() {
+                // Clean up.
+                map<string, stringstream*, StringComparator>::iterator it = m_mapOfDecompressedEntries.begin();
+                while (it != m_mapOfDecompressedEntries.end()) {
+                    stringstream *data = it->second;
+                    if (data != NULL) {
+                        delete data;
+                    }
+                    data = NULL;
 
-                                        // Remove leading ./
-                                        if ( (name.length() > 2) && (name.at(0) == '.') && (name.at(1) == '/') ) {
-                                            name = string(nameOfEntry+2);
-                                        }
+                    // Iterate.
+                    it++;
+                }
+                m_mapOfDecompressedEntries.clear();
 
-                                        // Transform to lower case for case insensitive searches.
-                                        transform(name.begin(), name.end(), name.begin(), ptr_fun(::tolower));
+                // Close given archive.
+                if (m_archive != NULL) {
+                    zip_close(m_archive);
+                    m_archive = NULL;
+                }
 
-                                        // Get entry from zip file.
-                                        struct zip_file *entry = zip_fopen_index(zipArchive, i, ZIP_FL_NOCASE);
-                                        if (entry != NULL) {
+                if (m_temporaryFileName.size() > 0) {
+                    UNLINK(m_temporaryFileName.c_str());
+                }
+            }
 
-                                            // Create stream for storing content.
-                                            stringstream *stream = new stringstream();
-                                            if (stream != NULL) {
+            void ZipDecompressedData::openArchive(const string &fileName) {
+                // Open the ZIP archive.
+                m_archive = zip_open(fileName.c_str(), 0, NULL);
+                if (m_archive != NULL) {
+                    // Get the number of compressed entries.
+                    const int32_t numberOfEntries = zip_get_num_files(m_archive);
+                    for (int32_t i = 0; i < numberOfEntries; i++) {
+                        // Get i-th entry.
+                        const char *nameOfEntry = zip_get_name(m_archive, i, 0);
+                        if (nameOfEntry != NULL) {
+                            string name(nameOfEntry);
+
+                            // Remove leading ./
+                            if ( (name.length() > 2) && (name.at(0) == '.') && (name.at(1) == '/') ) {
+                                name = string(nameOfEntry+2);
+                            }
 
-                                                // Decompress data.
-                                                int32_t nbytes = 0;
-                                                while ( (nbytes = zip_fread(entry, buffer, ZipDecompressedData::BUFFER_SIZE)) > 0) {
-                                                    string s(buffer, nbytes);
-                                                    (*stream) << s;
-                                                }
+                            // Transform to lower case for case insensitive searches.
+                            transform(name.begin(), name.end(), name.begin(), ptr_fun(::tolower));
 
-                                                // Store read content into map.
-                                                m_mapOfDecompressedEntries[name] = stream;
-                                            }
+                            m_mapOfEntries[name] = i;
+                        }
+                    }
+                }
+            }
 
-                                            // Close entry.
-                                            zip_fclose(entry);
-                                        }
-                                    }
-                                }
+            stringstream* ZipDecompressedData::decompressEntry(const int32_t &index) {
+                stringstream *stream = NULL;
 
-                                // De-allocate memory.
-                                delete [] buffer;
-                            }
-                        }
+                // Get entry from zip file.
+                struct zip_file *entry = zip_fopen_index(m_archive, index, ZIP_FL_NOCASE);
+                if (entry != NULL) {
+                    // Create stream for storing content.
+                    stream = new stringstream();
 
-                        // Close given archive.
-                        zip_close(zipArchive);
+                    // Decompress data.
+                    char buffer[ZipDecompressedData::BUFFER_SIZE];
+                    int32_t nbytes = 0;
+                    while ( (nbytes = zip_fread(entry, buffer, ZipDecompressedData::BUFFER_SIZE)) > 0) {
+                        stream->write(buffer, nbytes);
                     }
+
+                    // Close entry.
+                    zip_fclose(entry);
                 }
 
-#ifdef WIN32
-                _unlink(tempFileName);
-#else
-                unlink(tempFileName);
-#endif
-                free(tempFileName);
+                return stream;
             }
 
             vector<string> ZipDecompressedData::getListOfEntries() {
                 vector<string> listOfEntries;
 
-                map<string, stringstream*, StringComparator>::const_iterator it = m_mapOfDecompressedEntries.begin();
-                while (it != m_mapOfDecompressedEntries.end()) {
+                map<string, int32_t, StringComparator>::const_iterator it = m_mapOfEntries.begin();
+                while (it != m_mapOfEntries.end()) {
                     listOfEntries.push_back(it->first);
                     it++;
                 }
@@ -163,11 +161,29 @@ namespace core {
                 // Transform key name to lower case for case insensitive lookups.
                 transform(key.begin(), key.end(), key.begin(), ptr_fun(::tolower));
 
-                // Try to find the key/value.
-                map<string, stringstream*, StringComparator>::const_iterator it = m_mapOfDecompressedEntries.find(key);
-                if (it != m_mapOfDecompressedEntries.end()) {
-                    stream = it->second;
+                m_mutex->lock();
+                {
+                    // Try to find the already decompressed key/value.
+                    map<string, stringstream*, StringComparator>::const_iterator it = m_mapOfDecompressedEntries.find(key);
+                    if (it != m_mapOfDecompressedEntries.end()) {
+                        // Rewind the stream as it might have been consumed by a previous reader.
+                        stream = it->second;
+                        stream->clear();
+                        stream->seekg(0, ios::beg);
+                    }
+                    else {
+                        // Decompress the entry on first access.
+                        map<string, int32_t, StringComparator>::const_iterator jt = m_mapOfEntries.find(key);
+                        if (jt != m_mapOfEntries.end()) {
+                            stringstream *data = decompressEntry(jt->second);
+                            if (data != NULL) {
+                                m_mapOfDecompressedEntries[key] = data;
+                                stream = data;
+                            }
+                        }
+                    }
                 }
+                m_mutex->unlock();
 
                 return stream;
             }
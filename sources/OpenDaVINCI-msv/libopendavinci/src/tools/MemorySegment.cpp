@@ -35,7 +35,9 @@ namespace tools {
         m_header(),
         m_size(0),
         m_consumedSize(0),
-        m_id(0)
+        m_id(0),
+        m_slot(0),
+        m_frameNumber(0)
     {}
 
     MemorySegment::MemorySegment(const MemorySegment &obj) : 
@@ -43,7 +45,9 @@ namespace tools {
         m_header(obj.m_header),
         m_size(obj.m_size),
         m_consumedSize(obj.m_consumedSize),
-        m_id(obj.m_id)
+        m_id(obj.m_id),
+        m_slot(obj.m_slot),
+        m_frameNumber(obj.m_frameNumber)
     {}
 
     MemorySegment& MemorySegment::operator=(const MemorySegment &obj) {
@@ -51,6 +55,8 @@ namespace tools {
         m_size = obj.m_size;
         m_consumedSize = obj.m_consumedSize;
         m_id = obj.m_id;
+        m_slot = obj.m_slot;
+        m_frameNumber = obj.m_frameNumber;
 
         return *this;
     }
@@ -73,6 +79,12 @@ namespace tools {
         s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL2('i', 'd') >::RESULT,
                 m_id);
 
+        s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('s', 'l', 'o', 't') >::RESULT,
+                m_slot);
+
+        s.write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('f', 'r', 'a', 'm', 'e') >::RESULT,
+                m_frameNumber);
+
         return out;
     }
 
@@ -94,6 +106,12 @@ namespace tools {
         d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL2('i', 'd') >::RESULT,
                m_id);
 
+        d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('s', 'l', 'o', 't') >::RESULT,
+               m_slot);
+
+        d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL5('f', 'r', 'a', 'm', 'e') >::RESULT,
+               m_frameNumber);
+
         return in;
     }
 
@@ -39,7 +39,18 @@ namespace tools {
             m_sharedDataListener(NULL),
             m_out(NULL),
             m_outSharedMemoryFile(NULL) {
+            createOutputs(url, memorySegmentSize, numberOfSegments, threading, false);
+        }
+
+        Recorder::Recorder(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &recordInPlace) :
+            m_fifo(),
+            m_sharedDataListener(NULL),
+            m_out(NULL),
+            m_outSharedMemoryFile(NULL) {
+            createOutputs(url, memorySegmentSize, numberOfSegments, threading, recordInPlace);
+        }
 
+        void Recorder::createOutputs(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &recordInPlace) {
             // Get output file.
             URL _url(url);
             m_out = &(StreamFactory::getInstance().getOutputStream(_url));
@@ -49,7 +60,7 @@ namespace tools {
             m_outSharedMemoryFile = &(StreamFactory::getInstance().getOutputStream(urlSharedMemoryFile));
 
             // Create data store for shared memory.
-            m_sharedDataListener = new SharedDataListener(*m_outSharedMemoryFile, memorySegmentSize, numberOfSegments, threading);
+            m_sharedDataListener = new SharedDataListener(*m_outSharedMemoryFile, memorySegmentSize, numberOfSegments, threading, recordInPlace);
         }
 
         Recorder::~Recorder() {
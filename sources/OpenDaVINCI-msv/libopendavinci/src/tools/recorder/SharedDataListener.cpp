@@ -42,30 +42,36 @@ namespace tools {
         using namespace core::io;
         using namespace tools;
 
-        SharedDataListener::SharedDataListener(ostream &out, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading) :
+        SharedDataListener::SharedDataListener(ostream &out, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading, const bool &recordInPlace) :
             m_threading(threading),
+            m_recordInPlace(recordInPlace),
             m_sharedDataWriter(NULL),
 		    m_mapOfAvailableSharedData(),
 		    m_mapOfAvailableSharedImages(),
             m_mapOfMemories(),
             m_bufferIn(),
             m_bufferOut(),
+            m_maximumPendingEntries(numberOfMemorySegments),
+            m_recordedSharedMemories(0),
             m_droppedSharedMemories(0),
             m_sharedPointers(),
             m_out(out) {
 
-            cout << "SharedDataListener: preparing buffer...";
-            for(uint32_t id = 0; id < numberOfMemorySegments; id++) {
-                MemorySegment ms;
-                ms.m_size = memorySegmentSize;
-                ms.m_id = id;
-                void *ptr = ::malloc(ms.m_size);
-                m_mapOfMemories[ms.m_id] = static_cast<char*>(ptr);
-
-                Container c(Container::UNDEFINEDDATA, ms);
-                m_bufferIn.enter(c);
+            // Recording in place does not need any memory segments.
+            if (!m_recordInPlace) {
+                cout << "SharedDataListener: preparing buffer...";
+                for(uint32_t id = 0; id < numberOfMemorySegments; id++) {
+                    MemorySegment ms;
+                    ms.m_size = memorySegmentSize;
+                    ms.m_id = id;
+                    void *ptr = ::malloc(ms.m_size);
+                    m_mapOfMemories[ms.m_id] = static_cast<char*>(ptr);
+
+                    Container c(Container::UNDEFINEDDATA, ms);
+                    m_bufferIn.enter(c);
+                }
+                cout << "done." << endl;
             }
-            cout << "done." << endl;
 
             m_sharedDataWriter = new SharedDataWriter(m_out, m_mapOfMemories, m_bufferIn, m_bufferOut);
             if ( (m_sharedDataWriter != NULL) && (m_threading) ) {
@@ -105,30 +111,29 @@ namespace tools {
                 MemorySegment ms = c.getData<MemorySegment>();
 
                 // Copy the data.
-                SharedPointer<core::wrapper::SharedMemory> memory = m_sharedPointers[name];
-                if ( (memory.isValid()) && (memory->isValid()) ) {
+                SharedPointer<SharedFrameRing> ring = m_sharedPointers[name];
+                if ( (ring.isValid()) && (ring->isValid()) ) {
                     char *destPtr = m_mapOfMemories[ms.m_id];
 
-                    // Lock shared memory segment.                
-                    memory->lock();
-                        if (memory->getSize() < ms.m_size) {
-                            // Get pointer to shared memory segment.
-                            char *src = static_cast<char*>(memory->getSharedMemory());
-
-                            // Copy data from shared memory segment into MemorySegment data structure.
-                            ::memcpy(destPtr, src, memory->getSize());
-
+                    if (ring->getFrameSize() < ms.m_size) {
+                        // Copy the latest frame from the shared memory segment into MemorySegment data structure without blocking its producer.
+                        uint32_t frameNumber = 0;
+                        if (ring->read(destPtr, ring->getFrameSize(), frameNumber)) {
                             // Store meta information.
                             ms.m_header = header;
-                            ms.m_consumedSize = memory->getSize();
+                            ms.m_consumedSize = ring->getFrameSize();
 
                             // Save meta information.
                             c = Container(Container::UNDEFINEDDATA, ms);
 
                             copied = true;
                         }
-                    // Unlock shared memory segment.
-                    memory->unlock();
+                    }
+                }
+
+                if (!copied) {
+                    // Return unused memory segment.
+                    m_bufferIn.enter(c);
                 }
 
                 if (copied) {
@@ -140,6 +145,28 @@ namespace tools {
             return copied;
         }
 
+        bool SharedDataListener::enqueueForWritingInPlace(const string &name, const Container &header) {
+            // Drop the frame if the writer is too far behind.
+            if (m_bufferOut.getSize() >= m_maximumPendingEntries) {
+                return false;
+            }
+
+            // Remember the frame announced by header; the writer must not write any later frame instead.
+            MemorySegment ms;
+            SharedPointer<SharedFrameRing> ring = m_sharedPointers[name];
+            if ( !ring.isValid() || !ring->getLatestFrame(ms.m_slot, ms.m_frameNumber) ) {
+                return false;
+            }
+            ms.m_header = header;
+
+            // A MemorySegment without memory denotes an entry to be written in place.
+            ms.m_size = 0;
+
+            Container c(Container::UNDEFINEDDATA, ms);
+            m_bufferOut.enter(c);
+            return true;
+        }
+
         void SharedDataListener::add(const Container &container) {
             bool hasCopied = false;
 
@@ -153,13 +180,16 @@ namespace tools {
                     cout << "Connecting to shared memory " << sd.getName() << " at ";
                     
                     SharedPointer<core::wrapper::SharedMemory> sp = core::wrapper::SharedMemoryFactory::attachToSharedMemory(sd.getName());
-                    m_sharedPointers[sd.getName()] = sp;
+                    m_sharedPointers[sd.getName()] = SharedPointer<SharedFrameRing>(new SharedFrameRing(sp));
+                    if (m_recordInPlace) {
+                        m_sharedDataWriter->addSharedMemory(sd.getName(), m_sharedPointers[sd.getName()]);
+                    }
 
                     cout << sp->getSharedMemory() << " ";
 
                     cout << "done." << endl;
                 }
-                hasCopied = copySharedMemoryToMemorySegment(sd.getName(), container);
+                hasCopied = m_recordInPlace ? enqueueForWritingInPlace(sd.getName(), container) : copySharedMemoryToMemorySegment(sd.getName(), container);
             }
 
             if (container.getDataType() == Container::SHARED_IMAGE) {
@@ -172,23 +202,25 @@ namespace tools {
                     cout << "Connecting to shared image " << si.getName() << " at ";
 
                     SharedPointer<core::wrapper::SharedMemory> sp = core::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
-                    m_sharedPointers[si.getName()] = sp;
+                    m_sharedPointers[si.getName()] = SharedPointer<SharedFrameRing>(new SharedFrameRing(sp));
+                    if (m_recordInPlace) {
+                        m_sharedDataWriter->addSharedMemory(si.getName(), m_sharedPointers[si.getName()]);
+                    }
 
                     cout << sp->getSharedMemory() << " ";
 
                     cout << "done." << endl;
                 }
-                hasCopied = copySharedMemoryToMemorySegment(si.getName(), container);
+                hasCopied = m_recordInPlace ? enqueueForWritingInPlace(si.getName(), container) : copySharedMemoryToMemorySegment(si.getName(), container);
             }
 
+            m_recordedSharedMemories = m_recordedSharedMemories + (hasCopied ? 1 : 0);
             m_droppedSharedMemories = m_droppedSharedMemories + (!hasCopied ? 1 : 0);
 
             // If we are not running in threading mode, we need to trigger the disk dump manually.
             if ( (m_sharedDataWriter != NULL) && (!m_threading) ) {
                 m_sharedDataWriter->recordEntries();
             }
-
-            cout << "IN: " << m_bufferIn.getSize() << ", " << "OUT: " << m_bufferOut.getSize() << ", " << "DROPPED: " << m_droppedSharedMemories << endl;
         }
 
         void SharedDataListener::clear() {}
@@ -201,6 +233,17 @@ namespace tools {
             return (getSize() == 0);
         }
 
+        uint32_t SharedDataListener::getNumberOfRecordedSharedMemories() const {
+            // Frames to be written in place might still fail in the writer.
+            const uint32_t failed = (m_sharedDataWriter != NULL) ? m_sharedDataWriter->getNumberOfFailedEntries() : 0;
+            return m_recordedSharedMemories - failed;
+        }
+
+        uint32_t SharedDataListener::getNumberOfDroppedSharedMemories() const {
+            const uint32_t failed = (m_sharedDataWriter != NULL) ? m_sharedDataWriter->getNumberOfFailedEntries() : 0;
+            return m_droppedSharedMemories + failed;
+        }
+
     } // recorder
 } // tools
 
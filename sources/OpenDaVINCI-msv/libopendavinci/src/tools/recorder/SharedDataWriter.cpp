@@ -17,7 +17,9 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include "core/base/Lock.h"
 #include "core/base/Thread.h"
+#include "core/data/SharedData.h"
 
 #include "tools/MemorySegment.h"
 #include "tools/recorder/SharedDataWriter.h"
@@ -26,6 +28,7 @@ namespace tools {
 
     namespace recorder {
 
+        using namespace core;
         using namespace core::base;
         using namespace core::data;
         using namespace tools;
@@ -34,7 +37,11 @@ namespace tools {
             m_out(out),
             m_mapOfMemories(mapOfMemories),
             m_bufferIn(bufferIn),
-            m_bufferOut(bufferOut)
+            m_bufferOut(bufferOut),
+            m_sharedPointersMutex(),
+            m_sharedPointers(),
+            m_failedEntriesMutex(),
+            m_failedEntries(0)
         {}
 
         SharedDataWriter::~SharedDataWriter() {
@@ -50,8 +57,18 @@ namespace tools {
                 if (m_out.good()) {
                     // Get next entry to process from output queue.
                     Container c = m_bufferOut.leave();
+
                     MemorySegment ms = c.getData<MemorySegment>();
 
+                    // Entries without memory announce a frame to be written in place.
+                    if (ms.m_size == 0) {
+                        if (!writeSharedMemoryToStream(ms)) {
+                            Lock l(m_failedEntriesMutex);
+                            m_failedEntries++;
+                        }
+                        continue;
+                    }
+
                     // Get meta data to be written as header.
                     Container header = ms.m_header;
 
@@ -79,6 +96,55 @@ namespace tools {
             }
         }
 
+        void SharedDataWriter::addSharedMemory(const string &name, SharedPointer<SharedFrameRing> ring) {
+            Lock l(m_sharedPointersMutex);
+            m_sharedPointers[name] = ring;
+        }
+
+        uint32_t SharedDataWriter::getNumberOfFailedEntries() const {
+            Lock l(m_failedEntriesMutex);
+            return m_failedEntries;
+        }
+
+        bool SharedDataWriter::writeSharedMemoryToStream(const MemorySegment &ms) {
+            bool written = false;
+
+            // SharedImage is a SharedData; both start with the name of the shared memory.
+            const string name = const_cast<Container&>(ms.m_header).getData<SharedData>().getName();
+
+            // Entries are only added to m_sharedPointers, thus the ring stays valid after unlocking.
+            SharedFrameRing *ring = NULL;
+            {
+                Lock l(m_sharedPointersMutex);
+                map<string, SharedPointer<SharedFrameRing> >::iterator it = m_sharedPointers.find(name);
+                if ( (it != m_sharedPointers.end()) && (it->second.isValid()) ) {
+                    ring = it->second.operator->();
+                }
+            }
+
+            if ( (ring != NULL) && (ring->isValid()) && (m_out.good()) ) {
+                // Only the frame announced by the header is written; it is dropped if the producer has reused its slot already.
+                const char *data = ring->beginRead(ms.m_slot, ms.m_frameNumber);
+                if (data != NULL) {
+                    const streampos begin = m_out.tellp();
+
+                    m_out << ms.m_header;
+                    m_out.write(data, ring->getFrameSize());
+
+                    if (ring->endRead()) {
+                        written = m_out.good();
+                        m_out.flush();
+                    }
+                    else {
+                        // The producer overwrote the frame meanwhile; the next entry overwrites this one.
+                        m_out.seekp(begin);
+                    }
+                }
+            }
+
+            return written;
+        }
+
         void SharedDataWriter::run() {
             serviceReady();
 
@@ -21,6 +21,10 @@
 
 #include "core/base/Thread.h"
 #include "core/data/Container.h"
+#include "core/data/SharedData.h"
+#include "core/data/image/SharedImage.h"
+#include "core/io/StreamFactory.h"
+#include "core/io/URL.h"
 
 #include "tools/player/Player.h"
 #include "tools/recorder/Recorder.h"
@@ -33,6 +37,7 @@ namespace tools {
         using namespace std;
         using namespace core::base;
         using namespace core::data;
+        using namespace core::io;
         using namespace tools::player;
         using namespace tools::recorder;
 
@@ -84,5 +89,124 @@ namespace tools {
             }
         }
 
+        uint32_t Splitter::process(const string &source, const vector<SplitterOutput> &outputs) {
+            // Open the recording file and the optional shared memory dump file.
+            istream &in = StreamFactory::getInstance().getInputStream(URL("file://" + source));
+
+            istream *inSharedMemoryFile = NULL;
+            try {
+                inSharedMemoryFile = &(StreamFactory::getInstance().getInputStream(URL("file://" + source + ".mem")));
+            }
+            catch (const core::exceptions::InvalidArgumentException &iae) {
+                cerr << "Splitter: Warning: " << iae.toString() << endl;
+                inSharedMemoryFile = NULL;
+            }
+
+            // Open all output files at once.
+            vector<ostream*> outs;
+            vector<ostream*> outsSharedMemoryFile;
+            for (vector<SplitterOutput>::const_iterator it = outputs.begin(); it != outputs.end(); ++it) {
+                URL url(it->getURL());
+                outs.push_back(&(StreamFactory::getInstance().getOutputStream(url)));
+                outsSharedMemoryFile.push_back(&(StreamFactory::getInstance().getOutputStream(URL("file://" + url.getResource() + ".mem"))));
+            }
+
+            // Containers read ahead from either file that still need to be processed.
+            Container fromRecFile;
+            Container fromMemFile;
+            bool hasFromRecFile = false;
+            bool hasFromMemFile = false;
+
+            // Payload of fromMemFile.
+            vector<char> payload;
+
+            bool hasFirstTimeStamp = false;
+            TimeStamp firstTimeStamp;
+
+            uint32_t containerCounter = 0;
+            bool completed = outputs.empty();
+
+            while (!completed) {
+                // Read ahead from the recording file.
+                if (!hasFromRecFile && in.good()) {
+                    in >> fromRecFile;
+                    hasFromRecFile = (in.gcount() > 0);
+                }
+
+                // Read ahead from the shared memory dump file including the raw data.
+                if (!hasFromMemFile && (inSharedMemoryFile != NULL) && inSharedMemoryFile->good()) {
+                    *inSharedMemoryFile >> fromMemFile;
+                    if (inSharedMemoryFile->gcount() > 0) {
+                        payload.resize(getSizeOfSharedMemory(fromMemFile));
+                        if (!payload.empty()) {
+                            inSharedMemoryFile->read(&payload[0], payload.size());
+                        }
+                        hasFromMemFile = true;
+                    }
+                }
+
+                if (!hasFromRecFile && !hasFromMemFile) {
+                    break;
+                }
+
+                // Multiplex both files by their received time stamps in the same way as the Player.
+                const bool useRecFile = hasFromRecFile && (!hasFromMemFile || (fromRecFile.getReceivedTimeStamp() < fromMemFile.getReceivedTimeStamp()));
+                Container &c = (useRecFile ? fromRecFile : fromMemFile);
+
+                if (!hasFirstTimeStamp) {
+                    firstTimeStamp = c.getReceivedTimeStamp();
+                    hasFirstTimeStamp = true;
+                }
+                const TimeStamp relativeTime = c.getReceivedTimeStamp() - firstTimeStamp;
+
+                completed = true;
+                for (uint32_t i = 0; i < outputs.size(); i++) {
+                    if (outputs.at(i).accept(containerCounter, relativeTime, c.getDataType())) {
+                        if (useRecFile) {
+                            (*outs.at(i)) << c;
+                        }
+                        else {
+                            (*outsSharedMemoryFile.at(i)) << c;
+                            if (!payload.empty()) {
+                                outsSharedMemoryFile.at(i)->write(&payload[0], payload.size());
+                            }
+                        }
+                    }
+                    completed &= outputs.at(i).isCompleted(containerCounter, relativeTime);
+                }
+
+                if (useRecFile) {
+                    hasFromRecFile = false;
+                }
+                else {
+                    hasFromMemFile = false;
+                }
+
+                containerCounter++;
+            }
+
+            for (uint32_t i = 0; i < outputs.size(); i++) {
+                outs.at(i)->flush();
+                outsSharedMemoryFile.at(i)->flush();
+            }
+
+            return containerCounter;
+        }
+
+        uint32_t Splitter::getSizeOfSharedMemory(Container &c) const {
+            uint32_t size = 0;
+
+            if (c.getDataType() == Container::SHARED_IMAGE) {
+                core::data::image::SharedImage si = c.getData<core::data::image::SharedImage>();
+                size = si.getSize();
+            }
+            else if (c.getDataType() == Container::SHARED_DATA) {
+                SharedData sd = c.getData<SharedData>();
+                size = sd.getSize();
+            }
+
+            return size;
+        }
+
     } // splitter
 } // tools
@@ -0,0 +1,105 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "tools/splitter/SplitterOutput.h"
+
+namespace tools {
+    namespace splitter {
+
+        using namespace std;
+        using namespace core::data;
+
+        SplitterOutput::SplitterOutput(const string &url) :
+            m_url(url),
+            m_hasContainerRange(false),
+            m_start(0),
+            m_end(0),
+            m_hasTimeRange(false),
+            m_startTime(),
+            m_endTime(),
+            m_dataTypes() {}
+
+        SplitterOutput::SplitterOutput(const SplitterOutput &obj) :
+            m_url(obj.m_url),
+            m_hasContainerRange(obj.m_hasContainerRange),
+            m_start(obj.m_start),
+            m_end(obj.m_end),
+            m_hasTimeRange(obj.m_hasTimeRange),
+            m_startTime(obj.m_startTime),
+            m_endTime(obj.m_endTime),
+            m_dataTypes(obj.m_dataTypes) {}
+
+        SplitterOutput& SplitterOutput::operator=(const SplitterOutput &obj) {
+            m_url = obj.m_url;
+            m_hasContainerRange = obj.m_hasContainerRange;
+            m_start = obj.m_start;
+            m_end = obj.m_end;
+            m_hasTimeRange = obj.m_hasTimeRange;
+            m_startTime = obj.m_startTime;
+            m_endTime = obj.m_endTime;
+            m_dataTypes = obj.m_dataTypes;
+
+            return *this;
+        }
+
+        SplitterOutput::~SplitterOutput() {}
+
+        const string SplitterOutput::getURL() const {
+            return m_url;
+        }
+
+        void SplitterOutput::setContainerRange(const uint32_t &start, const uint32_t &end) {
+            m_hasContainerRange = true;
+            m_start = start;
+            m_end = end;
+        }
+
+        void SplitterOutput::setTimeRange(const TimeStamp &start, const TimeStamp &end) {
+            m_hasTimeRange = true;
+            m_startTime = start;
+            m_endTime = end;
+        }
+
+        void SplitterOutput::addDataType(const Container::DATATYPE &dataType) {
+            m_dataTypes.insert(dataType);
+        }
+
+        bool SplitterOutput::accept(const uint32_t &index, const TimeStamp &relativeTime, const Container::DATATYPE &dataType) const {
+            if (m_hasContainerRange && ( (index < m_start) || (index > m_end) ) ) {
+                return false;
+            }
+
+            if (m_hasTimeRange && ( (relativeTime < m_startTime) || (relativeTime > m_endTime) ) ) {
+                return false;
+            }
+
+            if (!m_dataTypes.empty() && (m_dataTypes.find(dataType) == m_dataTypes.end())) {
+                return false;
+            }
+
+            return true;
+        }
+
+        bool SplitterOutput::isCompleted(const uint32_t &index, const TimeStamp &relativeTime) const {
+            return (m_hasContainerRange && (index > m_end)) ||
+                   (m_hasTimeRange && (relativeTime > m_endTime));
+        }
+
+    } // splitter
+} // tools
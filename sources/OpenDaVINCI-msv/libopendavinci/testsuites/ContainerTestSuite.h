@@ -67,6 +67,31 @@ class ContainerTest : public CxxTest::TestSuite {
                 TS_ASSERT(ts.toString() == ts2.toString());
             }
         }
+
+        void testContainerSerializedDataSize() {
+            TimeStamp ts;
+            Container c(Container::TIMESTAMP, ts);
+
+            stringstream s;
+            s << ts;
+            const uint32_t size = s.str().length();
+            TS_ASSERT(size > 0);
+            TS_ASSERT(c.getSerializedDataSize() == size);
+
+            // Determining the size must not interfere with reading the data.
+            TimeStamp ts2 = c.getData<TimeStamp>();
+            TS_ASSERT(c.getSerializedDataSize() == size);
+            TS_ASSERT(ts.toString() == ts2.toString());
+
+            stringstream s2;
+            s2 << c;
+            Container c2;
+            s2 >> c2;
+            TS_ASSERT(c2.getSerializedDataSize() == size);
+
+            Container empty;
+            TS_ASSERT(empty.getSerializedDataSize() == 0);
+        }
 };
 
 #endif /*CORE_CONTAINERTESTSUITE_H_*/
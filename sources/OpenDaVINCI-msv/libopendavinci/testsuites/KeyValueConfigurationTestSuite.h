@@ -25,6 +25,7 @@
 #include <sstream>
 #include <string>
 
+#include "core/base/ConfigurationValue.h"
 #include "core/base/KeyValueConfiguration.h"
 #include "core/exceptions/Exceptions.h"
 
@@ -233,6 +234,42 @@ class ConfigurationTest : public CxxTest::TestSuite {
 
             TS_ASSERT_DELTA(key4, 3.1415, 1e-3);
         }
+
+        void testConfigurationValue() {
+            stringstream s;
+            s << "Section1.key1=String1" << endl
+            << "Section1.key2=10" << endl
+            << "Section1.key3=3.1415 # Comment" << endl
+            << "Section1.key4=1" << endl;
+
+            KeyValueConfiguration kvc;
+            s >> kvc;
+
+            const ConfigurationValue<string> key1(kvc, "Section1.key1");
+            const ConfigurationValue<int32_t> key2(kvc, "SECTION1.key2");
+            const ConfigurationValue<double> key3(kvc, "Section1.key3");
+            const ConfigurationValue<bool> key4(kvc, "Section1.key4");
+            const ConfigurationValue<double> key5(kvc, "Section1.key5", 2.5);
+
+            TS_ASSERT(key1.get() == "String1");
+            TS_ASSERT(key2 == 10);
+            TS_ASSERT_DELTA(key3 * 2, 6.283, 1e-3);
+            TS_ASSERT(key4);
+            TS_ASSERT_DELTA(key5, 2.5, 1e-5);
+
+            // Copies keep the value.
+            const ConfigurationValue<int32_t> copyOfKey2(key2);
+            TS_ASSERT(copyOfKey2 == 10);
+
+            bool keyNotFound = false;
+            try {
+                ConfigurationValue<double> key6(kvc, "Section1.key6");
+            }
+            catch (const ValueForKeyNotFoundException &e) {
+                keyNotFound = true;
+            }
+            TS_ASSERT(keyNotFound);
+        }
 };
 
 #endif /*CORE_KEYVALUECONFIGURATIONTESTSUITE_H_*/
@@ -39,6 +39,7 @@
 #include "core/base/Thread.h"
 #include "core/data/Container.h"
 #include "core/data/SerializableData.h"
+#include "core/data/TimeStamp.h"
 
 using namespace std;
 using namespace core::base;
@@ -271,6 +272,37 @@ class QueueTest : public CxxTest::TestSuite {
             producer.stop();
         }
 
+        void testWaitForDataWithTimeout() {
+            FIFOQueue fifo;
+
+            TimeStamp before;
+            TS_ASSERT(!fifo.waitForData(50));
+            TimeStamp after;
+            TS_ASSERT((after - before).toMicroseconds() >= 40000);
+
+            fifo.add(Container(Container::TIMESTAMP, TimeStamp()));
+            TS_ASSERT(fifo.waitForData(50));
+            TS_ASSERT(fifo.getSize() == 1);
+        }
+
+        void testFIFOWithMaximumSize() {
+            FIFOQueue fifo(2);
+
+            for (int32_t i = 1; i <= 3; i++) {
+                QueueTestSampleData data;
+                data.m_int = i;
+                fifo.enter(Container(Container::UNDEFINEDDATA, data));
+            }
+
+            // The oldest element was discarded.
+            TS_ASSERT(fifo.getSize() == 2);
+            Container c = fifo.leave();
+            TS_ASSERT(c.getData<QueueTestSampleData>().m_int == 2);
+            c = fifo.leave();
+            TS_ASSERT(c.getData<QueueTestSampleData>().m_int == 3);
+            TS_ASSERT(fifo.isEmpty());
+        }
+
         void testBufferedFIFOAsRegularFIFO() {
             Condition blockTestCase;
             BufferedFIFOQueue bufferedFifo;
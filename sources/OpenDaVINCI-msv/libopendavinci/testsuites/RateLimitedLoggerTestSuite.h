@@ -0,0 +1,75 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_RATELIMITEDLOGGERTESTSUITE_H_
+#define CORE_RATELIMITEDLOGGERTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <sstream>
+#include <string>
+
+#include "core/base/RateLimitedLogger.h"
+#include "core/data/TimeStamp.h"
+
+using namespace std;
+using namespace core::base;
+using namespace core::data;
+
+class RateLimitedLoggerTest : public CxxTest::TestSuite {
+    public:
+        void testLogOncePerInterval() {
+            stringstream out;
+            RateLimitedLogger logger(out, 100);
+
+            TimeStamp t0(10, 0);
+            TS_ASSERT(logger.isDue(t0));
+            logger.log(t0, "A");
+
+            TimeStamp t1(10, 50000);
+            TS_ASSERT(!logger.isDue(t1));
+            logger.log(t1, "B");
+            logger.log(t1, "C");
+
+            TimeStamp t2(10, 100000);
+            TS_ASSERT(logger.isDue(t2));
+            logger.log(t2, "D");
+
+            TS_ASSERT(out.str() == "A\nD (2 messages suppressed)\n");
+            TS_ASSERT(logger.getNumberOfSuppressedMessages() == 2);
+        }
+
+        void testLogEventIsNotLimited() {
+            stringstream out;
+            RateLimitedLogger logger(out, 100);
+
+            TimeStamp t0(10, 0);
+            logger.log(t0, "A");
+            logger.logEvent("E1");
+            logger.logEvent("E2");
+
+            TimeStamp t1(10, 10000);
+            logger.log(t1, "B");
+
+            TS_ASSERT(out.str() == "A\nE1\nE2\n");
+            TS_ASSERT(logger.getNumberOfSuppressedMessages() == 1);
+        }
+};
+
+#endif /*CORE_RATELIMITEDLOGGERTESTSUITE_H_*/
@@ -23,6 +23,7 @@
 #include "cxxtest/TestSuite.h"
 
 #include "core/SharedPointer.h"
+#include "core/base/SharedFrameRing.h"
 #include "core/data/SharedData.h"
 #include "core/wrapper/SharedMemory.h"
 #include "core/wrapper/SharedMemoryFactory.h"
@@ -94,6 +95,213 @@ class SharedMemoryTest : public CxxTest::TestSuite {
             memClient->unlock();
         }
 
+        void testSharedMemoryWithSimilarNames() {
+            // Both names exceed the length limit for semaphores and share the same prefix.
+            core::SharedPointer<core::wrapper::SharedMemory> memServer1 = core::wrapper::SharedMemoryFactory::createSharedMemory("SharedMemoryTestWithLongName1", 10);
+            core::SharedPointer<core::wrapper::SharedMemory> memServer2 = core::wrapper::SharedMemoryFactory::createSharedMemory("SharedMemoryTestWithLongName2", 20);
+            TS_ASSERT(memServer1->isValid());
+            TS_ASSERT(memServer2->isValid());
+
+            ::memset(memServer1->getSharedMemory(), '1', memServer1->getSize());
+            ::memset(memServer2->getSharedMemory(), '2', memServer2->getSize());
+
+            core::SharedPointer<core::wrapper::SharedMemory> memClient1 = core::wrapper::SharedMemoryFactory::attachToSharedMemory("SharedMemoryTestWithLongName1");
+            core::SharedPointer<core::wrapper::SharedMemory> memClient2 = core::wrapper::SharedMemoryFactory::attachToSharedMemory("SharedMemoryTestWithLongName2");
+            TS_ASSERT(memClient1->isValid());
+            TS_ASSERT(memClient2->isValid());
+            TS_ASSERT(memClient1->getSize() == 10);
+            TS_ASSERT(memClient2->getSize() == 20);
+
+            for (uint32_t i = 0; i < memClient1->getSize(); i++) {
+                TS_ASSERT(*(((char*)(memClient1->getSharedMemory())) + i) == '1');
+            }
+            for (uint32_t i = 0; i < memClient2->getSize(); i++) {
+                TS_ASSERT(*(((char*)(memClient2->getSharedMemory())) + i) == '2');
+            }
+        }
+
+        void testAttachToMissingSharedMemory() {
+            core::SharedPointer<core::wrapper::SharedMemory> memClient = core::wrapper::SharedMemoryFactory::attachToSharedMemory("SharedMemoryTestMissing");
+            TS_ASSERT(!memClient->isValid());
+        }
+
+        void testSharedFrameRing() {
+            const uint32_t FRAME_SIZE = 10;
+            core::SharedPointer<core::wrapper::SharedMemory> memServer = core::wrapper::SharedMemoryFactory::createSharedMemory("SharedFrameRingTest", core::base::SharedFrameRing::getRequiredSize(FRAME_SIZE, 3));
+            TS_ASSERT(memServer->isValid());
+
+            core::base::SharedFrameRing producer(memServer, FRAME_SIZE, 3);
+            TS_ASSERT(producer.isFrameRing());
+            TS_ASSERT(producer.getFrameSize() == FRAME_SIZE);
+            TS_ASSERT(producer.getNumberOfSlots() == 3);
+            TS_ASSERT(producer.getLatestFrameNumber() == 0);
+
+            core::base::SharedFrameRing consumer(core::wrapper::SharedMemoryFactory::attachToSharedMemory("SharedFrameRingTest"));
+            TS_ASSERT(consumer.isFrameRing());
+            TS_ASSERT(consumer.getFrameSize() == FRAME_SIZE);
+            TS_ASSERT(consumer.getNumberOfSlots() == 3);
+
+            // Consumers must not modify the ring.
+            TS_ASSERT(consumer.beginWrite() == NULL);
+
+            char frame[FRAME_SIZE];
+            uint32_t frameNumber = 0;
+
+            // Nothing published yet.
+            TS_ASSERT(!consumer.read(frame, FRAME_SIZE, frameNumber));
+
+            for (uint32_t n = 1; n < 6; n++) {
+                char *dest = producer.beginWrite();
+                TS_ASSERT(dest != NULL);
+                for (uint32_t i = 0; i < FRAME_SIZE; i++) {
+                    dest[i] = static_cast<char>('A' + n + i);
+                }
+                producer.endWrite();
+
+                TS_ASSERT(consumer.getLatestFrameNumber() == n);
+                TS_ASSERT(consumer.read(frame, FRAME_SIZE, frameNumber));
+                TS_ASSERT(frameNumber == n);
+                for (uint32_t i = 0; i < FRAME_SIZE; i++) {
+                    TS_ASSERT(frame[i] == static_cast<char>('A' + n + i));
+                }
+            }
+
+            // A frame being written is invisible to consumers which still get the latest published one.
+            char *dest = producer.beginWrite();
+            TS_ASSERT(dest != NULL);
+            ::memset(dest, 'x', FRAME_SIZE);
+
+            TS_ASSERT(consumer.read(frame, FRAME_SIZE, frameNumber));
+            TS_ASSERT(frameNumber == 5);
+            TS_ASSERT(frame[0] == static_cast<char>('A' + 5));
+
+            producer.endWrite();
+
+            TS_ASSERT(consumer.read(frame, FRAME_SIZE, frameNumber));
+            TS_ASSERT(frameNumber == 6);
+            TS_ASSERT(frame[0] == 'x');
+        }
+
+        void testSharedFrameRingReadInPlace() {
+            const uint32_t FRAME_SIZE = 10;
+            core::SharedPointer<core::wrapper::SharedMemory> memServer = core::wrapper::SharedMemoryFactory::createSharedMemory("SharedFrameRingInPlaceTest", core::base::SharedFrameRing::getRequiredSize(FRAME_SIZE, 3));
+            TS_ASSERT(memServer->isValid());
+
+            core::base::SharedFrameRing producer(memServer, FRAME_SIZE, 3);
+            core::base::SharedFrameRing consumer(core::wrapper::SharedMemoryFactory::attachToSharedMemory("SharedFrameRingInPlaceTest"));
+            TS_ASSERT(consumer.isFrameRing());
+
+            // Nothing published yet.
+            uint32_t frameNumber = 0;
+            TS_ASSERT(consumer.beginRead(frameNumber) == NULL);
+            TS_ASSERT(!consumer.endRead());
+
+            char *dest = producer.beginWrite();
+            ::memset(dest, 'a', FRAME_SIZE);
+            producer.endWrite();
+
+            const char *data = consumer.beginRead(frameNumber);
+            TS_ASSERT(data != NULL);
+            TS_ASSERT(frameNumber == 1);
+            TS_ASSERT(data[0] == 'a');
+            TS_ASSERT(data[FRAME_SIZE - 1] == 'a');
+            TS_ASSERT(consumer.endRead());
+
+            // The frame being read survives numberOfSlots - 1 newer frames...
+            data = consumer.beginRead(frameNumber);
+            TS_ASSERT(data != NULL);
+            for (uint32_t n = 0; n < 2; n++) {
+                dest = producer.beginWrite();
+                ::memset(dest, 'b', FRAME_SIZE);
+                producer.endWrite();
+            }
+            TS_ASSERT(data[0] == 'a');
+            TS_ASSERT(consumer.endRead());
+
+            // ... but not more.
+            data = consumer.beginRead(frameNumber);
+            TS_ASSERT(data != NULL);
+            TS_ASSERT(frameNumber == 3);
+            for (uint32_t n = 0; n < 3; n++) {
+                dest = producer.beginWrite();
+                ::memset(dest, 'c', FRAME_SIZE);
+                producer.endWrite();
+            }
+            TS_ASSERT(!consumer.endRead());
+        }
+
+        void testSharedFrameRingReadGivenFrameInPlace() {
+            const uint32_t FRAME_SIZE = 10;
+            core::SharedPointer<core::wrapper::SharedMemory> memServer = core::wrapper::SharedMemoryFactory::createSharedMemory("SharedFrameRingGivenFrameTest", core::base::SharedFrameRing::getRequiredSize(FRAME_SIZE, 3));
+            TS_ASSERT(memServer->isValid());
+
+            core::base::SharedFrameRing producer(memServer, FRAME_SIZE, 3);
+            core::base::SharedFrameRing consumer(core::wrapper::SharedMemoryFactory::attachToSharedMemory("SharedFrameRingGivenFrameTest"));
+            TS_ASSERT(consumer.isFrameRing());
+
+            // Nothing published yet.
+            uint32_t slot = 0;
+            uint32_t frameNumber = 0;
+            TS_ASSERT(!consumer.getLatestFrame(slot, frameNumber));
+
+            char *dest = producer.beginWrite();
+            ::memset(dest, 'a', FRAME_SIZE);
+            producer.endWrite();
+
+            TS_ASSERT(consumer.getLatestFrame(slot, frameNumber));
+            TS_ASSERT(frameNumber == 1);
+
+            // The given frame is read although newer frames were published meanwhile...
+            for (uint32_t n = 0; n < 2; n++) {
+                dest = producer.beginWrite();
+                ::memset(dest, 'b', FRAME_SIZE);
+                producer.endWrite();
+            }
+            const char *data = consumer.beginRead(slot, frameNumber);
+            TS_ASSERT(data != NULL);
+            TS_ASSERT(data[0] == 'a');
+            TS_ASSERT(data[FRAME_SIZE - 1] == 'a');
+            TS_ASSERT(consumer.endRead());
+
+            // ... but not after its slot was reused.
+            dest = producer.beginWrite();
+            ::memset(dest, 'c', FRAME_SIZE);
+            producer.endWrite();
+            TS_ASSERT(consumer.beginRead(slot, frameNumber) == NULL);
+            TS_ASSERT(!consumer.endRead());
+        }
+
+        void testSharedFrameRingOnPlainSharedMemory() {
+            core::SharedPointer<core::wrapper::SharedMemory> memServer = core::wrapper::SharedMemoryFactory::createSharedMemory("SharedFrameRingPlainTest", 10);
+            TS_ASSERT(memServer->isValid());
+            memServer->lock();
+            for (uint32_t i = 0; i < memServer->getSize(); i++) {
+                *(((char*)(memServer->getSharedMemory())) + i) = ('A' + i);
+            }
+            memServer->unlock();
+
+            core::base::SharedFrameRing consumer(core::wrapper::SharedMemoryFactory::attachToSharedMemory("SharedFrameRingPlainTest"));
+            TS_ASSERT(consumer.isValid());
+            TS_ASSERT(!consumer.isFrameRing());
+            TS_ASSERT(consumer.getFrameSize() == 10);
+
+            char frame[10];
+            uint32_t frameNumber = 1;
+            TS_ASSERT(consumer.read(frame, 10, frameNumber));
+            TS_ASSERT(frameNumber == 0);
+            for (uint32_t i = 0; i < 10; i++) {
+                TS_ASSERT(frame[i] == (char)('A' + i));
+            }
+
+            // Plain segments are locked while being read in place.
+            const char *data = consumer.beginRead(frameNumber);
+            TS_ASSERT(data != NULL);
+            TS_ASSERT(frameNumber == 0);
+            TS_ASSERT(data[9] == 'J');
+            TS_ASSERT(consumer.endRead());
+            TS_ASSERT(!consumer.endRead());
+        }
+
 };
 
 #endif /*CORE_SHAREDMEMORYTESTSUITE_H_*/
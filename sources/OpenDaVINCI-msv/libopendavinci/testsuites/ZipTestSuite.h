@@ -35,17 +35,42 @@ using namespace std;
 
 class ZipTest : public CxxTest::TestSuite {
     public:
-        void testDecompression() {
+        /**
+         * This method creates a zip file containing "file1" and
+         * "directory/file2".
+         *
+         * @param fileName Name of the zip file to be created.
+         */
+        void createZipFile(const string &fileName) {
             // Create zip file.
             stringstream archiveData;
             archiveData.str("80 75 3 4 10 0 0 0 0 0 -114 100 87 57 0 0 0 0 0 0 0 0 0 0 0 0 10 0 21 0 100 105 114 101 99 116 111 114 121 47 85 84 9 0 3 -85 83 0 73 -64 83 0 73 85 120 4 0 -24 3 -24 3 80 75 3 4 20 0 0 0 8 0 -114 100 87 57 -97 -108 -57 22 57 0 0 0 76 0 0 0 15 0 21 0 100 105 114 101 99 116 111 114 121 47 70 105 76 101 50 85 84 9 0 3 -85 83 0 73 -89 83 0 73 85 120 4 0 -24 3 -24 3 115 -55 76 45 86 -56 44 46 81 72 -51 -52 83 -88 42 79 -51 44 73 45 82 8 73 45 46 -47 -29 114 65 -110 74 -123 -54 41 68 -91 102 -26 -92 42 0 -43 -90 0 -43 65 -60 -14 20 92 18 75 82 51 -11 -72 0 80 75 3 4 20 0 0 0 8 0 118 100 87 57 3 -1 -119 86 40 0 0 0 47 0 0 0 5 0 21 0 102 105 108 101 49 85 84 9 0 3 127 83 0 73 127 83 0 73 85 120 4 0 -24 3 -24 3 115 -55 76 45 86 -56 44 46 81 72 -51 -52 83 8 73 45 46 -47 -29 114 65 18 74 85 -88 42 79 -51 44 73 85 -120 74 -51 -52 73 -43 -29 2 0 80 75 1 2 23 3 10 0 0 0 0 0 -114 100 87 57 0 0 0 0 0 0 0 0 0 0 0 0 10 0 13 0 0 0 0 0 0 0 16 0 -19 65 0 0 0 0 100 105 114 101 99 116 111 114 121 47 85 84 5 0 3 -85 83 0 73 85 120 0 0 80 75 1 2 23 3 20 0 0 0 8 0 -114 100 87 57 -97 -108 -57 22 57 0 0 0 76 0 0 0 15 0 13 0 0 0 0 0 1 0 0 0 -92 -127 61 0 0 0 100 105 114 101 99 116 111 114 121 47 70 105 76 101 50 85 84 5 0 3 -85 83 0 73 85 120 0 0 80 75 1 2 23 3 20 0 0 0 8 0 118 100 87 57 3 -1 -119 86 40 0 0 0 47 0 0 0 5 0 13 0 0 0 0 0 1 0 0 0 -92 -127 -72 0 0 0 102 105 108 101 49 85 84 5 0 3 127 83 0 73 85 120 0 0 80 75 5 6 0 0 0 0 3 0 3 0 -49 0 0 0 24 1 0 0 0 0");
             int32_t data = 0;
-            fstream fout("ZipTest.zip", ios::binary | ios::out);
+            fstream fout(fileName.c_str(), ios::binary | ios::out);
             while (archiveData.good()) {
                 archiveData >> data;
                 fout << (char)data;
             }
             fout.close();
+        }
+
+        /**
+         * This method reads the given stream completely.
+         *
+         * @param stream Stream to be read.
+         * @return Contents of the stream.
+         */
+        string readAll(istream &stream) {
+            char c;
+            stringstream data;
+            while (stream.get(c)) {
+                data << c;
+            }
+            return data.str();
+        }
+
+        void testDecompression() {
+            createZipFile("ZipTest.zip");
 
             fstream fin("ZipTest.zip", ios::binary | ios::in);
             core::wrapper::DecompressedData *dd = core::wrapper::CompressionFactory::getContents(fin);
@@ -94,6 +119,73 @@ class ZipTest : public CxxTest::TestSuite {
             UNLINK("ZipTest.zip");
         }
 
+        void testDecompressionFromMissingFile() {
+            UNLINK("ZipTestMissing.zip");
+
+            core::wrapper::DecompressedData *dd = core::wrapper::CompressionFactory::getContents(string("ZipTestMissing.zip"));
+            if (dd != NULL) {
+                TS_ASSERT(dd->getListOfEntries().size() == 0);
+                TS_ASSERT(dd->getInputStreamFor("file1") == NULL);
+            }
+            delete dd;
+        }
+
+        void testDecompressionFromFileReadingEntryTwice() {
+            createZipFile("ZipTestFile.zip");
+
+            core::wrapper::DecompressedData *dd = core::wrapper::CompressionFactory::getContents(string("ZipTestFile.zip"));
+            TS_ASSERT(dd != NULL);
+
+            stringstream originalData;
+            originalData << "Dies ist ein Test." << endl
+            << "Dies ist eine zweite Zeile." << endl;
+
+            // The first access decompresses the entry.
+            istream *stream = dd->getInputStreamFor("file1");
+            TS_ASSERT(stream != NULL);
+            if (stream != NULL) {
+                TS_ASSERT(readAll(*stream) == originalData.str());
+            }
+
+            // The second access returns the entry from the beginning again.
+            stream = dd->getInputStreamFor("FILE1");
+            TS_ASSERT(stream != NULL);
+            if (stream != NULL) {
+                TS_ASSERT(readAll(*stream) == originalData.str());
+            }
+
+            TS_ASSERT(dd->getInputStreamFor("file3") == NULL);
+
+            delete dd;
+
+            UNLINK("ZipTestFile.zip");
+        }
+
+        void testDecompressionFromFileWithoutReadingEntry() {
+            createZipFile("ZipTestFile.zip");
+
+            // Entries are listed without being decompressed.
+            core::wrapper::DecompressedData *dd = core::wrapper::CompressionFactory::getContents(string("ZipTestFile.zip"));
+            TS_ASSERT(dd != NULL);
+            TS_ASSERT(dd->getListOfEntries().size() == 3);
+            delete dd;
+
+            // Only the requested entry is decompressed.
+            dd = core::wrapper::CompressionFactory::getContents(string("ZipTestFile.zip"));
+            TS_ASSERT(dd != NULL);
+            istream *stream = dd->getInputStreamFor("directory/file2");
+            TS_ASSERT(stream != NULL);
+            if (stream != NULL) {
+                stringstream originalData;
+                originalData << "Dies ist ein zweiter Test." << endl
+                << "Dies ist eine zweite Zeile in der zweiten Datei." << endl;
+
+                TS_ASSERT(readAll(*stream) == originalData.str());
+            }
+            delete dd;
+
+            UNLINK("ZipTestFile.zip");
+        }
 };
 
 #endif /*CORE_ZIPTESTSUITE_H_*/
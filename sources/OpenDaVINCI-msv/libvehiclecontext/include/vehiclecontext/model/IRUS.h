@@ -31,6 +31,7 @@
 #include "hesperia/data/environment/Polygon.h"
 
 #include "vehiclecontext/model/PointSensor.h"
+#include "vehiclecontext/model/PolygonIndex.h"
 
 namespace vehiclecontext {
     namespace model {
@@ -57,6 +58,11 @@ namespace vehiclecontext {
                 IRUS& operator=(const IRUS&);
 
             public:
+                enum {
+                    /* Obstacle ID of the first sensor's FOV; obstacles with other IDs are considered by all sensors. */
+                    FOV_OBSTACLE_ID = 9000
+                };
+
                 /**
                  * Constructor to create a IRUS.
                  *
@@ -91,10 +97,13 @@ namespace vehiclecontext {
 
                 uint32_t m_numberOfPolygons;
                 map<uint32_t, hesperia::data::environment::Polygon> m_mapOfPolygons;
+                PolygonIndex m_polygonIndex;
                 vector<uint32_t> m_listOfPolygonsInsideFOV;
                 map<string, PointSensor*> m_mapOfPointSensors;
                 map<string, double> m_distances;
                 map<string, hesperia::data::environment::Polygon> m_FOVs;
+                double m_FOVInterval;
+                double m_lastFOVUpdate;
         };
 
     }
@@ -0,0 +1,107 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_MODEL_NOISEGENERATOR_H_
+#define VEHICLECONTEXT_MODEL_NOISEGENERATOR_H_
+
+#include <stdint.h>
+
+namespace vehiclecontext {
+    namespace model {
+
+        /**
+         * This class generates pseudo random numbers for the fault models
+         * of the simulated sensors and vehicles. Every model owns its own
+         * generator (Marsaglia's xorshift128) so that the same seed always
+         * yields the same sequence regardless of other models or threads
+         * drawing random numbers.
+         */
+        class NoiseGenerator {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param seed Seed for the sequence.
+                 */
+                NoiseGenerator(const uint32_t &seed);
+
+                /**
+                 * Copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                NoiseGenerator(const NoiseGenerator &obj);
+
+                virtual ~NoiseGenerator();
+
+                /**
+                 * Assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                NoiseGenerator& operator=(const NoiseGenerator &obj);
+
+                /**
+                 * This method restarts the sequence for the given seed.
+                 *
+                 * @param seed Seed for the sequence.
+                 */
+                void setSeed(const uint32_t &seed);
+
+                /**
+                 * @return Next number from the range [0 .. 2^32-1].
+                 */
+                uint32_t next();
+
+                /**
+                 * @return Next number from the range [0 .. 1).
+                 */
+                double nextUniform();
+
+                /**
+                 * @param minimum Lower bound.
+                 * @param maximum Upper bound.
+                 * @return Next number from the range [minimum .. maximum).
+                 */
+                double nextUniform(const double &minimum, const double &maximum);
+
+                /**
+                 * This method returns the next normal distributed number
+                 * using the Box-Muller transform.
+                 *
+                 * @param mean Mean of the distribution.
+                 * @param standardDeviation Standard deviation of the distribution.
+                 * @return Next number from the normal distribution.
+                 */
+                double nextGaussian(const double &mean, const double &standardDeviation);
+
+            private:
+                uint32_t m_x;
+                uint32_t m_y;
+                uint32_t m_z;
+                uint32_t m_w;
+                bool m_hasSpareGaussian;
+                double m_spareGaussian;
+        };
+
+    }
+} // vehiclecontext::model
+
+#endif /*VEHICLECONTEXT_MODEL_NOISEGENERATOR_H_*/
@@ -22,10 +22,14 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include "core/data/environment/Point3.h"
 #include "hesperia/data/environment/Polygon.h"
 
+#include "vehiclecontext/model/NoiseGenerator.h"
+#include "vehiclecontext/model/PolygonIndex.h"
+
 namespace vehiclecontext {
     namespace model {
 
@@ -69,8 +73,10 @@ namespace vehiclecontext {
                  * @param showFOV Show FOV in monitor.
                  * @param faultModelSkip Skip n% of the frames.
                  * @param faultModelNoise Add random noise data from the range [-faultModelNoise .. +faultModelNoise].
+                 * @param faultModelGaussianNoise Add normal distributed noise data with this standard deviation.
+                 * @param faultModelSeed Seed for this sensor's noise.
                  */
-                PointSensor(const uint16_t &id, const string &name, const core::data::environment::Point3 &translation, const double &rotZ, const double &angleFOV, const double &distanceFOV, const double &clampDistance, const bool &showFOV, const double &faultModelSkip, const double &faultModelNoise);
+                PointSensor(const uint16_t &id, const string &name, const core::data::environment::Point3 &translation, const double &rotZ, const double &angleFOV, const double &distanceFOV, const double &clampDistance, const bool &showFOV, const double &faultModelSkip, const double &faultModelNoise, const double &faultModelGaussianNoise, const uint32_t &faultModelSeed);
 
                 virtual ~PointSensor();
 
@@ -90,6 +96,15 @@ namespace vehiclecontext {
                  */
                 double getDistance(map<uint32_t, hesperia::data::environment::Polygon> &mapOfPolygons);
 
+                /**
+                 * This methods calculates the distance considering only
+                 * those polygons which might overlap with the current FOV.
+                 *
+                 * @param index Index of polygons to query.
+                 * @return distance to the closest line or -1.
+                 */
+                double getDistance(const PolygonIndex &index);
+
                 bool hasShowFOV() const;
 
                 const string getName() const;
@@ -110,13 +125,33 @@ namespace vehiclecontext {
                 unsigned int m_faultModelSkipCounter;
                 double m_faultModelSkip;
                 double m_faultModelNoise;
+                double m_faultModelGaussianNoise;
+                NoiseGenerator m_noiseGenerator;
 
                 double m_totalRotation;
 
                 hesperia::data::environment::Polygon m_FOV;
                 core::data::environment::Point3 m_sensorPosition;
+                vector<const hesperia::data::environment::Polygon*> m_candidates;
 
                 bool isInFOV(const core::data::environment::Point3 &pt) const;
+
+                /**
+                 * This method reduces distanceToSensor to the distance of
+                 * the closest point of p inside the FOV.
+                 *
+                 * @param p Polygon to intersect with the FOV.
+                 * @param distanceToSensor Closest distance so far or -1.
+                 */
+                void updateDistance(const hesperia::data::environment::Polygon &p, double &distanceToSensor) const;
+
+                /**
+                 * This method clamps the distance and applies the fault model.
+                 *
+                 * @param distanceToSensor Measured distance or -1.
+                 * @return Distance to be reported.
+                 */
+                double applyFaultModel(double distanceToSensor);
         };
 
     }
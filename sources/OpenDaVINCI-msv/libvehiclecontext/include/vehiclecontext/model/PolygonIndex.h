@@ -0,0 +1,179 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_MODEL_POLYGONINDEX_H_
+#define VEHICLECONTEXT_MODEL_POLYGONINDEX_H_
+
+#include <map>
+#include <vector>
+
+#include "hesperia/data/environment/Polygon.h"
+
+namespace vehiclecontext {
+    namespace model {
+
+        using namespace std;
+
+        /**
+         * This class indexes polygons by their axis-aligned bounding boxes
+         * to quickly find all polygons which might overlap with a given
+         * area like a sensor's field of view.
+         *
+         * Static polygons from the scenario are stored once in a bounding
+         * volume hierarchy which is built by build(...). Dynamic polygons,
+         * i.e. obstacles which move or disappear during the simulation, are
+         * expected to be few and are kept in a separate map which is tested
+         * linearly.
+         */
+        class PolygonIndex {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                PolygonIndex(const PolygonIndex &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                PolygonIndex& operator=(const PolygonIndex &/*obj*/);
+
+            public:
+                PolygonIndex();
+
+                virtual ~PolygonIndex();
+
+                /**
+                 * This method replaces all static polygons and builds
+                 * the bounding volume hierarchy.
+                 *
+                 * @param mapOfPolygons Static polygons.
+                 */
+                void build(const map<uint32_t, hesperia::data::environment::Polygon> &mapOfPolygons);
+
+                /**
+                 * This method adds or replaces a dynamic polygon.
+                 *
+                 * @param id Identifier of the dynamic polygon.
+                 * @param polygon Polygon.
+                 */
+                void updateDynamicPolygon(const uint32_t &id, const hesperia::data::environment::Polygon &polygon);
+
+                /**
+                 * This method removes a dynamic polygon.
+                 *
+                 * @param id Identifier of the dynamic polygon.
+                 */
+                void removeDynamicPolygon(const uint32_t &id);
+
+                /**
+                 * This method collects all static and dynamic polygons
+                 * whose bounding boxes overlap with the bounding box of
+                 * the given area. The returned pointers are valid until
+                 * this index is modified.
+                 *
+                 * @param area Area to query for.
+                 * @param candidates List to be filled; it is cleared first.
+                 */
+                void query(const hesperia::data::environment::Polygon &area, vector<const hesperia::data::environment::Polygon*> &candidates) const;
+
+                uint32_t getNumberOfStaticPolygons() const;
+
+                uint32_t getNumberOfDynamicPolygons() const;
+
+            private:
+                /**
+                 * Axis-aligned bounding box in the XY-plane.
+                 */
+                class BoundingBox {
+                    public:
+                        BoundingBox();
+
+                        BoundingBox(const hesperia::data::environment::Polygon &polygon);
+
+                        void extend(const BoundingBox &other);
+
+                        bool overlaps(const BoundingBox &other) const;
+
+                        double getCenterX() const;
+
+                        double getCenterY() const;
+
+                        double m_minX;
+                        double m_minY;
+                        double m_maxX;
+                        double m_maxY;
+                };
+
+                /**
+                 * Node of the bounding volume hierarchy. Inner nodes refer
+                 * to their two children; leaves refer to a range of
+                 * m_staticPolygons.
+                 */
+                class Node {
+                    public:
+                        Node();
+
+                        BoundingBox m_box;
+                        uint32_t m_left;
+                        uint32_t m_right;
+                        uint32_t m_first;
+                        uint32_t m_count;
+                };
+
+                /**
+                 * Comparator to split a range of polygons at the median
+                 * of their bounding boxes' centers along one axis.
+                 */
+                class CenterComparator {
+                    public:
+                        CenterComparator(const vector<BoundingBox> &boxes, const bool &alongX);
+
+                        bool operator()(const uint32_t &a, const uint32_t &b) const;
+
+                    private:
+                        const vector<BoundingBox> *m_boxes;
+                        bool m_alongX;
+                };
+
+                enum {
+                    MAXIMUM_POLYGONS_PER_LEAF = 4
+                };
+
+                uint32_t buildNode(vector<uint32_t> &order, const vector<BoundingBox> &boxes, const uint32_t &first, const uint32_t &count);
+
+                vector<hesperia::data::environment::Polygon> m_staticPolygons;
+                vector<BoundingBox> m_staticBoxes;
+                vector<Node> m_nodes;
+                map<uint32_t, hesperia::data::environment::Polygon> m_dynamicPolygons;
+                map<uint32_t, BoundingBox> m_dynamicBoxes;
+        };
+
+    }
+} // vehiclecontext::model
+
+#endif /*VEHICLECONTEXT_MODEL_POLYGONINDEX_H_*/
@@ -21,22 +21,32 @@
 #define VEHICLECONTEXT_MODEL_SIMPLIFIEDBICYCLEMODEL_H_
 
 #include <string>
+#include <vector>
 
 #include "core/base/KeyValueConfiguration.h"
 #include "core/data/TimeStamp.h"
 #include "core/data/control/VehicleControl.h"
 #include "core/data/environment/Point3.h"
 #include "core/data/environment/VehicleData.h"
+#include "core/exceptions/Exceptions.h"
+
+#include "hesperia/data/environment/EgoState.h"
 
 #include "context/base/SystemFeedbackComponent.h"
 
+#include "vehiclecontext/model/NoiseGenerator.h"
+
 namespace vehiclecontext {
     namespace model {
 
         using namespace std;
 
         /**
-         * This class realizes the simplified bicycle model.
+         * This class realizes the simplified bicycle model. The vehicle's
+         * dynamics are computed by the static integrate() methods on plain
+         * Parameters and State values; they do not allocate any memory and
+         * can therefore also be used to advance many independent vehicles
+         * at once, for example for parameter sweeps.
          */
         class OPENDAVINCI_API SimplifiedBicycleModel : public context::base::SystemFeedbackComponent {
             private:
@@ -54,6 +64,80 @@ namespace vehiclecontext {
                  */
                 SimplifiedBicycleModel& operator=(const SimplifiedBicycleModel&);
 
+            public:
+                /**
+                 * Parameters of a vehicle.
+                 */
+                class Parameters {
+                    public:
+                        Parameters();
+
+                        double m_wheelbase;
+                        double m_maxSteeringLeftRad;
+                        double m_maxSteeringRightRad;
+                        int32_t m_invertedSteering;
+                        double m_maxSpeed;
+                        bool m_useSpeedControl;
+                };
+
+                /**
+                 * State of a vehicle. m_deltaHeading and m_relativeDrivenPath
+                 * describe the result of the last integration step.
+                 */
+                class State {
+                    public:
+                        State();
+
+                        double m_positionX;
+                        double m_positionY;
+                        double m_heading;
+                        double m_speed;
+                        double m_esum;
+                        double m_desiredSpeed;
+                        double m_desiredAcceleration;
+                        double m_desiredSteer;
+                        double m_deltaHeading;
+                        double m_relativeDrivenPath;
+                };
+
+                /**
+                 * This method sets the desired steering angle limited
+                 * to the vehicle's maximum steering angles.
+                 *
+                 * @param parameters Parameters of the vehicle.
+                 * @param state State to be modified.
+                 * @param steeringWheelAngle Desired steering angle (negative to the left).
+                 */
+                static void setSteeringWheelAngle(const Parameters &parameters, State &state, const double &steeringWheelAngle);
+
+                /**
+                 * This method advances one vehicle.
+                 *
+                 * @param parameters Parameters of the vehicle.
+                 * @param state State to be advanced.
+                 * @param timeStep Time step in seconds.
+                 */
+                static void integrate(const Parameters &parameters, State &state, const double &timeStep);
+
+                /**
+                 * This method advances several vehicles sharing the same parameters.
+                 *
+                 * @param parameters Parameters of all vehicles.
+                 * @param states States to be advanced.
+                 * @param timeStep Time step in seconds.
+                 */
+                static void integrate(const Parameters &parameters, vector<State> &states, const double &timeStep);
+
+                /**
+                 * This method advances several vehicles having their own parameters.
+                 *
+                 * @param parameters Parameters for each vehicle.
+                 * @param states States to be advanced.
+                 * @param timeStep Time step in seconds.
+                 * @throws InvalidArgumentException if the number of parameters and states differ.
+                 */
+                static void integrate(const vector<Parameters> &parameters, vector<State> &states, const double &timeStep) throw (core::exceptions::InvalidArgumentException);
+
             public:
                 /**
                  * Constructor to create a SimplifiedBicycleModel.
@@ -82,28 +166,29 @@ namespace vehiclecontext {
                 virtual void step(const core::wrapper::Time &t, context::base::SendContainerToSystemsUnderTest &sender);
 
             private:
+                /**
+                 * This method sends the current EgoState and VehicleData.
+                 *
+                 * @param sender Sender for the containers.
+                 */
+                void send(context::base::SendContainerToSystemsUnderTest &sender);
+
                 core::base::KeyValueConfiguration m_kvc;
                 float m_freq;
+                bool m_verbose;
 
-                double m_wheelbase;
-                double m_maxSteeringLeftRad;
-                double m_maxSteeringRightRad;
-                int32_t m_invertedSteering;
+                Parameters m_parameters;
+                State m_state;
 
-                double m_maxSpeed;
-                bool m_useSpeedControl;
                 double m_faultModelNoise;
+                NoiseGenerator m_noiseGenerator;
 
-                double m_esum;
-                double m_desiredSpeed;
-                double m_desiredAcceleration;
-                double m_desiredSteer;
-
-                double m_speed;
                 core::data::TimeStamp m_previousTime;
-                core::data::environment::Point3 m_oldPosition;
+                core::data::environment::Point3 m_position;
                 core::data::environment::Point3 m_orientation;
-                double m_heading;
+                core::data::environment::Point3 m_velocity;
+                core::data::environment::Point3 m_acceleration;
+                hesperia::data::environment::EgoState m_egoState;
                 core::data::environment::VehicleData m_vehicleData;
 
                 core::data::control::VehicleControl m_vehicleControl;
@@ -23,6 +23,7 @@
 #include <sstream>
 
 #include "core/macros.h"
+#include "core/base/ConfigurationValue.h"
 #include "core/base/KeyValueConfiguration.h"
 #include "core/base/KeyValueDataStore.h"
 #include "core/base/Thread.h"
@@ -70,10 +71,13 @@ namespace vehiclecontext {
             m_egoState(),
             m_numberOfPolygons(0),
             m_mapOfPolygons(),
+            m_polygonIndex(),
             m_listOfPolygonsInsideFOV(),
             m_mapOfPointSensors(),
             m_distances(),
-            m_FOVs() {
+            m_FOVs(),
+            m_FOVInterval(0),
+            m_lastFOVUpdate(-1) {
 
 			// Create configuration object.
 			stringstream sstrConfiguration;
@@ -88,10 +92,13 @@ namespace vehiclecontext {
             m_egoState(),
             m_numberOfPolygons(0),
             m_mapOfPolygons(),
+            m_polygonIndex(),
             m_listOfPolygonsInsideFOV(),
             m_mapOfPointSensors(),
             m_distances(),
-            m_FOVs() {
+            m_FOVs(),
+            m_FOVInterval(0),
+            m_lastFOVUpdate(-1) {
 
             // Create configuration object.
             stringstream sstrConfiguration;
@@ -140,6 +147,14 @@ namespace vehiclecontext {
                 }
             }
 
+            // Index the static polygons once so that every sensor only needs to test the polygons near its FOV.
+            m_polygonIndex.build(m_mapOfPolygons);
+            cerr << "[IRUS] Indexed " << m_polygonIndex.getNumberOfStaticPolygons() << " polygons." << endl;
+
+            // Send the FOVs for visualization at most every 200ms as default.
+            const ConfigurationValue<double> FOVInterval(m_kvc, "irus.FOVInterval", 0.2);
+            m_FOVInterval = FOVInterval;
+
             // Setup all point sensors.
             for (uint32_t i = 0; i < m_kvc.getValue<uint32_t>("irus.numberOfSensors"); i++) {
                 stringstream sensorID;
@@ -201,7 +216,17 @@ namespace vehiclecontext {
                 catch (const core::exceptions::ValueForKeyNotFoundException &e) {
                 }
 
-                PointSensor *ps = new PointSensor(id, name, translation, rotZ, angleFOV, distanceFOV, clampDistance, showFOV, faultModelSkip, faultModelNoise);
+                // Don't add any normal distributed noise as default.
+                stringstream faultModelGaussianNoiseStr;
+                faultModelGaussianNoiseStr << "irus.sensor" << i << ".faultModel.gaussianNoise";
+                const ConfigurationValue<double> faultModelGaussianNoise(m_kvc, faultModelGaussianNoiseStr.str(), 0);
+
+                // Use the sensor's ID as default seed so that every sensor has its own but reproducible noise.
+                stringstream faultModelSeedStr;
+                faultModelSeedStr << "irus.sensor" << i << ".faultModel.seed";
+                const ConfigurationValue<uint32_t> faultModelSeed(m_kvc, faultModelSeedStr.str(), id);
+
+                PointSensor *ps = new PointSensor(id, name, translation, rotZ, angleFOV, distanceFOV, clampDistance, showFOV, faultModelSkip, faultModelNoise, faultModelGaussianNoise, faultModelSeed);
 
                 if (ps != NULL) {
                     // Save for later.
@@ -240,6 +265,20 @@ namespace vehiclecontext {
                 if (c.getDataType() == Container::EGOSTATE) {
                     m_egoState = c.getData<EgoState>();
                 }
+                if (c.getDataType() == Container::OBSTACLE) {
+                    Obstacle o = c.getData<Obstacle>();
+
+                    // Skip the FOVs sent by ourselves.
+                    const bool isFOV = ( (o.getID() >= FOV_OBSTACLE_ID) && (o.getID() < (FOV_OBSTACLE_ID + m_mapOfPointSensors.size())) );
+                    if (!isFOV) {
+                        if (o.getState() == Obstacle::REMOVE) {
+                            m_polygonIndex.removeDynamicPolygon(o.getID());
+                        }
+                        else {
+                            m_polygonIndex.updateDynamicPolygon(o.getID(), o.getPolygon());
+                        }
+                    }
+                }
             }
 
             ////////////////////////////////////////////////////////////////////
@@ -257,35 +296,41 @@ namespace vehiclecontext {
                 m_FOVs[sensor->getName()] = FOV;
 
                 // Calculate distance.
-                m_distances[sensor->getName()] = sensor->getDistance(m_mapOfPolygons);
+                m_distances[sensor->getName()] = sensor->getDistance(m_polygonIndex);
                 cerr << sensor->getName() << ": " << m_distances[sensor->getName()] << endl;
 
                 // MSV: Store data for sensorboard.
                 sensorBoardData.putTo_MapOfDistances(sensor->getID(), m_distances[sensor->getName()]);
-
-        		// MSV: Create a container with type USER_DATA_0.
-        		Container c = Container(Container::USER_DATA_0, sensorBoardData);
-
-                // MSV: Send container.
-                sender.sendToSystemsUnderTest(c);
             }
 
-            // Distribute FOV where necessary.
-            uint32_t sensorID = 9000;
-            map<string, Polygon, core::wrapper::StringComparator>::iterator FOVIterator = m_FOVs.begin();
-            for (; FOVIterator != m_FOVs.end(); FOVIterator++) {
-                string key = FOVIterator->first;
-                Polygon FOV = FOVIterator->second;
-
-                PointSensor *ps = m_mapOfPointSensors[key];
-                if ( (ps != NULL) && (ps->hasShowFOV()) ) {
-                    // Send FOV.
-                    Obstacle FOVobstacle(sensorID++, Obstacle::UPDATE);
-                    FOVobstacle.setPolygon(FOV);
-
-                    // Send obstacle.
-                    Container c = Container(Container::OBSTACLE, FOVobstacle);
-                    sender.sendToSystemsUnderTest(c);
+            // MSV: Create one container with type USER_DATA_0 containing the distances from all sensors.
+            Container containerSensorBoardData = Container(Container::USER_DATA_0, sensorBoardData);
+
+            // MSV: Send container.
+            sender.sendToSystemsUnderTest(containerSensorBoardData);
+
+            // The FOVs are only needed for visualization; thus, they are distributed at most once per m_FOVInterval.
+            const double now = t.getSeconds() + t.getPartialMicroseconds() / 1000000.0;
+            if ( (m_lastFOVUpdate < 0) || ((now - m_lastFOVUpdate) >= m_FOVInterval) ) {
+                m_lastFOVUpdate = now;
+
+                // Distribute FOV where necessary.
+                uint32_t sensorID = FOV_OBSTACLE_ID;
+                map<string, Polygon, core::wrapper::StringComparator>::iterator FOVIterator = m_FOVs.begin();
+                for (; FOVIterator != m_FOVs.end(); FOVIterator++) {
+                    string key = FOVIterator->first;
+                    Polygon FOV = FOVIterator->second;
+
+                    PointSensor *ps = m_mapOfPointSensors[key];
+                    if ( (ps != NULL) && (ps->hasShowFOV()) ) {
+                        // Send FOV.
+                        Obstacle FOVobstacle(sensorID++, Obstacle::UPDATE);
+                        FOVobstacle.setPolygon(FOV);
+
+                        // Send obstacle.
+                        Container c = Container(Container::OBSTACLE, FOVobstacle);
+                        sender.sendToSystemsUnderTest(c);
+                    }
                 }
             }
         }
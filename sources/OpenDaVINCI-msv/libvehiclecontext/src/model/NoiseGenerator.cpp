@@ -0,0 +1,130 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cmath>
+
+#include "core/data/Constants.h"
+
+#include "vehiclecontext/model/NoiseGenerator.h"
+
+namespace vehiclecontext {
+    namespace model {
+
+        using namespace core::data;
+
+        /**
+         * This function scrambles the given value to derive
+         * well-distributed initial states even from small seeds.
+         *
+         * @param value Value to scramble.
+         * @return Scrambled value.
+         */
+        static uint32_t scramble(uint32_t value) {
+            value ^= value >> 16;
+            value *= 0x7feb352dU;
+            value ^= value >> 15;
+            value *= 0x846ca68bU;
+            value ^= value >> 16;
+            return value;
+        }
+
+        NoiseGenerator::NoiseGenerator(const uint32_t &seed) :
+            m_x(0),
+            m_y(0),
+            m_z(0),
+            m_w(0),
+            m_hasSpareGaussian(false),
+            m_spareGaussian(0) {
+            setSeed(seed);
+        }
+
+        NoiseGenerator::NoiseGenerator(const NoiseGenerator &obj) :
+            m_x(obj.m_x),
+            m_y(obj.m_y),
+            m_z(obj.m_z),
+            m_w(obj.m_w),
+            m_hasSpareGaussian(obj.m_hasSpareGaussian),
+            m_spareGaussian(obj.m_spareGaussian) {}
+
+        NoiseGenerator::~NoiseGenerator() {}
+
+        NoiseGenerator& NoiseGenerator::operator=(const NoiseGenerator &obj) {
+            m_x = obj.m_x;
+            m_y = obj.m_y;
+            m_z = obj.m_z;
+            m_w = obj.m_w;
+            m_hasSpareGaussian = obj.m_hasSpareGaussian;
+            m_spareGaussian = obj.m_spareGaussian;
+
+            return (*this);
+        }
+
+        void NoiseGenerator::setSeed(const uint32_t &seed) {
+            m_x = scramble(seed);
+            m_y = scramble(m_x + 0x9e3779b9U);
+            m_z = scramble(m_y + 0x9e3779b9U);
+            m_w = scramble(m_z + 0x9e3779b9U);
+
+            // xorshift128 must not start from the all-zero state.
+            if ( (m_x | m_y | m_z | m_w) == 0) {
+                m_w = 0x9e3779b9U;
+            }
+
+            m_hasSpareGaussian = false;
+            m_spareGaussian = 0;
+        }
+
+        uint32_t NoiseGenerator::next() {
+            const uint32_t t = m_x ^ (m_x << 11);
+            m_x = m_y;
+            m_y = m_z;
+            m_z = m_w;
+            m_w = m_w ^ (m_w >> 19) ^ t ^ (t >> 8);
+            return m_w;
+        }
+
+        double NoiseGenerator::nextUniform() {
+            return next() * (1.0 / 4294967296.0);
+        }
+
+        double NoiseGenerator::nextUniform(const double &minimum, const double &maximum) {
+            return minimum + (maximum - minimum) * nextUniform();
+        }
+
+        double NoiseGenerator::nextGaussian(const double &mean, const double &standardDeviation) {
+            // Box-Muller creates two independent values at once; return the spare one next time.
+            if (m_hasSpareGaussian) {
+                m_hasSpareGaussian = false;
+                return mean + standardDeviation * m_spareGaussian;
+            }
+
+            // Avoid log(0) by drawing u1 from (0 .. 1].
+            const double u1 = 1.0 - nextUniform();
+            const double u2 = nextUniform();
+            const double radius = sqrt(-2.0 * log(u1));
+            const double angle = 2.0 * Constants::PI * u2;
+
+            m_spareGaussian = radius * sin(angle);
+            m_hasSpareGaussian = true;
+
+            return mean + standardDeviation * radius * cos(angle);
+        }
+
+    }
+} // vehiclecontext::model
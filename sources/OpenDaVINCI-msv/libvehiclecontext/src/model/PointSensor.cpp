@@ -32,7 +32,7 @@ namespace vehiclecontext {
         using namespace core::data::environment;
         using namespace hesperia::data::environment;
 
-        PointSensor::PointSensor(const uint16_t &id, const string &name, const core::data::environment::Point3 &translation, const double &rotZ, const double &angleFOV, const double &distanceFOV, const double &clampDistance, const bool &showFOV, const double &faultModelSkip, const double &faultModelNoise) :
+        PointSensor::PointSensor(const uint16_t &id, const string &name, const core::data::environment::Point3 &translation, const double &rotZ, const double &angleFOV, const double &distanceFOV, const double &clampDistance, const bool &showFOV, const double &faultModelSkip, const double &faultModelNoise, const double &faultModelGaussianNoise, const uint32_t &faultModelSeed) :
             m_id(id),
             m_name(name),
             m_translation(translation),
@@ -44,9 +44,12 @@ namespace vehiclecontext {
             m_faultModelSkipCounter(0),
             m_faultModelSkip(faultModelSkip),
             m_faultModelNoise(faultModelNoise),
+            m_faultModelGaussianNoise(faultModelGaussianNoise),
+            m_noiseGenerator(faultModelSeed),
             m_totalRotation(0),
             m_FOV(),
-            m_sensorPosition()
+            m_sensorPosition(),
+            m_candidates()
         {}
 
         PointSensor::~PointSensor() {}
@@ -114,38 +117,55 @@ namespace vehiclecontext {
             return retVal;
         }
 
+        void PointSensor::updateDistance(const Polygon &p, double &distanceToSensor) const {
+            // Get overlapping parts of polygon...
+            const Polygon contour = m_FOV.intersectIgnoreZ(p);
+
+            if (contour.getSize() > 0) {
+                // Get nearest point from contour.
+                const vector<Point3> listOfPoints = contour.getVertices();
+                vector<Point3>::const_iterator jt = listOfPoints.begin();
+
+                while (jt != listOfPoints.end()) {
+                    const Point3 &pt = (*jt++);
+                    double d = (pt - m_sensorPosition).lengthXY();
+
+                    if (isInFOV(pt)) {
+                        if ((distanceToSensor < 0) || (d < distanceToSensor)) {
+                            distanceToSensor = d;
+                        }
+                    }
+                }
+            }
+        }
+
         double PointSensor::getDistance(map<uint32_t, hesperia::data::environment::Polygon> &mapOfPolygons) {
-            Point3 nearest;
             double distanceToSensor = -1;
 
             map<uint32_t, hesperia::data::environment::Polygon>::const_iterator it = mapOfPolygons.begin();
             while (it != mapOfPolygons.end()) {
-                Polygon p = it->second;
-
-                // Get overlapping parts of polygon...
-                Polygon contour = m_FOV.intersectIgnoreZ(p);
+                updateDistance(it->second, distanceToSensor);
+                it++;
+            }
 
-                if (contour.getSize() > 0) {
-                    // Get nearest point from contour.
-                    const vector<Point3> listOfPoints = contour.getVertices();
-                    vector<Point3>::const_iterator jt = listOfPoints.begin();
+            return applyFaultModel(distanceToSensor);
+        }
 
-                    while (jt != listOfPoints.end()) {
-                        Point3 pt = (*jt++);
-                        double d = (pt - m_sensorPosition).lengthXY();
+        double PointSensor::getDistance(const PolygonIndex &index) {
+            double distanceToSensor = -1;
 
-                        if (isInFOV(pt)) {
-                            if ((distanceToSensor < 0) || (d < distanceToSensor)) {
-                                nearest = pt;
-                                distanceToSensor = d;
-                            }
-                        }
-                    }
-                }
+            // Only polygons whose bounding boxes overlap with the FOV's bounding box can be seen.
+            index.query(m_FOV, m_candidates);
 
-                it++;
+            vector<const Polygon*>::const_iterator it = m_candidates.begin();
+            while (it != m_candidates.end()) {
+                updateDistance(*(*it++), distanceToSensor);
             }
 
+            return applyFaultModel(distanceToSensor);
+        }
+
+        double PointSensor::applyFaultModel(double distanceToSensor) {
             if (distanceToSensor > m_clampDistance) {
                 distanceToSensor = -1;
             }
@@ -156,7 +176,14 @@ namespace vehiclecontext {
             double fault = 0;
             if (!(distanceToSensor < 0)) {
                 // Determine the random data from the range -1.0 .. 1.0 multiplied by the defined m_faultModelNoise.
-                fault = ((100-(1 + (rand()%200)))/100.0) * m_faultModelNoise;
+                if (m_faultModelNoise > 0) {
+                    fault = m_noiseGenerator.nextUniform(-1.0, 1.0) * m_faultModelNoise;
+                }
+
+                // Add normal distributed noise if required.
+                if (m_faultModelGaussianNoise > 0) {
+                    fault += m_noiseGenerator.nextGaussian(0, m_faultModelGaussianNoise);
+                }
 
                 distanceToSensor += fault;
 
@@ -205,7 +232,7 @@ namespace vehiclecontext {
 
         const string PointSensor::toString() const {
             strstream sstr;
-            sstr << m_name << "(" << m_id << ")" << ": " << m_translation.toString() << ", rot: " << m_rotZ << ", angle: " << m_angleFOV << ", range: " << m_distanceFOV << ", clampDistance: " << m_clampDistance <<  ", showFOV: " << m_showFOV << ", fault.skip: " << m_faultModelSkip << ", fault.noise: " << m_faultModelNoise << endl;
+            sstr << m_name << "(" << m_id << ")" << ": " << m_translation.toString() << ", rot: " << m_rotZ << ", angle: " << m_angleFOV << ", range: " << m_distanceFOV << ", clampDistance: " << m_clampDistance <<  ", showFOV: " << m_showFOV << ", fault.skip: " << m_faultModelSkip << ", fault.noise: " << m_faultModelNoise << ", fault.gaussianNoise: " << m_faultModelGaussianNoise << endl;
             return sstr.str();
         }  
 
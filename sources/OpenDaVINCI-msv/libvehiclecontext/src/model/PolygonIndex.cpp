@@ -0,0 +1,224 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "vehiclecontext/model/PolygonIndex.h"
+
+namespace vehiclecontext {
+    namespace model {
+
+        using namespace std;
+        using namespace core::data::environment;
+        using namespace hesperia::data::environment;
+
+        PolygonIndex::BoundingBox::BoundingBox() :
+            m_minX(numeric_limits<double>::max()),
+            m_minY(numeric_limits<double>::max()),
+            m_maxX(-numeric_limits<double>::max()),
+            m_maxY(-numeric_limits<double>::max()) {}
+
+        PolygonIndex::BoundingBox::BoundingBox(const Polygon &polygon) :
+            m_minX(numeric_limits<double>::max()),
+            m_minY(numeric_limits<double>::max()),
+            m_maxX(-numeric_limits<double>::max()),
+            m_maxY(-numeric_limits<double>::max()) {
+            const vector<Point3> listOfVertices = polygon.getVertices();
+            vector<Point3>::const_iterator it = listOfVertices.begin();
+            while (it != listOfVertices.end()) {
+                m_minX = min(m_minX, it->getX());
+                m_minY = min(m_minY, it->getY());
+                m_maxX = max(m_maxX, it->getX());
+                m_maxY = max(m_maxY, it->getY());
+                it++;
+            }
+        }
+
+        void PolygonIndex::BoundingBox::extend(const BoundingBox &other) {
+            m_minX = min(m_minX, other.m_minX);
+            m_minY = min(m_minY, other.m_minY);
+            m_maxX = max(m_maxX, other.m_maxX);
+            m_maxY = max(m_maxY, other.m_maxY);
+        }
+
+        bool PolygonIndex::BoundingBox::overlaps(const BoundingBox &other) const {
+            // Touching boxes overlap as intersection points may lie on their borders.
+            return ( (m_minX <= other.m_maxX) && (other.m_minX <= m_maxX) &&
+                     (m_minY <= other.m_maxY) && (other.m_minY <= m_maxY) );
+        }
+
+        double PolygonIndex::BoundingBox::getCenterX() const {
+            return (m_minX + m_maxX) / 2.0;
+        }
+
+        double PolygonIndex::BoundingBox::getCenterY() const {
+            return (m_minY + m_maxY) / 2.0;
+        }
+
+        PolygonIndex::Node::Node() :
+            m_box(),
+            m_left(0),
+            m_right(0),
+            m_first(0),
+            m_count(0) {}
+
+        PolygonIndex::CenterComparator::CenterComparator(const vector<BoundingBox> &boxes, const bool &alongX) :
+            m_boxes(&boxes),
+            m_alongX(alongX) {}
+
+        bool PolygonIndex::CenterComparator::operator()(const uint32_t &a, const uint32_t &b) const {
+            if (m_alongX) {
+                return ((*m_boxes)[a].getCenterX() < (*m_boxes)[b].getCenterX());
+            }
+            return ((*m_boxes)[a].getCenterY() < (*m_boxes)[b].getCenterY());
+        }
+
+        PolygonIndex::PolygonIndex() :
+            m_staticPolygons(),
+            m_staticBoxes(),
+            m_nodes(),
+            m_dynamicPolygons(),
+            m_dynamicBoxes() {}
+
+        PolygonIndex::~PolygonIndex() {}
+
+        void PolygonIndex::build(const map<uint32_t, Polygon> &mapOfPolygons) {
+            m_staticPolygons.clear();
+            m_staticBoxes.clear();
+            m_nodes.clear();
+
+            vector<Polygon> polygons;
+            vector<BoundingBox> boxes;
+            map<uint32_t, Polygon>::const_iterator it = mapOfPolygons.begin();
+            while (it != mapOfPolygons.end()) {
+                // Polygons without vertices cannot be seen by any sensor.
+                if (it->second.getSize() > 0) {
+                    polygons.push_back(it->second);
+                    boxes.push_back(BoundingBox(it->second));
+                }
+                it++;
+            }
+
+            if (polygons.empty()) {
+                return;
+            }
+
+            vector<uint32_t> order;
+            for (uint32_t i = 0; i < polygons.size(); i++) {
+                order.push_back(i);
+            }
+            buildNode(order, boxes, 0, static_cast<uint32_t>(order.size()));
+
+            // Store the polygons in the order of the leaves so that every leaf refers to a consecutive range.
+            m_staticPolygons.reserve(order.size());
+            m_staticBoxes.reserve(order.size());
+            for (uint32_t i = 0; i < order.size(); i++) {
+                m_staticPolygons.push_back(polygons[order[i]]);
+                m_staticBoxes.push_back(boxes[order[i]]);
+            }
+        }
+
+        uint32_t PolygonIndex::buildNode(vector<uint32_t> &order, const vector<BoundingBox> &boxes, const uint32_t &first, const uint32_t &count) {
+            const uint32_t index = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.push_back(Node());
+
+            BoundingBox box;
+            for (uint32_t i = first; i < first + count; i++) {
+                box.extend(boxes[order[i]]);
+            }
+            m_nodes[index].m_box = box;
+
+            if (count <= MAXIMUM_POLYGONS_PER_LEAF) {
+                m_nodes[index].m_first = first;
+                m_nodes[index].m_count = count;
+            }
+            else {
+                // Split at the median along the longer side.
+                const bool alongX = ((box.m_maxX - box.m_minX) >= (box.m_maxY - box.m_minY));
+                const uint32_t half = count / 2;
+                nth_element(order.begin() + first, order.begin() + first + half, order.begin() + first + count, CenterComparator(boxes, alongX));
+
+                // m_nodes might be reallocated while building the children.
+                const uint32_t left = buildNode(order, boxes, first, half);
+                const uint32_t right = buildNode(order, boxes, first + half, count - half);
+                m_nodes[index].m_left = left;
+                m_nodes[index].m_right = right;
+            }
+
+            return index;
+        }
+
+        void PolygonIndex::updateDynamicPolygon(const uint32_t &id, const Polygon &polygon) {
+            m_dynamicPolygons[id] = polygon;
+            m_dynamicBoxes[id] = BoundingBox(polygon);
+        }
+
+        void PolygonIndex::removeDynamicPolygon(const uint32_t &id) {
+            m_dynamicPolygons.erase(id);
+            m_dynamicBoxes.erase(id);
+        }
+
+        void PolygonIndex::query(const Polygon &area, vector<const Polygon*> &candidates) const {
+            candidates.clear();
+
+            const BoundingBox areaBox(area);
+
+            if (!m_nodes.empty()) {
+                vector<uint32_t> stack;
+                stack.push_back(0);
+                while (!stack.empty()) {
+                    const Node &node = m_nodes[stack.back()];
+                    stack.pop_back();
+
+                    if (node.m_box.overlaps(areaBox)) {
+                        if (node.m_count > 0) {
+                            for (uint32_t i = node.m_first; i < node.m_first + node.m_count; i++) {
+                                if (m_staticBoxes[i].overlaps(areaBox)) {
+                                    candidates.push_back(&m_staticPolygons[i]);
+                                }
+                            }
+                        }
+                        else {
+                            stack.push_back(node.m_left);
+                            stack.push_back(node.m_right);
+                        }
+                    }
+                }
+            }
+
+            map<uint32_t, BoundingBox>::const_iterator it = m_dynamicBoxes.begin();
+            while (it != m_dynamicBoxes.end()) {
+                if (it->second.overlaps(areaBox)) {
+                    candidates.push_back(&(m_dynamicPolygons.find(it->first)->second));
+                }
+                it++;
+            }
+        }
+
+        uint32_t PolygonIndex::getNumberOfStaticPolygons() const {
+            return static_cast<uint32_t>(m_staticPolygons.size());
+        }
+
+        uint32_t PolygonIndex::getNumberOfDynamicPolygons() const {
+            return static_cast<uint32_t>(m_dynamicPolygons.size());
+        }
+
+    }
+} // vehiclecontext::model
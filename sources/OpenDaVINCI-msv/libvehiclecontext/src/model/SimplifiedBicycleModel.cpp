@@ -22,6 +22,7 @@
 #include <iomanip>
 #include <sstream>
 
+#include "core/base/ConfigurationValue.h"
 #include "core/data/Constants.h"
 #include "core/exceptions/Exceptions.h"
 
@@ -37,29 +38,122 @@ namespace vehiclecontext {
         using namespace core::data;
         using namespace core::data::control;
         using namespace core::data::environment;
+        using namespace core::exceptions;
         using namespace hesperia::data::environment;
         using namespace core::io;
         using namespace context::base;
 
-        SimplifiedBicycleModel::SimplifiedBicycleModel(const string &configuration) :
-			m_kvc(),
-			m_freq(0),
+        SimplifiedBicycleModel::Parameters::Parameters() :
             m_wheelbase(1),
             m_maxSteeringLeftRad(0),
             m_maxSteeringRightRad(0),
             m_invertedSteering(0),
             m_maxSpeed(0),
-            m_useSpeedControl(true),
-            m_faultModelNoise(0),
+            m_useSpeedControl(true) {}
+
+        SimplifiedBicycleModel::State::State() :
+            m_positionX(0),
+            m_positionY(0),
+            m_heading(0),
+            m_speed(0),
             m_esum(0),
             m_desiredSpeed(0),
             m_desiredAcceleration(0),
             m_desiredSteer(0),
-            m_speed(0),
+            m_deltaHeading(0),
+            m_relativeDrivenPath(0) {}
+
+        void SimplifiedBicycleModel::setSteeringWheelAngle(const Parameters &parameters, State &state, const double &steeringWheelAngle) {
+            if (steeringWheelAngle < 0) {
+                // Steer to the left is assumed to be negative (inverting is done in integrate).
+                if (fabs(steeringWheelAngle) > parameters.m_maxSteeringLeftRad) {
+                    state.m_desiredSteer = (-1)*parameters.m_maxSteeringLeftRad;
+                }
+                else {
+                    state.m_desiredSteer = steeringWheelAngle;
+                }
+            }
+            else {
+                // Steer to the right.
+                if (steeringWheelAngle > parameters.m_maxSteeringRightRad) {
+                    state.m_desiredSteer = parameters.m_maxSteeringRightRad;
+                }
+                else {
+                    state.m_desiredSteer = steeringWheelAngle;
+                }
+            }
+        }
+
+        void SimplifiedBicycleModel::integrate(const Parameters &parameters, State &state, const double &timeStep) {
+            if (parameters.m_useSpeedControl) {
+                const double e = (state.m_desiredSpeed - state.m_speed);
+                if (fabs(e) < 1e-2) {
+                    state.m_esum = 0;
+                    state.m_desiredAcceleration = 0;
+                }
+                else {
+                    state.m_esum += e;
+
+                    const double Kp = 0.75;
+                    const double Ki = 0.2;
+                    state.m_desiredAcceleration = Kp * e + Ki * timeStep * state.m_esum;
+                }
+            }
+            else {
+                state.m_esum = 0;
+            }
+
+            const double deltaSpeed = state.m_desiredAcceleration * timeStep;
+            if (fabs(state.m_speed + deltaSpeed) < parameters.m_maxSpeed) {
+                state.m_speed += deltaSpeed;
+            }
+
+            const double direction = (state.m_speed < 0) ? -1 : +1; // +1 = forwards, -1 = backwards
+
+            state.m_deltaHeading = fabs(state.m_speed)/parameters.m_wheelbase * tan(parameters.m_invertedSteering * direction * state.m_desiredSteer) * timeStep;
+
+            const double x = cos(state.m_heading) * state.m_speed * timeStep;
+            const double y = sin(state.m_heading) * state.m_speed * timeStep;
+
+            state.m_heading = fmod(state.m_heading + state.m_deltaHeading, 2 * Constants::PI);
+
+            state.m_positionX += x;
+            state.m_positionY += y;
+            state.m_relativeDrivenPath = sqrt(x * x + y * y);
+        }
+
+        void SimplifiedBicycleModel::integrate(const Parameters &parameters, vector<State> &states, const double &timeStep) {
+            const uint32_t SIZE = states.size();
+            for (uint32_t i = 0; i < SIZE; i++) {
+                integrate(parameters, states[i], timeStep);
+            }
+        }
+
+        void SimplifiedBicycleModel::integrate(const vector<Parameters> &parameters, vector<State> &states, const double &timeStep) throw (InvalidArgumentException) {
+            if (parameters.size() != states.size()) {
+                OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException, "Number of parameters and states differ.");
+            }
+
+            const uint32_t SIZE = states.size();
+            for (uint32_t i = 0; i < SIZE; i++) {
+                integrate(parameters[i], states[i], timeStep);
+            }
+        }
+
+        SimplifiedBicycleModel::SimplifiedBicycleModel(const string &configuration) :
+			m_kvc(),
+			m_freq(0),
+            m_verbose(false),
+            m_parameters(),
+            m_state(),
+            m_faultModelNoise(0),
+            m_noiseGenerator(10),
             m_previousTime(),
-            m_oldPosition(),
+            m_position(),
             m_orientation(1,0,0),
-            m_heading(0),
+            m_velocity(),
+            m_acceleration(),
+            m_egoState(),
             m_vehicleData(),
             m_vehicleControl(),
             m_hasReceivedVehicleControl(false) {
@@ -74,22 +168,17 @@ namespace vehiclecontext {
         SimplifiedBicycleModel::SimplifiedBicycleModel(const float &freq, const string &configuration) :
 			m_kvc(),
             m_freq(freq),
-            m_wheelbase(1),
-            m_maxSteeringLeftRad(0),
-            m_maxSteeringRightRad(0),
-            m_invertedSteering(0),
-            m_maxSpeed(0),
-            m_useSpeedControl(true),
+            m_verbose(false),
+            m_parameters(),
+            m_state(),
             m_faultModelNoise(0),
-            m_esum(0),
-            m_desiredSpeed(0),
-            m_desiredAcceleration(0),
-            m_desiredSteer(0),
-            m_speed(0),
+            m_noiseGenerator(10),
             m_previousTime(),
-            m_oldPosition(),
+            m_position(),
             m_orientation(1,0,0),
-            m_heading(0),
+            m_velocity(),
+            m_acceleration(),
+            m_egoState(),
             m_vehicleData(),
             m_vehicleControl(),
             m_hasReceivedVehicleControl(false) {
@@ -109,18 +198,20 @@ namespace vehiclecontext {
 
         void SimplifiedBicycleModel::setup() {
             // Setup initial position.
-            m_oldPosition = Point3(m_kvc.getValue<double>("Vehicle.posX"), m_kvc.getValue<double>("Vehicle.posY"), 0);
-            m_heading = core::data::Constants::DEG2RAD * m_kvc.getValue<double>("Vehicle.headingDEG");
+            m_state.m_positionX = m_kvc.getValue<double>("Vehicle.posX");
+            m_state.m_positionY = m_kvc.getValue<double>("Vehicle.posY");
+            m_state.m_heading = core::data::Constants::DEG2RAD * m_kvc.getValue<double>("Vehicle.headingDEG");
+            m_position = Point3(m_state.m_positionX, m_state.m_positionY, 0);
 
             // Calculate maximum steering wheel angles to left and right.
-            m_wheelbase = m_kvc.getValue<double>("Vehicle.LinearBicycleModelNew.wheelbase");
-            m_maxSteeringLeftRad = atan(m_wheelbase/m_kvc.getValue<double>("Vehicle.LinearBicycleModelNew.minimumTurningRadiusLeft") );
-            m_maxSteeringRightRad = atan(m_wheelbase/m_kvc.getValue<double>("Vehicle.LinearBicycleModelNew.minimumTurningRadiusRight"));
+            m_parameters.m_wheelbase = m_kvc.getValue<double>("Vehicle.LinearBicycleModelNew.wheelbase");
+            m_parameters.m_maxSteeringLeftRad = atan(m_parameters.m_wheelbase/m_kvc.getValue<double>("Vehicle.LinearBicycleModelNew.minimumTurningRadiusLeft") );
+            m_parameters.m_maxSteeringRightRad = atan(m_parameters.m_wheelbase/m_kvc.getValue<double>("Vehicle.LinearBicycleModelNew.minimumTurningRadiusRight"));
 
-            m_invertedSteering = (m_kvc.getValue<int32_t>("Vehicle.LinearBicycleModelNew.invertedSteering") == 0) ? -1 : 1;
-            m_maxSpeed = fabs(m_kvc.getValue<double>("Vehicle.LinearBicycleModelNew.maxspeed"));
+            m_parameters.m_invertedSteering = (m_kvc.getValue<int32_t>("Vehicle.LinearBicycleModelNew.invertedSteering") == 0) ? -1 : 1;
+            m_parameters.m_maxSpeed = fabs(m_kvc.getValue<double>("Vehicle.LinearBicycleModelNew.maxspeed"));
 
-            m_useSpeedControl = (m_kvc.getValue<int32_t>("Vehicle.LinearBicycleModelNew.withSpeedController") == 1) ? true: false;
+            m_parameters.m_useSpeedControl = (m_kvc.getValue<int32_t>("Vehicle.LinearBicycleModelNew.withSpeedController") == 1) ? true: false;
 
             try {
                 m_faultModelNoise = m_kvc.getValue<double>("Vehicle.LinearBicycleModelNew.faultModel.noise");
@@ -128,52 +219,43 @@ namespace vehiclecontext {
             catch (const core::exceptions::ValueForKeyNotFoundException &e) {
             }
 
-            cerr << "max turning wheel angle to the left: " << m_maxSteeringLeftRad << endl;
-            cerr << "max turning wheel angle to the right: " << m_maxSteeringRightRad << endl;
-            cerr << "inverted steering: " << m_invertedSteering << endl;
-            cerr << "fault model noise: " << m_faultModelNoise << endl;
+            cerr << "max turning wheel angle to the left: " << m_parameters.m_maxSteeringLeftRad << endl;
+            cerr << "max turning wheel angle to the right: " << m_parameters.m_maxSteeringRightRad << endl;
+            cerr << "inverted steering: " << m_parameters.m_invertedSteering << endl;
+
+            // Restart the fault model's noise sequence from the configured seed so that runs are reproducible.
+            const ConfigurationValue<uint32_t> faultModelSeed(m_kvc, "Vehicle.LinearBicycleModelNew.faultModel.seed", 10);
+            m_noiseGenerator.setSeed(faultModelSeed);
+
+            cerr << "fault model noise: " << m_faultModelNoise << ", seed: " << faultModelSeed << endl;
 
-            // Initialize random number generator.
-            srand(10);
+            // Printing the data of every step slows down the simulation; therefore, it must be enabled explicitly.
+            const ConfigurationValue<uint32_t> verbose(m_kvc, "Vehicle.LinearBicycleModelNew.verbose", 0);
+            m_verbose = (verbose == 1);
         }
 
         void SimplifiedBicycleModel::tearDown() {}
 
         void SimplifiedBicycleModel::step(const core::wrapper::Time &t, SendContainerToSystemsUnderTest &sender) {
-            cerr << "[SimplifiedBicycleModel] Call for t = " << t.getSeconds() << "." << t.getPartialMicroseconds() << ", containing " << getFIFO().getSize() << " containers." << endl;
+            if (m_verbose) {
+                cerr << "[SimplifiedBicycleModel] Call for t = " << t.getSeconds() << "." << t.getPartialMicroseconds() << ", containing " << getFIFO().getSize() << " containers." << endl;
+            }
 
             // Get last ForceControl.
             const uint32_t SIZE = getFIFO().getSize();
             for (uint32_t i = 0; i < SIZE; i++) {
                 Container c = getFIFO().leave();
-                cerr << "[SimplifiedBicycleModel] Received: " << c.toString() << endl;
+                if (m_verbose) {
+                    cerr << "[SimplifiedBicycleModel] Received: " << c.toString() << endl;
+                }
                 if (c.getDataType() == Container::VEHICLECONTROL) {
                     m_vehicleControl = c.getData<VehicleControl>();
 
                     m_hasReceivedVehicleControl = true;
 
-                    m_desiredAcceleration = m_vehicleControl.getAcceleration();
-                    m_desiredSpeed = m_vehicleControl.getSpeed();
-
-                    double s = m_vehicleControl.getSteeringWheelAngle();
-                    if (s < 0) {
-                        // Steer to the left is assumed to be negative (inverting is done below).
-                        if (fabs(s) > m_maxSteeringLeftRad) {
-                            m_desiredSteer = (-1)*m_maxSteeringLeftRad;
-                        }
-                        else {
-                            m_desiredSteer = s;
-                        }
-                    }
-                    else {
-                        // Steer to the right.
-                        if (s > m_maxSteeringRightRad) {
-                            m_desiredSteer = m_maxSteeringRightRad;
-                        }
-                        else {
-                            m_desiredSteer = s;
-                        }
-                    }
+                    m_state.m_desiredAcceleration = m_vehicleControl.getAcceleration();
+                    m_state.m_desiredSpeed = m_vehicleControl.getSpeed();
+                    setSteeringWheelAngle(m_parameters, m_state, m_vehicleControl.getSteeringWheelAngle());
                 }
             }
 
@@ -183,112 +265,63 @@ namespace vehiclecontext {
             double timeStep = (currentTime.toMicroseconds() - m_previousTime.toMicroseconds()) / (1000.0 * 1000.0);
 
             if (m_hasReceivedVehicleControl) {
+                integrate(m_parameters, m_state, timeStep);
 
-                if (m_useSpeedControl) {
-                    double e = (m_desiredSpeed - m_speed);
-                    if (fabs(e) < 1e-2) {
-                        m_esum = 0;
-                    }
-                    else {
-                        m_esum += e;
-                    }
-                    const double Kp = 0.75;
-                    const double Ki = 0.2;
-                    const double p = Kp * e;
-                    const double i = Ki * timeStep * m_esum;
-                    const double y = p + i;
-                    if (fabs(e) < 1e-2) {
-                        m_desiredAcceleration = 0;
-                    }
-                    else {
-                        m_desiredAcceleration = y;
-                    }
-                    cerr << endl << endl << "[SimplifiedBicycleModel] PID y = " << y << endl;
-                }
-                else {
-                    m_esum = 0;
-                }
-
-                double m_deltaSpeed = m_desiredAcceleration * timeStep;
-
-                if (fabs(m_speed + m_deltaSpeed) < m_maxSpeed) {
-                    m_speed += m_deltaSpeed;
-                }
-
-                const double direction = (m_speed < 0) ? -1 : +1; // +1 = forwards, -1 = backwards
+                const double direction = (m_state.m_speed < 0) ? -1 : +1; // +1 = forwards, -1 = backwards
+                const double cosHeading = cos(m_state.m_heading);
+                const double sinHeading = sin(m_state.m_heading);
 
-                double m_deltaHeading = fabs(m_speed)/m_wheelbase * tan(m_invertedSteering * direction * m_desiredSteer) * timeStep;
-
-                m_orientation = Point3(1, 0, 0);
-                m_orientation.rotateZ(m_heading + m_deltaHeading);
-                m_orientation.normalize();
-
-                double x = cos(m_heading) * m_speed * timeStep;
-                double y = sin(m_heading) * m_speed * timeStep;
-
-                m_heading += m_deltaHeading;
-                m_heading = fmod(m_heading, 2 * Constants::PI);
-
-                Point3 position(m_oldPosition.getX() + x, m_oldPosition.getY() + y, 0);
-                double relDrivenPath = fabs((position - m_oldPosition).lengthXY());
-                m_oldPosition = position;
-
-                Point3 acceleration;
-                Point3 velocity(cos(m_heading) * m_speed * direction,
-                                sin(m_heading) * m_speed * direction,
-                                0);
+                m_position.setX(m_state.m_positionX);
+                m_position.setY(m_state.m_positionY);
+                m_orientation.setX(cosHeading);
+                m_orientation.setY(sinHeading);
+                m_velocity.setX(cosHeading * m_state.m_speed * direction);
+                m_velocity.setY(sinHeading * m_state.m_speed * direction);
 
                 // Update internal data.
-                m_vehicleData.setPosition(position);
-                m_vehicleData.setHeading(m_heading);
-                m_vehicleData.setVelocity(velocity);
-                m_vehicleData.setSpeed(m_speed);
+                m_vehicleData.setPosition(m_position);
+                m_vehicleData.setHeading(m_state.m_heading);
+                m_vehicleData.setVelocity(m_velocity);
+                m_vehicleData.setSpeed(m_state.m_speed);
                 m_vehicleData.setV_log(0);
                 m_vehicleData.setV_batt(0);
                 // For fake :-)
-                m_vehicleData.setTemp(19.5 + cos(m_heading + m_deltaHeading));
-                m_vehicleData.setRelTraveledPath(relDrivenPath);
+                m_vehicleData.setTemp(19.5 + cos(m_state.m_heading + m_state.m_deltaHeading));
+                m_vehicleData.setRelTraveledPath(m_state.m_relativeDrivenPath);
 
                 // Determine the random data from the range -1.0 .. 1.0 multiplied by the defined m_faultModelNoise.
-                const double FAULT = ((100-(1 + (rand()%200)))/100.0) * m_faultModelNoise;
+                const double FAULT = (m_faultModelNoise > 0) ? (m_noiseGenerator.nextUniform(-1.0, 1.0) * m_faultModelNoise) : 0;
                 // No fault model was specified, FAULT is set to 1.0 to simply add the unmodified value.
-                m_vehicleData.setAbsTraveledPath(m_vehicleData.getAbsTraveledPath() + (relDrivenPath * (1 + FAULT)));
-                if ( (FAULT > 0) || (FAULT < 0) ) {
+                m_vehicleData.setAbsTraveledPath(m_vehicleData.getAbsTraveledPath() + (m_state.m_relativeDrivenPath * (1 + FAULT)));
+                if ( m_verbose && ((FAULT > 0) || (FAULT < 0)) ) {
                     cerr << "[SimplifiedBicycleModel] faultModel.noise: " << "Adding " << FAULT << " to travelled distance." << endl;
                 }
+            }
 
-                // Resulting EgoState.
-                EgoState nextEgoState(m_oldPosition, m_orientation, velocity, acceleration);
-
-                cerr << "[SimplifiedBicycleModel] " << nextEgoState.toString() << endl;
-
-                cerr << "[SimplifiedBicycleModel] " << m_vehicleData.toString() << endl;
+            // Without any VehicleControl, the vehicle stands still at its initial position.
+            m_egoState.setPosition(m_position);
+            m_egoState.setRotation(m_orientation);
+            m_egoState.setVelocity(m_velocity);
+            m_egoState.setAcceleration(m_acceleration);
 
-                // Send EgoState to System-Under-Test.
-                Container c(Container::EGOSTATE, nextEgoState);
-                sender.sendToSystemsUnderTest(c);
+            send(sender);
 
-                // Send VehicleData to System-Under-Test.
-                Container c2(Container::VEHICLEDATA, m_vehicleData);
-                sender.sendToSystemsUnderTest(c2);
-            }
-            else {
-            	// Send current position.
-                EgoState nextEgoState(m_oldPosition, m_orientation, Point3(0, 0, 0), Point3(0, 0, 0));
+            m_previousTime = currentTime;
+        }
 
-                cerr << "[SimplifiedBicycleModel] " << nextEgoState.toString() << endl;
+        void SimplifiedBicycleModel::send(SendContainerToSystemsUnderTest &sender) {
+            if (m_verbose) {
+                cerr << "[SimplifiedBicycleModel] " << m_egoState.toString() << endl;
                 cerr << "[SimplifiedBicycleModel] " << m_vehicleData.toString() << endl;
-
-                // Send EgoState to System-Under-Test.
-                Container c(Container::EGOSTATE, nextEgoState);
-                sender.sendToSystemsUnderTest(c);
-
-                // Send VehicleData to System-Under-Test.
-                Container c2(Container::VEHICLEDATA, m_vehicleData);
-                sender.sendToSystemsUnderTest(c2);
             }
 
-            m_previousTime = currentTime;
+            // Send EgoState to System-Under-Test.
+            Container c(Container::EGOSTATE, m_egoState);
+            sender.sendToSystemsUnderTest(c);
+
+            // Send VehicleData to System-Under-Test.
+            Container c2(Container::VEHICLEDATA, m_vehicleData);
+            sender.sendToSystemsUnderTest(c2);
         }
 
     }
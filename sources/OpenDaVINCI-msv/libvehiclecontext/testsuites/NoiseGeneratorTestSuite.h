@@ -0,0 +1,78 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_NOISEGENERATORTESTSUITE_H_
+#define VEHICLECONTEXT_NOISEGENERATORTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <vector>
+
+#include "vehiclecontext/model/NoiseGenerator.h"
+
+using namespace std;
+using namespace vehiclecontext::model;
+
+class NoiseGeneratorTest : public CxxTest::TestSuite {
+    public:
+        void testSameSeedYieldsSameSequence() {
+            NoiseGenerator first(10);
+            NoiseGenerator second(10);
+            NoiseGenerator other(11);
+
+            bool differs = false;
+            for (uint32_t i = 0; i < 1000; i++) {
+                const uint32_t value = first.next();
+                TS_ASSERT(value == second.next());
+                differs |= (value != other.next());
+            }
+            TS_ASSERT(differs);
+        }
+
+        void testSetSeedRestartsSequence() {
+            NoiseGenerator generator(42);
+
+            vector<double> sequence;
+            for (uint32_t i = 0; i < 100; i++) {
+                sequence.push_back(generator.nextUniform(-1.0, 1.0));
+                sequence.push_back(generator.nextGaussian(0, 1.0));
+            }
+
+            // Leave a spare Gaussian behind; setSeed must discard it.
+            generator.nextGaussian(0, 1.0);
+            generator.setSeed(42);
+
+            for (uint32_t i = 0; i < sequence.size(); i += 2) {
+                TS_ASSERT_DELTA(generator.nextUniform(-1.0, 1.0), sequence.at(i), 0);
+                TS_ASSERT_DELTA(generator.nextGaussian(0, 1.0), sequence.at(i + 1), 0);
+            }
+        }
+
+        void testUniformRange() {
+            NoiseGenerator generator(0);
+
+            for (uint32_t i = 0; i < 1000; i++) {
+                const double value = generator.nextUniform(-1.0, 1.0);
+                TS_ASSERT(value >= -1.0);
+                TS_ASSERT(value < 1.0);
+            }
+        }
+};
+
+#endif /*VEHICLECONTEXT_NOISEGENERATORTESTSUITE_H_*/
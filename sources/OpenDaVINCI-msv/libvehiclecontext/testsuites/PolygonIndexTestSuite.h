@@ -0,0 +1,270 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_POLYGONINDEXTESTSUITE_H_
+#define VEHICLECONTEXT_POLYGONINDEXTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "core/data/environment/Point3.h"
+#include "hesperia/data/environment/Polygon.h"
+
+#include "vehiclecontext/model/NoiseGenerator.h"
+#include "vehiclecontext/model/PointSensor.h"
+#include "vehiclecontext/model/PolygonIndex.h"
+
+using namespace std;
+using namespace core::data::environment;
+using namespace hesperia::data::environment;
+using namespace vehiclecontext::model;
+
+class PolygonIndexTest : public CxxTest::TestSuite {
+    public:
+        /**
+         * @return Randomly rotated rectangles scattered over 200m x 200m.
+         */
+        map<uint32_t, Polygon> createObstacles(NoiseGenerator &generator, const uint32_t &numberOfObstacles) {
+            map<uint32_t, Polygon> obstacles;
+            for (uint32_t id = 0; id < numberOfObstacles; id++) {
+                const Point3 center(generator.nextUniform(-100, 100), generator.nextUniform(-100, 100), 0);
+                const double halfLength = generator.nextUniform(0.25, 3);
+                const double halfWidth = generator.nextUniform(0.25, 3);
+                const double angle = generator.nextUniform(-M_PI, M_PI);
+
+                Polygon p;
+                const double corners[4][2] = { { halfLength, halfWidth }, { -halfLength, halfWidth }, { -halfLength, -halfWidth }, { halfLength, -halfWidth } };
+                for (uint32_t i = 0; i < 4; i++) {
+                    Point3 corner(corners[i][0], corners[i][1], 0);
+                    corner.rotateZ(angle);
+                    p.add(center + corner);
+                }
+                obstacles[id] = p;
+            }
+            return obstacles;
+        }
+
+        /**
+         * @return Sensor without any fault model.
+         */
+        PointSensor* createSensor() {
+            return new PointSensor(0, "Infrared", Point3(1, 0, 0), 0, 60, 40, 39, false, 0, 0, 0, 0);
+        }
+
+        /**
+         * @return true if the axis-aligned bounding boxes of both polygons overlap.
+         */
+        bool boundingBoxesOverlap(const Polygon &a, const Polygon &b) {
+            const vector<Point3> verticesA = a.getVertices();
+            const vector<Point3> verticesB = b.getVertices();
+            double minAX = verticesA.at(0).getX(), maxAX = minAX, minAY = verticesA.at(0).getY(), maxAY = minAY;
+            double minBX = verticesB.at(0).getX(), maxBX = minBX, minBY = verticesB.at(0).getY(), maxBY = minBY;
+            for (uint32_t i = 1; i < verticesA.size(); i++) {
+                minAX = min(minAX, verticesA.at(i).getX());
+                maxAX = max(maxAX, verticesA.at(i).getX());
+                minAY = min(minAY, verticesA.at(i).getY());
+                maxAY = max(maxAY, verticesA.at(i).getY());
+            }
+            for (uint32_t i = 1; i < verticesB.size(); i++) {
+                minBX = min(minBX, verticesB.at(i).getX());
+                maxBX = max(maxBX, verticesB.at(i).getX());
+                minBY = min(minBY, verticesB.at(i).getY());
+                maxBY = max(maxBY, verticesB.at(i).getY());
+            }
+            return ( (minAX <= maxBX) && (minBX <= maxAX) && (minAY <= maxBY) && (minBY <= maxAY) );
+        }
+
+        /**
+         * This method compares the indexed search with the exhaustive
+         * search for the given obstacles and random sensor poses.
+         */
+        void compareWithExhaustiveSearch(map<uint32_t, Polygon> &obstacles, NoiseGenerator &generator, const uint32_t &numberOfPoses) {
+            PolygonIndex index;
+            index.build(obstacles);
+            TS_ASSERT(index.getNumberOfStaticPolygons() == obstacles.size());
+
+            PointSensor *exhaustive = createSensor();
+            PointSensor *indexed = createSensor();
+
+            vector<const Polygon*> candidates;
+            uint32_t numberOfHits = 0;
+            for (uint32_t pose = 0; pose < numberOfPoses; pose++) {
+                const Point3 position(generator.nextUniform(-110, 110), generator.nextUniform(-110, 110), 0);
+                Point3 rotation(1, 0, 0);
+                rotation.rotateZ(generator.nextUniform(-M_PI, M_PI));
+
+                const Polygon FOV = exhaustive->updateFOV(position, rotation);
+                indexed->updateFOV(position, rotation);
+
+                // Nearest distance.
+                const double expected = exhaustive->getDistance(obstacles);
+                TS_ASSERT_DELTA(indexed->getDistance(index), expected, 0);
+                numberOfHits += (expected < 0) ? 0 : 1;
+
+                // Candidates are exactly the obstacles whose bounding boxes overlap with the FOV's one...
+                index.query(FOV, candidates);
+                set<string> candidateNames;
+                for (uint32_t i = 0; i < candidates.size(); i++) {
+                    candidateNames.insert(candidates.at(i)->toString());
+                }
+                TS_ASSERT(candidateNames.size() == candidates.size());
+
+                uint32_t numberOfOverlaps = 0;
+                map<uint32_t, Polygon>::const_iterator it = obstacles.begin();
+                while (it != obstacles.end()) {
+                    if (boundingBoxesOverlap(FOV, it->second)) {
+                        numberOfOverlaps++;
+                        TS_ASSERT(candidateNames.count(it->second.toString()) == 1);
+                    }
+                    else {
+                        // ... and thus include every obstacle the FOV hits.
+                        TS_ASSERT(FOV.intersectIgnoreZ(it->second).getSize() == 0);
+                    }
+                    it++;
+                }
+                TS_ASSERT(numberOfOverlaps == candidates.size());
+            }
+
+            // The comparison is only meaningful if obstacles are hit at all.
+            if (obstacles.size() >= 50) {
+                TS_ASSERT(numberOfHits > 0);
+            }
+
+            delete exhaustive;
+            delete indexed;
+        }
+
+        void testEmptyIndex() {
+            map<uint32_t, Polygon> obstacles;
+            PolygonIndex index;
+            index.build(obstacles);
+            TS_ASSERT(index.getNumberOfStaticPolygons() == 0);
+            TS_ASSERT(index.getNumberOfDynamicPolygons() == 0);
+
+            PointSensor *sensor = createSensor();
+            const Polygon FOV = sensor->updateFOV(Point3(0, 0, 0), Point3(1, 0, 0));
+
+            vector<const Polygon*> candidates;
+            index.query(FOV, candidates);
+            TS_ASSERT(candidates.empty());
+
+            TS_ASSERT_DELTA(sensor->getDistance(index), -1, 0);
+            TS_ASSERT_DELTA(sensor->getDistance(obstacles), -1, 0);
+
+            delete sensor;
+        }
+
+        void testSinglePolygon() {
+            map<uint32_t, Polygon> obstacles;
+            Polygon p;
+            p.add(Point3(10, -1, 0));
+            p.add(Point3(12, -1, 0));
+            p.add(Point3(12, 1, 0));
+            p.add(Point3(10, 1, 0));
+            obstacles[7] = p;
+
+            PolygonIndex index;
+            index.build(obstacles);
+            TS_ASSERT(index.getNumberOfStaticPolygons() == 1);
+
+            PointSensor *sensor = createSensor();
+            vector<const Polygon*> candidates;
+
+            // Looking at the polygon.
+            Polygon FOV = sensor->updateFOV(Point3(0, 0, 0), Point3(1, 0, 0));
+            index.query(FOV, candidates);
+            TS_ASSERT(candidates.size() == 1);
+            TS_ASSERT(candidates.at(0)->toString() == p.toString());
+
+            // The sensor at (1, 0) reports the closest corner of the polygon's part inside the FOV.
+            const double expected = sensor->getDistance(obstacles);
+            TS_ASSERT_DELTA(expected, sqrt(82.0), 1e-9);
+            TS_ASSERT_DELTA(sensor->getDistance(index), expected, 0);
+
+            // Looking away from the polygon.
+            FOV = sensor->updateFOV(Point3(0, 0, 0), Point3(-1, 0, 0));
+            index.query(FOV, candidates);
+            TS_ASSERT(candidates.empty());
+            TS_ASSERT_DELTA(sensor->getDistance(index), -1, 0);
+            TS_ASSERT_DELTA(sensor->getDistance(obstacles), -1, 0);
+
+            delete sensor;
+        }
+
+        void testRandomObstaclesMatchExhaustiveSearch() {
+            NoiseGenerator generator(2015);
+
+            const uint32_t SIZES[] = { 1, 2, 5, 50, 500 };
+            for (uint32_t i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); i++) {
+                map<uint32_t, Polygon> obstacles = createObstacles(generator, SIZES[i]);
+                compareWithExhaustiveSearch(obstacles, generator, 200);
+            }
+        }
+
+        void testDynamicPolygons() {
+            NoiseGenerator generator(7);
+            map<uint32_t, Polygon> obstacles = createObstacles(generator, 50);
+
+            PolygonIndex index;
+            index.build(obstacles);
+
+            Polygon p;
+            p.add(Point3(5, -1, 0));
+            p.add(Point3(6, -1, 0));
+            p.add(Point3(6, 1, 0));
+            p.add(Point3(5, 1, 0));
+            index.updateDynamicPolygon(1000, p);
+            TS_ASSERT(index.getNumberOfDynamicPolygons() == 1);
+
+            PointSensor *sensor = createSensor();
+            const Polygon FOV = sensor->updateFOV(Point3(0, 0, 0), Point3(1, 0, 0));
+
+            map<uint32_t, Polygon> all = obstacles;
+            all[1000] = p;
+            const double expected = sensor->getDistance(all);
+            TS_ASSERT_DELTA(sensor->getDistance(index), expected, 0);
+            TS_ASSERT(expected > 0);
+            TS_ASSERT(expected < 5);
+
+            // Moving the dynamic polygon replaces it.
+            Polygon moved;
+            moved.add(Point3(-6, -1, 0));
+            moved.add(Point3(-5, -1, 0));
+            moved.add(Point3(-5, 1, 0));
+            moved.add(Point3(-6, 1, 0));
+            index.updateDynamicPolygon(1000, moved);
+            TS_ASSERT(index.getNumberOfDynamicPolygons() == 1);
+            all[1000] = moved;
+            TS_ASSERT_DELTA(sensor->getDistance(index), sensor->getDistance(all), 0);
+
+            index.removeDynamicPolygon(1000);
+            TS_ASSERT(index.getNumberOfDynamicPolygons() == 0);
+            TS_ASSERT_DELTA(sensor->getDistance(index), sensor->getDistance(obstacles), 0);
+
+            delete sensor;
+        }
+};
+
+#endif /*VEHICLECONTEXT_POLYGONINDEXTESTSUITE_H_*/
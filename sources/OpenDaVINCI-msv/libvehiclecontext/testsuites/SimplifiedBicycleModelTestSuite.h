@@ -0,0 +1,237 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_SIMPLIFIEDBICYCLEMODELTESTSUITE_H_
+#define VEHICLECONTEXT_SIMPLIFIEDBICYCLEMODELTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <cmath>
+#include <vector>
+
+#include "core/data/Constants.h"
+#include "core/data/environment/Point3.h"
+#include "core/exceptions/Exceptions.h"
+
+#include "vehiclecontext/model/SimplifiedBicycleModel.h"
+
+using namespace std;
+using namespace core::data;
+using namespace core::data::environment;
+using namespace vehiclecontext::model;
+
+class SimplifiedBicycleModelTest : public CxxTest::TestSuite {
+    public:
+        /**
+         * @return Parameters as used by the default configuration.
+         */
+        SimplifiedBicycleModel::Parameters getParameters() {
+            SimplifiedBicycleModel::Parameters parameters;
+            parameters.m_wheelbase = 2.65;
+            parameters.m_maxSteeringLeftRad = atan(parameters.m_wheelbase / 4.85);
+            parameters.m_maxSteeringRightRad = atan(parameters.m_wheelbase / 5.32);
+            parameters.m_invertedSteering = -1;
+            parameters.m_maxSpeed = 10.0;
+            parameters.m_useSpeedControl = true;
+            return parameters;
+        }
+
+        /**
+         * This method advances the given state using the formulation that
+         * SimplifiedBicycleModel::step() used before integrate() existed.
+         */
+        void integrateAsBefore(const SimplifiedBicycleModel::Parameters &parameters, SimplifiedBicycleModel::State &state, Point3 &orientation, const double &timeStep) {
+            if (parameters.m_useSpeedControl) {
+                const double e = (state.m_desiredSpeed - state.m_speed);
+                if (fabs(e) < 1e-2) {
+                    state.m_esum = 0;
+                }
+                else {
+                    state.m_esum += e;
+                }
+                const double y = 0.75 * e + 0.2 * timeStep * state.m_esum;
+                state.m_desiredAcceleration = (fabs(e) < 1e-2) ? 0 : y;
+            }
+
+            const double deltaSpeed = state.m_desiredAcceleration * timeStep;
+            if (fabs(state.m_speed + deltaSpeed) < parameters.m_maxSpeed) {
+                state.m_speed += deltaSpeed;
+            }
+
+            const double direction = (state.m_speed < 0) ? -1 : +1;
+            const double deltaHeading = fabs(state.m_speed)/parameters.m_wheelbase * tan(parameters.m_invertedSteering * direction * state.m_desiredSteer) * timeStep;
+
+            orientation = Point3(1, 0, 0);
+            orientation.rotateZ(state.m_heading + deltaHeading);
+            orientation.normalize();
+
+            const double x = cos(state.m_heading) * state.m_speed * timeStep;
+            const double y = sin(state.m_heading) * state.m_speed * timeStep;
+
+            state.m_heading += deltaHeading;
+            state.m_heading = fmod(state.m_heading, 2 * Constants::PI);
+
+            const Point3 oldPosition(state.m_positionX, state.m_positionY, 0);
+            const Point3 position(state.m_positionX + x, state.m_positionY + y, 0);
+            state.m_relativeDrivenPath = fabs((position - oldPosition).lengthXY());
+            state.m_positionX = position.getX();
+            state.m_positionY = position.getY();
+        }
+
+        void testSteeringWheelAngleIsLimited() {
+            const SimplifiedBicycleModel::Parameters parameters = getParameters();
+            SimplifiedBicycleModel::State state;
+
+            SimplifiedBicycleModel::setSteeringWheelAngle(parameters, state, -1.0);
+            TS_ASSERT_DELTA(state.m_desiredSteer, -parameters.m_maxSteeringLeftRad, 0);
+
+            SimplifiedBicycleModel::setSteeringWheelAngle(parameters, state, 1.0);
+            TS_ASSERT_DELTA(state.m_desiredSteer, parameters.m_maxSteeringRightRad, 0);
+
+            SimplifiedBicycleModel::setSteeringWheelAngle(parameters, state, 0.1);
+            TS_ASSERT_DELTA(state.m_desiredSteer, 0.1, 0);
+        }
+
+        void testIntegrateStraight() {
+            SimplifiedBicycleModel::Parameters parameters = getParameters();
+            parameters.m_useSpeedControl = false;
+
+            SimplifiedBicycleModel::State state;
+            state.m_desiredAcceleration = 1.0;
+
+            // The speed grows by 0.1 m/s per step and is applied in the same step.
+            for (uint32_t i = 1; i <= 10; i++) {
+                SimplifiedBicycleModel::integrate(parameters, state, 0.1);
+                TS_ASSERT_DELTA(state.m_speed, 0.1 * i, 1e-12);
+                TS_ASSERT_DELTA(state.m_relativeDrivenPath, 0.01 * i, 1e-12);
+            }
+
+            TS_ASSERT_DELTA(state.m_positionX, 0.55, 1e-12);
+            TS_ASSERT_DELTA(state.m_positionY, 0, 0);
+            TS_ASSERT_DELTA(state.m_heading, 0, 0);
+            TS_ASSERT_DELTA(state.m_deltaHeading, 0, 0);
+        }
+
+        void testIntegrateMatchesPreviousFormulation() {
+            const SimplifiedBicycleModel::Parameters parameters = getParameters();
+            const double timeStep = 0.05;
+
+            SimplifiedBicycleModel::State state;
+            state.m_desiredSpeed = 2.0;
+            SimplifiedBicycleModel::setSteeringWheelAngle(parameters, state, -0.2);
+
+            SimplifiedBicycleModel::State previousState = state;
+            Point3 previousOrientation(1, 0, 0);
+
+            // Drive several full circles so that the heading wraps around.
+            for (uint32_t i = 0; i < 2000; i++) {
+                SimplifiedBicycleModel::integrate(parameters, state, timeStep);
+                integrateAsBefore(parameters, previousState, previousOrientation, timeStep);
+
+                // The orientation was rotated and normalized before; it is cos/sin of the wrapped heading now.
+                TS_ASSERT_DELTA(cos(state.m_heading), previousOrientation.getX(), 1e-9);
+                TS_ASSERT_DELTA(sin(state.m_heading), previousOrientation.getY(), 1e-9);
+            }
+
+            TS_ASSERT(fabs(state.m_heading) > 0);
+            TS_ASSERT_DELTA(state.m_speed, previousState.m_speed, 0);
+            TS_ASSERT_DELTA(state.m_heading, previousState.m_heading, 0);
+            TS_ASSERT_DELTA(state.m_positionX, previousState.m_positionX, 0);
+            TS_ASSERT_DELTA(state.m_positionY, previousState.m_positionY, 0);
+            TS_ASSERT_DELTA(state.m_relativeDrivenPath, previousState.m_relativeDrivenPath, 1e-12);
+        }
+
+        void testBatchIntegrateWithSharedParameters() {
+            const SimplifiedBicycleModel::Parameters parameters = getParameters();
+
+            vector<SimplifiedBicycleModel::State> states(5);
+            for (uint32_t i = 0; i < states.size(); i++) {
+                states[i].m_desiredSpeed = 1.0 + i;
+                SimplifiedBicycleModel::setSteeringWheelAngle(parameters, states[i], -0.1 * i);
+            }
+            vector<SimplifiedBicycleModel::State> expected = states;
+
+            for (uint32_t step = 0; step < 100; step++) {
+                SimplifiedBicycleModel::integrate(parameters, states, 0.1);
+                for (uint32_t i = 0; i < expected.size(); i++) {
+                    SimplifiedBicycleModel::integrate(parameters, expected[i], 0.1);
+                }
+            }
+
+            for (uint32_t i = 0; i < states.size(); i++) {
+                TS_ASSERT_DELTA(states[i].m_positionX, expected[i].m_positionX, 0);
+                TS_ASSERT_DELTA(states[i].m_positionY, expected[i].m_positionY, 0);
+                TS_ASSERT_DELTA(states[i].m_heading, expected[i].m_heading, 0);
+                TS_ASSERT_DELTA(states[i].m_speed, expected[i].m_speed, 0);
+            }
+        }
+
+        void testBatchIntegrateWithOwnParameters() {
+            vector<SimplifiedBicycleModel::Parameters> parameters(3, getParameters());
+            parameters[1].m_wheelbase = 3.0;
+            parameters[2].m_useSpeedControl = false;
+
+            vector<SimplifiedBicycleModel::State> states(3);
+            for (uint32_t i = 0; i < states.size(); i++) {
+                states[i].m_desiredSpeed = 2.0;
+                states[i].m_desiredAcceleration = 0.5;
+                SimplifiedBicycleModel::setSteeringWheelAngle(parameters[i], states[i], 0.2);
+            }
+            vector<SimplifiedBicycleModel::State> expected = states;
+
+            for (uint32_t step = 0; step < 100; step++) {
+                SimplifiedBicycleModel::integrate(parameters, states, 0.1);
+                for (uint32_t i = 0; i < expected.size(); i++) {
+                    SimplifiedBicycleModel::integrate(parameters[i], expected[i], 0.1);
+                }
+            }
+
+            for (uint32_t i = 0; i < states.size(); i++) {
+                TS_ASSERT_DELTA(states[i].m_positionX, expected[i].m_positionX, 0);
+                TS_ASSERT_DELTA(states[i].m_positionY, expected[i].m_positionY, 0);
+                TS_ASSERT_DELTA(states[i].m_heading, expected[i].m_heading, 0);
+                TS_ASSERT_DELTA(states[i].m_speed, expected[i].m_speed, 0);
+            }
+
+            // Different parameters lead to different trajectories.
+            TS_ASSERT(fabs(states[0].m_heading - states[1].m_heading) > 1e-3);
+        }
+
+        void testBatchIntegrateWithMismatchingSizes() {
+            vector<SimplifiedBicycleModel::Parameters> parameters(2, getParameters());
+            vector<SimplifiedBicycleModel::State> states(3);
+
+            bool thrown = false;
+            try {
+                SimplifiedBicycleModel::integrate(parameters, states, 0.1);
+            }
+            catch (core::exceptions::InvalidArgumentException &) {
+                thrown = true;
+            }
+            TS_ASSERT(thrown);
+
+            // The states were not touched.
+            for (uint32_t i = 0; i < states.size(); i++) {
+                TS_ASSERT_DELTA(states[i].m_positionX, 0, 0);
+                TS_ASSERT_DELTA(states[i].m_speed, 0, 0);
+            }
+        }
+};
+
+#endif /*VEHICLECONTEXT_SIMPLIFIEDBICYCLEMODELTESTSUITE_H_*/
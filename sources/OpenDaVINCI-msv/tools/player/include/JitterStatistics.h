@@ -0,0 +1,145 @@
+/**
+ * player - Tool for playing back recorded data
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe 
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef JITTERSTATISTICS_H_
+#define JITTERSTATISTICS_H_
+
+#include <string>
+
+#include "core/data/TimeStamp.h"
+
+namespace player {
+
+    using namespace std;
+
+    /**
+     * This class accumulates the deviation of the replay timing from
+     * the original recording. The inter-arrival jitter is the difference
+     * between the time elapsed between sending two consecutive containers
+     * and the (scaled) time elapsed between receiving them during the
+     * recording; the lateness is the difference between the actual and
+     * the scheduled sending time of a container.
+     */
+    class JitterStatistics {
+        public:
+            JitterStatistics();
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj Reference to an object of this class.
+             */
+            JitterStatistics(const JitterStatistics &obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj Reference to an object of this class.
+             * @return Reference to this instance.
+             */
+            JitterStatistics& operator=(const JitterStatistics &obj);
+
+            virtual ~JitterStatistics();
+
+            /**
+             * This method adds the timing of one sent container.
+             *
+             * @param received Time stamp when the container was received during recording.
+             * @param scheduled Time stamp when the container was scheduled to be sent.
+             * @param sent Time stamp when the container was actually sent.
+             * @param timeScale Scaling factor applied to the recording's time line.
+             */
+            void update(const core::data::TimeStamp &received, const core::data::TimeStamp &scheduled, const core::data::TimeStamp &sent, const double &timeScale);
+
+            /**
+             * This method discards the previously sent container so that
+             * pausing or rewinding the replay is not counted as jitter.
+             */
+            void restart();
+
+            /**
+             * This method returns the number of containers measured.
+             *
+             * @return Number of containers.
+             */
+            uint32_t getNumberOfContainers() const;
+
+            /**
+             * This method returns the mean absolute inter-arrival jitter.
+             *
+             * @return Mean absolute inter-arrival jitter in microseconds.
+             */
+            double getMeanJitter() const;
+
+            /**
+             * This method returns the minimum absolute inter-arrival jitter.
+             *
+             * @return Minimum absolute inter-arrival jitter in microseconds.
+             */
+            long getMinimumJitter() const;
+
+            /**
+             * This method returns the maximum absolute inter-arrival jitter.
+             *
+             * @return Maximum absolute inter-arrival jitter in microseconds.
+             */
+            long getMaximumJitter() const;
+
+            /**
+             * This method returns the standard deviation of the absolute
+             * inter-arrival jitter.
+             *
+             * @return Standard deviation in microseconds.
+             */
+            double getStandardDeviationOfJitter() const;
+
+            /**
+             * This method returns the mean lateness.
+             *
+             * @return Mean lateness in microseconds.
+             */
+            double getMeanLateness() const;
+
+            /**
+             * This method returns the maximum lateness.
+             *
+             * @return Maximum lateness in microseconds.
+             */
+            long getMaximumLateness() const;
+
+            const string toString() const;
+
+        private:
+            uint32_t m_numberOfContainers;
+            uint32_t m_numberOfIntervals;
+            double m_sumOfJitter;
+            double m_sumOfSquaredJitter;
+            long m_minimumJitter;
+            long m_maximumJitter;
+            double m_sumOfLateness;
+            long m_maximumLateness;
+
+            bool m_hasPrevious;
+            core::data::TimeStamp m_previousReceived;
+            core::data::TimeStamp m_previousSent;
+    };
+
+} // player
+
+#endif /*JITTERSTATISTICS_H_*/
@@ -0,0 +1,144 @@
+/**
+ * player - Tool for playing back recorded data
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe 
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
+#include "JitterStatistics.h"
+
+namespace player {
+
+    using namespace std;
+    using namespace core::data;
+
+    JitterStatistics::JitterStatistics() :
+        m_numberOfContainers(0),
+        m_numberOfIntervals(0),
+        m_sumOfJitter(0),
+        m_sumOfSquaredJitter(0),
+        m_minimumJitter(0),
+        m_maximumJitter(0),
+        m_sumOfLateness(0),
+        m_maximumLateness(0),
+        m_hasPrevious(false),
+        m_previousReceived(),
+        m_previousSent() {}
+
+    JitterStatistics::JitterStatistics(const JitterStatistics &obj) :
+        m_numberOfContainers(obj.m_numberOfContainers),
+        m_numberOfIntervals(obj.m_numberOfIntervals),
+        m_sumOfJitter(obj.m_sumOfJitter),
+        m_sumOfSquaredJitter(obj.m_sumOfSquaredJitter),
+        m_minimumJitter(obj.m_minimumJitter),
+        m_maximumJitter(obj.m_maximumJitter),
+        m_sumOfLateness(obj.m_sumOfLateness),
+        m_maximumLateness(obj.m_maximumLateness),
+        m_hasPrevious(obj.m_hasPrevious),
+        m_previousReceived(obj.m_previousReceived),
+        m_previousSent(obj.m_previousSent) {}
+
+    JitterStatistics& JitterStatistics::operator=(const JitterStatistics &obj) {
+        m_numberOfContainers = obj.m_numberOfContainers;
+        m_numberOfIntervals = obj.m_numberOfIntervals;
+        m_sumOfJitter = obj.m_sumOfJitter;
+        m_sumOfSquaredJitter = obj.m_sumOfSquaredJitter;
+        m_minimumJitter = obj.m_minimumJitter;
+        m_maximumJitter = obj.m_maximumJitter;
+        m_sumOfLateness = obj.m_sumOfLateness;
+        m_maximumLateness = obj.m_maximumLateness;
+        m_hasPrevious = obj.m_hasPrevious;
+        m_previousReceived = obj.m_previousReceived;
+        m_previousSent = obj.m_previousSent;
+
+        return *this;
+    }
+
+    JitterStatistics::~JitterStatistics() {}
+
+    void JitterStatistics::update(const TimeStamp &received, const TimeStamp &scheduled, const TimeStamp &sent, const double &timeScale) {
+        m_numberOfContainers++;
+
+        const long lateness = sent.toMicroseconds() - scheduled.toMicroseconds();
+        m_sumOfLateness += lateness;
+        m_maximumLateness = (lateness > m_maximumLateness) ? lateness : m_maximumLateness;
+
+        if (m_hasPrevious) {
+            const long expectedInterval = static_cast<long>((received.toMicroseconds() - m_previousReceived.toMicroseconds()) * timeScale);
+            const long actualInterval = sent.toMicroseconds() - m_previousSent.toMicroseconds();
+            const long jitter = labs(actualInterval - expectedInterval);
+
+            m_minimumJitter = ( (m_numberOfIntervals == 0) || (jitter < m_minimumJitter) ) ? jitter : m_minimumJitter;
+            m_numberOfIntervals++;
+            m_sumOfJitter += jitter;
+            m_sumOfSquaredJitter += static_cast<double>(jitter) * jitter;
+            m_maximumJitter = (jitter > m_maximumJitter) ? jitter : m_maximumJitter;
+        }
+
+        m_hasPrevious = true;
+        m_previousReceived = received;
+        m_previousSent = sent;
+    }
+
+    void JitterStatistics::restart() {
+        m_hasPrevious = false;
+    }
+
+    uint32_t JitterStatistics::getNumberOfContainers() const {
+        return m_numberOfContainers;
+    }
+
+    double JitterStatistics::getMeanJitter() const {
+        return (m_numberOfIntervals > 0) ? (m_sumOfJitter / m_numberOfIntervals) : 0;
+    }
+
+    long JitterStatistics::getMinimumJitter() const {
+        return m_minimumJitter;
+    }
+
+    long JitterStatistics::getMaximumJitter() const {
+        return m_maximumJitter;
+    }
+
+    double JitterStatistics::getStandardDeviationOfJitter() const {
+        const double mean = getMeanJitter();
+        const double variance = (m_numberOfIntervals > 0) ? (m_sumOfSquaredJitter / m_numberOfIntervals - mean * mean) : 0;
+        return sqrt(variance > 0 ? variance : 0);
+    }
+
+    double JitterStatistics::getMeanLateness() const {
+        return (m_numberOfContainers > 0) ? (m_sumOfLateness / m_numberOfContainers) : 0;
+    }
+
+    long JitterStatistics::getMaximumLateness() const {
+        return m_maximumLateness;
+    }
+
+    const string JitterStatistics::toString() const {
+        stringstream s;
+        s << "Replayed " << m_numberOfContainers << " containers, inter-arrival jitter: mean " << getMeanJitter()
+          << " us, stddev " << getStandardDeviationOfJitter()
+          << " us, min " << m_minimumJitter
+          << " us, max " << m_maximumJitter
+          << " us; lateness: mean " << getMeanLateness()
+          << " us, max " << m_maximumLateness << " us.";
+        return s.str();
+    }
+
+} // player
@@ -20,10 +20,12 @@
 #include <cmath>
 
 #include "core/base/Thread.h"
+#include "core/data/TimeStamp.h"
 #include "core/io/URL.h"
 #include "core/data/player/PlayerCommand.h"
 #include "tools/player/Player.h"
 
+#include "JitterStatistics.h"
 #include "PlayerModule.h"
 
 namespace player {
@@ -62,6 +64,22 @@ namespace player {
         // Do we have to rewind the stream on EOF?
         bool autoRewind = (getKeyValueConfiguration().getValue<int>("player.autoRewind") != 0);
 
+        // Shall the deviation from the recording's timing be reported?
+        bool reportJitter = false;
+        try {
+            reportJitter = (getKeyValueConfiguration().getValue<int>("player.reportJitter") != 0);
+        }
+        catch (const core::exceptions::ValueForKeyNotFoundException &e) {
+        }
+
+        // Shall every sent container be printed? This slows down the replay.
+        bool verbose = false;
+        try {
+            verbose = (getKeyValueConfiguration().getValue<int>("player.verbose") != 0);
+        }
+        catch (const core::exceptions::ValueForKeyNotFoundException &e) {
+        }
+
         // Size of the memory buffer.
         const uint32_t MEMORY_SEGMENT_SIZE = getKeyValueConfiguration().getValue<uint32_t>("global.buffer.memorySegmentSize");
 
@@ -80,8 +98,13 @@ namespace player {
         // The next container to be sent.
         Container nextContainerToBeSent;
 
-        // Delay between two containers.
-        uint32_t delay = 0;
+        // Containers are sent at absolute points in time to not accumulate any scheduling errors:
+        // The deadline for sending the next container is advanced by the recorded (and scaled) delay.
+        bool hasDeadline = false;
+        TimeStamp deadline;
+
+        // Deviation from the recording's timing.
+        JitterStatistics jitter;
 
         // If no remote control, simply play the stuff.
         bool playing = (!remoteControl);
@@ -93,8 +116,12 @@ namespace player {
                 // Get container to be sent.
                 nextContainerToBeSent = player.getNextContainerToBeSent();
 
-                // Get delay to wait _after_ sending the container.
-                delay = player.getDelay() * timeScale;
+                // Start from now at the beginning and after pausing or stepping.
+                if (!hasDeadline) {
+                    deadline = TimeStamp();
+                    hasDeadline = true;
+                    jitter.restart();
+                }
 
                 // Here, the container is sent while discarding player commands.
                 if ( (nextContainerToBeSent.getDataType() != Container::UNDEFINEDDATA) &&
@@ -102,14 +129,24 @@ namespace player {
 
                     // Process next token only if there's no new command.
                     if (!remoteControl || (m_playerControl.isEmpty())) {
-                        cerr << "SENT " << nextContainerToBeSent.toString() << " (delay was " << delay << " us): " << nextContainerToBeSent.getReceivedTimeStamp().toString() << endl;
+                        if (reportJitter) {
+                            jitter.update(nextContainerToBeSent.getReceivedTimeStamp(), deadline, TimeStamp(), timeScale);
+                        }
 
                         getConference().send(nextContainerToBeSent);
+
+                        if (verbose) {
+                            cerr << "SENT " << nextContainerToBeSent.toString() << ": " << nextContainerToBeSent.getReceivedTimeStamp().toString() << endl;
+                        }
                     }
 
-                    // Don't wait while stepping.
-                    if (!doStep) {
-                        Thread::usleep(delay);
+                    // Get delay to wait _after_ sending the container; containers sharing the same received time stamp are thus sent as one burst.
+                    const long delay = static_cast<long>(player.getDelay() * timeScale);
+                    deadline = deadline + TimeStamp(delay / (1000 * 1000), delay % (1000 * 1000));
+
+                    // Don't wait while stepping or within a burst.
+                    if (!doStep && (delay > 0)) {
+                        Thread::usleepUntil(deadline);
                     }
                 }
             }
@@ -118,6 +155,7 @@ namespace player {
             if (doStep) {
                 playing = false;
                 doStep = false;
+                hasDeadline = false;
             }
 
             // Check remote control.
@@ -136,6 +174,7 @@ namespace player {
                             break;
                         case core::data::player::PlayerCommand::PAUSE:
                             playing = false;
+                            hasDeadline = false;
                             break;
                         case core::data::player::PlayerCommand::STEP_FORWARD:
                             playing = true;
@@ -144,6 +183,7 @@ namespace player {
                         case core::data::player::PlayerCommand::REWIND:
                             player.rewind();
                             playing = false;
+                            hasDeadline = false;
                             break;
                     }
                 }
@@ -155,6 +195,10 @@ namespace player {
             }
         }
 
+        if (reportJitter) {
+            cerr << "Player: " << jitter.toString() << endl;
+        }
+
         return ModuleState::OKAY;
     }
 
@@ -0,0 +1,92 @@
+/**
+ * player - Tool for playing back recorded data
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe 
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef JITTERSTATISTICSTESTSUITE_H_
+#define JITTERSTATISTICSTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <cmath>
+
+#include "core/data/TimeStamp.h"
+
+#include "../include/JitterStatistics.h"
+
+using namespace std;
+using namespace player;
+using namespace core::data;
+
+class JitterStatisticsTest : public CxxTest::TestSuite {
+    public:
+        void testEmpty() {
+            JitterStatistics js;
+            TS_ASSERT(js.getNumberOfContainers() == 0);
+            TS_ASSERT_DELTA(js.getMeanJitter(), 0, 1e-9);
+            TS_ASSERT_DELTA(js.getStandardDeviationOfJitter(), 0, 1e-9);
+            TS_ASSERT(js.getMinimumJitter() == 0);
+            TS_ASSERT(js.getMaximumJitter() == 0);
+            TS_ASSERT_DELTA(js.getMeanLateness(), 0, 1e-9);
+            TS_ASSERT(js.getMaximumLateness() == 0);
+        }
+
+        void testKnownSeries() {
+            JitterStatistics js;
+
+            // Recorded every 10ms; sent intervals 12ms, 6ms, 10ms, 18ms
+            // give jitters of 2ms, 4ms, 0ms and 8ms.
+            const long sent[] = { 0, 12000, 18000, 28000, 46000 };
+            const long lateness[] = { 100, 300, 0, 200, 400 };
+            for(uint32_t i = 0; i < 5; i++) {
+                const TimeStamp received(0, i * 10000);
+                const TimeStamp actual(1, 1000 + sent[i]);
+                const TimeStamp scheduled(1, 1000 + sent[i] - lateness[i]);
+                js.update(received, scheduled, actual, 1.0);
+            }
+
+            TS_ASSERT(js.getNumberOfContainers() == 5);
+            TS_ASSERT(js.getMinimumJitter() == 0);
+            TS_ASSERT(js.getMaximumJitter() == 8000);
+            TS_ASSERT_DELTA(js.getMeanJitter(), 3500, 1e-6);
+            // Population standard deviation of {2000, 4000, 0, 8000}.
+            TS_ASSERT_DELTA(js.getStandardDeviationOfJitter(), sqrt(8750000.0), 1e-6);
+            TS_ASSERT_DELTA(js.getMeanLateness(), 200, 1e-6);
+            TS_ASSERT(js.getMaximumLateness() == 400);
+        }
+
+        void testTimeScaleAndRestart() {
+            JitterStatistics js;
+
+            // Replayed at half speed: 10ms recorded correspond to 20ms sent.
+            js.update(TimeStamp(0, 0), TimeStamp(1, 0), TimeStamp(1, 0), 2.0);
+            js.update(TimeStamp(0, 10000), TimeStamp(1, 20000), TimeStamp(1, 21000), 2.0);
+            TS_ASSERT(js.getMaximumJitter() == 1000);
+
+            // A pause between two containers must not count as jitter.
+            js.restart();
+            js.update(TimeStamp(0, 20000), TimeStamp(9, 0), TimeStamp(9, 0), 2.0);
+            js.update(TimeStamp(0, 30000), TimeStamp(9, 20000), TimeStamp(9, 20000), 2.0);
+
+            TS_ASSERT(js.getNumberOfContainers() == 4);
+            TS_ASSERT(js.getMinimumJitter() == 0);
+            TS_ASSERT(js.getMaximumJitter() == 1000);
+            TS_ASSERT_DELTA(js.getMeanJitter(), 500, 1e-6);
+        }
+};
+
+#endif /*JITTERSTATISTICSTESTSUITE_H_*/
@@ -199,6 +199,7 @@ class PlayerModuleTest : public CxxTest::TestSuite,
             << "player.autoRewind = 0" << endl
             << "player.remoteControl = 0" << endl
             << "player.timeScale = 1.0" << endl
+            << "player.reportJitter = 1" << endl
             << "global.buffer.memorySegmentSize = 1000" << endl
             << "global.buffer.numberOfMemorySegments = 3" << endl;
 
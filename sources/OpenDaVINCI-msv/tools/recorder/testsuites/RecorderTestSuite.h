@@ -23,14 +23,18 @@
 #include "cxxtest/TestSuite.h"
 
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "core/SharedPointer.h"
 #include "core/base/Service.h"
+#include "core/base/SharedFrameRing.h"
 #include "core/base/Thread.h"
 #include "core/data/Container.h"
+#include "core/data/image/SharedImage.h"
 #include "core/data/TimeStamp.h"
 #include "core/data/recorder/RecorderCommand.h"
 #include "core/io/ContainerConference.h"
@@ -42,6 +46,10 @@
 #include "core/dmcp/connection/Server.h"
 #include "core/dmcp/connection/ConnectionHandler.h"
 #include "core/dmcp/connection/ModuleConnection.h"
+#include "core/wrapper/SharedMemory.h"
+#include "core/wrapper/SharedMemoryFactory.h"
+#include "tools/player/Player.h"
+#include "tools/recorder/Recorder.h"
 
 #include "../include/RecorderModule.h"
 
@@ -207,6 +215,98 @@ class RecorderTest : public CxxTest::TestSuite,
             OPENDAVINCI_CORE_DELETE_POINTER(ccf2);
         }
 
+        /**
+         * This method records the given frames of a SharedImage in place and
+         * returns the first byte of every frame found during the replay.
+         */
+        string recordAndReplaySharedImageInPlace(const string &frames, const bool &threading, const uint32_t &pauseBetweenFrames) {
+            const uint32_t WIDTH = 4;
+            const uint32_t HEIGHT = 3;
+            const uint32_t FRAME_SIZE = WIDTH * HEIGHT;
+            const uint32_t NUMBER_OF_SEGMENTS = 4;
+            const bool RECORD_IN_PLACE = true;
+
+            {
+                core::SharedPointer<core::wrapper::SharedMemory> memory = core::wrapper::SharedMemoryFactory::createSharedMemory("RecorderInPlaceTest", SharedFrameRing::getRequiredSize(FRAME_SIZE, 3));
+                TS_ASSERT(memory->isValid());
+                SharedFrameRing producer(memory, FRAME_SIZE, 3);
+
+                core::data::image::SharedImage si;
+                si.setName(memory->getName());
+                si.setWidth(WIDTH);
+                si.setHeight(HEIGHT);
+                si.setBytesPerPixel(1);
+
+                tools::recorder::Recorder rec("file://RecorderInPlaceTest.rec", FRAME_SIZE, NUMBER_OF_SEGMENTS, threading, RECORD_IN_PLACE);
+                for (uint32_t i = 0; i < frames.size(); i++) {
+                    ::memset(producer.beginWrite(), frames.at(i), FRAME_SIZE);
+                    producer.endWrite();
+
+                    Container c(Container::SHARED_IMAGE, si);
+                    rec.store(c);
+
+                    Thread::usleep(pauseBetweenFrames);
+                }
+                // Pending frames are written when the recorder is destroyed.
+            }
+
+            // The player creates the shared memory again for the replay.
+            string replayed;
+            {
+                const bool AUTO_REWIND = false;
+                const bool PLAYER_THREADING = false;
+                core::io::URL url("file://RecorderInPlaceTest.rec");
+                tools::player::Player player(url, AUTO_REWIND, FRAME_SIZE, NUMBER_OF_SEGMENTS, PLAYER_THREADING);
+
+                core::SharedPointer<core::wrapper::SharedMemory> memory;
+                while (player.hasMoreData()) {
+                    Container c = player.getNextContainerToBeSent();
+                    if (c.getDataType() == Container::SHARED_IMAGE) {
+                        core::data::image::SharedImage si = c.getData<core::data::image::SharedImage>();
+                        TS_ASSERT(si.getSize() == FRAME_SIZE);
+
+                        if (!memory.isValid()) {
+                            memory = core::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
+                        }
+                        TS_ASSERT(memory->isValid());
+
+                        const char *data = static_cast<char*>(memory->getSharedMemory());
+                        TS_ASSERT(data[0] == data[FRAME_SIZE - 1]);
+                        replayed += data[0];
+                    }
+                }
+            }
+
+            UNLINK("RecorderInPlaceTest.rec");
+            UNLINK("RecorderInPlaceTest.rec.mem");
+
+            return replayed;
+        }
+
+        void testRecorderInPlaceSharedImage() {
+            // Without threading, every frame is written during store().
+            TS_ASSERT(recordAndReplaySharedImageInPlace("abc", false, 0) == "abc");
+
+            // With threading, store() only queues the frame; the writer
+            // thread writes it when it gets to it.
+            TS_ASSERT(recordAndReplaySharedImageInPlace("d", true, 0) == "d");
+        }
+
+        void testRecorderInPlaceSharedImageWithThreading() {
+            // The writer thread gets to every frame before the three slots of the ring are reused.
+            TS_ASSERT(recordAndReplaySharedImageInPlace("abcdefgh", true, 50000) == "abcdefgh");
+
+            // Without pauses, frames overwritten before being written are
+            // dropped; no frame must ever be recorded in place of another.
+            // The last frame is never overwritten and thus always recorded.
+            const string replayed = recordAndReplaySharedImageInPlace("abcd", true, 0);
+            TS_ASSERT(replayed.size() > 0);
+            TS_ASSERT(replayed.at(replayed.size() - 1) == 'd');
+            for (uint32_t i = 1; i < replayed.size(); i++) {
+                TS_ASSERT(replayed.at(i - 1) < replayed.at(i));
+            }
+        }
+
         void testRecorderCommand() {
             core::data::recorder::RecorderCommand rc;
             stringstream s;
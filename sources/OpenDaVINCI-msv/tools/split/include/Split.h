@@ -20,9 +20,14 @@
 #ifndef SPLIT_H_
 #define SPLIT_H_
 
+#include <string>
+#include <vector>
+
 #include "core/base/ConferenceClientModule.h"
 #include "core/base/FIFOQueue.h"
 
+#include "tools/splitter/SplitterOutput.h"
+
 namespace split {
 
     using namespace std;
@@ -71,9 +76,25 @@ namespace split {
 
             void parseAdditionalCommandLineParameters(const int &argc, char **argv);
 
+            /**
+             * This method adds one output for each entry of the given
+             * comma-separated list of ranges. An entry has the format
+             * [label:]start-end, where start and end are either container
+             * numbers or seconds relative to the first container.
+             *
+             * @param ranges List of ranges.
+             * @param isTimeRange true if start and end are given in seconds.
+             * @param outputs List of outputs to be extended.
+             * @return true if all entries could be parsed.
+             */
+            bool addOutputs(const string &ranges, const bool &isTimeRange, vector<tools::splitter::SplitterOutput> &outputs) const;
+
         private:
             string m_source;
             string m_range;
+            string m_ranges;
+            string m_times;
+            string m_dataTypes;
     };
 
 } // split
@@ -30,6 +30,7 @@
 #include "tools/player/Player.h"
 #include "tools/recorder/Recorder.h"
 #include "tools/splitter/Splitter.h"
+#include "tools/splitter/SplitterOutput.h"
 
 #include "Split.h"
 
@@ -46,7 +47,10 @@ namespace split {
     Split::Split(const int32_t &argc, char **argv) :
         ConferenceClientModule(argc, argv, "split"),
         m_source(),
-        m_range() {
+        m_range(),
+        m_ranges(),
+        m_times(),
+        m_dataTypes() {
         // Parse command line arguments.
         parseAdditionalCommandLineParameters(argc, argv);
     }
@@ -61,11 +65,17 @@ namespace split {
         CommandLineParser cmdParser;
         cmdParser.addCommandLineArgument("source");
         cmdParser.addCommandLineArgument("range");
+        cmdParser.addCommandLineArgument("ranges");
+        cmdParser.addCommandLineArgument("times");
+        cmdParser.addCommandLineArgument("datatypes");
 
         cmdParser.parse(argc, argv);
 
         CommandLineArgument cmdArgumentSOURCE = cmdParser.getCommandLineArgument("source");
         CommandLineArgument cmdArgumentRANGE = cmdParser.getCommandLineArgument("range");
+        CommandLineArgument cmdArgumentRANGES = cmdParser.getCommandLineArgument("ranges");
+        CommandLineArgument cmdArgumentTIMES = cmdParser.getCommandLineArgument("times");
+        CommandLineArgument cmdArgumentDATATYPES = cmdParser.getCommandLineArgument("datatypes");
 
         if (cmdArgumentSOURCE.isSet()) {
             m_source = cmdArgumentSOURCE.getValue<string>();
@@ -76,36 +86,144 @@ namespace split {
             m_range = cmdArgumentRANGE.getValue<string>();
             core::StringToolbox::trim(m_range);
         }
+
+        if (cmdArgumentRANGES.isSet()) {
+            m_ranges = cmdArgumentRANGES.getValue<string>();
+            core::StringToolbox::trim(m_ranges);
+        }
+
+        if (cmdArgumentTIMES.isSet()) {
+            m_times = cmdArgumentTIMES.getValue<string>();
+            core::StringToolbox::trim(m_times);
+        }
+
+        if (cmdArgumentDATATYPES.isSet()) {
+            m_dataTypes = cmdArgumentDATATYPES.getValue<string>();
+            core::StringToolbox::trim(m_dataTypes);
+        }
     }
 
-    ModuleState::MODULE_EXITCODE Split::body() {
-        ModuleState::MODULE_EXITCODE retVal = ModuleState::OKAY;
+    bool Split::addOutputs(const string &ranges, const bool &isTimeRange, vector<SplitterOutput> &outputs) const {
+        vector<string> entries = core::StringToolbox::split(ranges, ',');
+        if (entries.empty()) {
+            // StringToolbox::split returns no tokens if the delimiter is missing.
+            entries.push_back(ranges);
+        }
 
-        // Size of the memory buffer.
-        const uint32_t MEMORY_SEGMENT_SIZE = getKeyValueConfiguration().getValue<uint32_t>("global.buffer.memorySegmentSize");
+        for (vector<string>::iterator it = entries.begin(); it != entries.end(); ++it) {
+            string entry = *it;
+            core::StringToolbox::trim(entry);
 
-        // Split the range parameter.
-        vector<string> rangeTokens = core::StringToolbox::split(m_range, '-');
+            // Split optional label.
+            string label;
+            vector<string> labelTokens = core::StringToolbox::split(entry, ':');
+            if (labelTokens.size() == 2) {
+                label = labelTokens.at(0);
+                entry = labelTokens.at(1);
+            }
 
-        if (rangeTokens.size() == 2) {
-            uint32_t start = 0, end = 0;
-            stringstream s_start;
-            s_start << rangeTokens.at(0);
-            s_start >> start;
+            // Split the range.
+            vector<string> rangeTokens = core::StringToolbox::split(entry, '-');
+            if (rangeTokens.size() != 2) {
+                return false;
+            }
+
+            stringstream recordingURL;
+            recordingURL << "file://" << m_source << "_";
+
+            if (isTimeRange) {
+                double start = 0, end = 0;
+                stringstream s_start;
+                s_start << rangeTokens.at(0);
+                s_start >> start;
+
+                stringstream s_end;
+                s_end << rangeTokens.at(1);
+                s_end >> end;
+
+                if ( (start < 0) || !(start < end) ) {
+                    return false;
+                }
 
-            stringstream s_end;
-            s_end << rangeTokens.at(1);
-            s_end >> end;
+                recordingURL << (label.empty() ? entry + "s" : label) << ".rec";
 
-            if (start < end) {
-                Splitter s;
-                s.process(m_source, MEMORY_SEGMENT_SIZE, start, end);
+                // Round to the nearest microsecond; truncating would turn 14.9s into 14.899999s.
+                const int64_t startMicroseconds = static_cast<int64_t>(start * 1000 * 1000 + 0.5);
+                const int64_t endMicroseconds = static_cast<int64_t>(end * 1000 * 1000 + 0.5);
+
+                SplitterOutput output(recordingURL.str());
+                output.setTimeRange(TimeStamp(static_cast<int32_t>(startMicroseconds / (1000 * 1000)), static_cast<int32_t>(startMicroseconds % (1000 * 1000))),
+                                    TimeStamp(static_cast<int32_t>(endMicroseconds / (1000 * 1000)), static_cast<int32_t>(endMicroseconds % (1000 * 1000))));
+                outputs.push_back(output);
             }
             else {
-                retVal = ModuleState::SERIOUS_ERROR;
+                uint32_t start = 0, end = 0;
+                stringstream s_start;
+                s_start << rangeTokens.at(0);
+                s_start >> start;
+
+                stringstream s_end;
+                s_end << rangeTokens.at(1);
+                s_end >> end;
+
+                if (!(start < end)) {
+                    return false;
+                }
+
+                recordingURL << (label.empty() ? entry : label) << ".rec";
+
+                SplitterOutput output(recordingURL.str());
+                output.setContainerRange(start, end);
+                outputs.push_back(output);
+            }
+        }
+
+        return true;
+    }
+
+    ModuleState::MODULE_EXITCODE Split::body() {
+        ModuleState::MODULE_EXITCODE retVal = ModuleState::OKAY;
+
+        // Collect all outputs to be written in one single pass over the source.
+        vector<SplitterOutput> outputs;
+
+        bool validRanges = true;
+        if (!m_range.empty()) {
+            // The legacy range parameter must describe exactly one range.
+            validRanges &= (core::StringToolbox::split(m_range, '-').size() == 2) && addOutputs(m_range, false, outputs);
+        }
+        if (!m_ranges.empty()) {
+            validRanges &= addOutputs(m_ranges, false, outputs);
+        }
+        if (!m_times.empty()) {
+            validRanges &= addOutputs(m_times, true, outputs);
+        }
+
+        // Restrict all outputs to the given data types.
+        vector<string> dataTypes = core::StringToolbox::split(m_dataTypes, ',');
+        if (dataTypes.empty() && !m_dataTypes.empty()) {
+            dataTypes.push_back(m_dataTypes);
+        }
+        for (vector<string>::iterator it = dataTypes.begin(); it != dataTypes.end(); ++it) {
+            int32_t dataType = 0;
+            stringstream s_dataType;
+            s_dataType << *it;
+            s_dataType >> dataType;
+
+            for (vector<SplitterOutput>::iterator jt = outputs.begin(); jt != outputs.end(); ++jt) {
+                jt->addDataType(static_cast<Container::DATATYPE>(dataType));
             }
         }
 
+        if (!validRanges) {
+            retVal = ModuleState::SERIOUS_ERROR;
+        }
+        else if (!outputs.empty()) {
+            Splitter s;
+            const uint32_t numberOfContainers = s.process(m_source, outputs);
+            cout << "Processed " << numberOfContainers << " containers into " << outputs.size() << " output(s)." << endl;
+        }
+
         return retVal;
     }
 
@@ -265,6 +265,136 @@ class SplitTest : public CxxTest::TestSuite,
             UNLINK("A.rec_50-60.rec.mem");
         }
 
+        void testSplitMultipleRangesInOnePass() {
+            // Setup ContainerConference.
+            ContainerConference *conference = ContainerConferenceFactory::getInstance().getContainerConference("225.0.0.100");
+
+            // Setup DMCP.
+            stringstream sstr;
+            sstr << "recorder.output = file://RecorderTest.rec" << endl
+            << "global.buffer.memorySegmentSize = 1000" << endl
+            << "global.buffer.numberOfMemorySegments = 1" << endl
+            << "recorder.remoteControl = 0" << endl;
+
+            m_configuration = KeyValueConfiguration();
+            sstr >> m_configuration;
+
+            vector<string> noModulesToIgnore;
+            ServerInformation serverInformation("127.0.0.1", 19000);
+            discoverer::Server dmcpDiscovererServer(serverInformation,
+                                                    "225.0.0.100",
+                                                    BROADCAST_PORT_SERVER,
+                                                    BROADCAST_PORT_CLIENT,
+                                                    noModulesToIgnore);
+            dmcpDiscovererServer.startResponding();
+
+            connection::Server dmcpConnectionServer(serverInformation, *this);
+            dmcpConnectionServer.setConnectionHandler(this);
+
+            // Prepare the data that would be available from commandline.
+            string argv0("split");
+            string argv1("--cid=100");
+            string argv2("--freq=100");
+            string argv3("--source=A.rec");
+            string argv4("--ranges=50-60,second:70-80");
+            string argv5("--times=10-14.9");
+            int32_t argc = 6;
+            char **argv;
+            argv = new char*[6];
+            argv[0] = const_cast<char*>(argv0.c_str());
+            argv[1] = const_cast<char*>(argv1.c_str());
+            argv[2] = const_cast<char*>(argv2.c_str());
+            argv[3] = const_cast<char*>(argv3.c_str());
+            argv[4] = const_cast<char*>(argv4.c_str());
+            argv[5] = const_cast<char*>(argv5.c_str());
+
+            dt = new SplitTestling(argc, argv);
+
+            // Run the split.
+            TS_ASSERT(dt != NULL);
+            TS_ASSERT(dt->runModule() == ModuleState::OKAY);
+
+            delete dt;
+            dt = NULL;
+
+            // Compare the splits: Container ranges 50-60 and 70-80 hold 6 TimeStamps and 5 SharedMemory segments each,
+            // whereas the time range 10s-14.9s holds 5 TimeStamps and 5 SharedMemory segments.
+            TS_ASSERT(countContainers("file://A.rec_50-60.rec", 25) == 11);
+            TS_ASSERT(countContainers("file://A.rec_second.rec", 35) == 11);
+            TS_ASSERT(countContainers("file://A.rec_10-14.9s.rec", 10) == 10);
+
+            // "Ugly" cleaning up conference.
+            OPENDAVINCI_CORE_DELETE_POINTER(conference);
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            ContainerConferenceFactory *ccf2 = &ccf;
+            OPENDAVINCI_CORE_DELETE_POINTER(ccf2);
+
+            // Clean up temporarily created files.
+            UNLINK("A.rec_50-60.rec");
+            UNLINK("A.rec_50-60.rec.mem");
+            UNLINK("A.rec_second.rec");
+            UNLINK("A.rec_second.rec.mem");
+            UNLINK("A.rec_10-14.9s.rec");
+            UNLINK("A.rec_10-14.9s.rec.mem");
+        }
+
+        void testSplitDataTypeFilter() {
+            // Setup DMCP.
+            stringstream sstr;
+            sstr << "recorder.output = file://RecorderTest.rec" << endl
+            << "global.buffer.memorySegmentSize = 1000" << endl
+            << "global.buffer.numberOfMemorySegments = 1" << endl
+            << "recorder.remoteControl = 0" << endl;
+
+            m_configuration = KeyValueConfiguration();
+            sstr >> m_configuration;
+
+            vector<string> noModulesToIgnore;
+            ServerInformation serverInformation("127.0.0.1", 19000);
+            discoverer::Server dmcpDiscovererServer(serverInformation,
+                                                    "225.0.0.100",
+                                                    BROADCAST_PORT_SERVER,
+                                                    BROADCAST_PORT_CLIENT,
+                                                    noModulesToIgnore);
+            dmcpDiscovererServer.startResponding();
+
+            connection::Server dmcpConnectionServer(serverInformation, *this);
+            dmcpConnectionServer.setConnectionHandler(this);
+
+            // Prepare the data that would be available from commandline.
+            string argv0("split");
+            string argv1("--cid=100");
+            string argv2("--freq=100");
+            string argv3("--source=A.rec");
+            string argv4("--ranges=50-60");
+            string argv5("--datatypes=12");
+            int32_t argc = 6;
+            char **argv;
+            argv = new char*[6];
+            argv[0] = const_cast<char*>(argv0.c_str());
+            argv[1] = const_cast<char*>(argv1.c_str());
+            argv[2] = const_cast<char*>(argv2.c_str());
+            argv[3] = const_cast<char*>(argv3.c_str());
+            argv[4] = const_cast<char*>(argv4.c_str());
+            argv[5] = const_cast<char*>(argv5.c_str());
+
+            dt = new SplitTestling(argc, argv);
+
+            // Run the split.
+            TS_ASSERT(dt != NULL);
+            TS_ASSERT(dt->runModule() == ModuleState::OKAY);
+
+            delete dt;
+            dt = NULL;
+
+            // Only the 6 TimeStamps are kept.
+            TS_ASSERT(countContainers("file://A.rec_50-60.rec", 25) == 6);
+
+            // Clean up temporarily created files.
+            UNLINK("A.rec_50-60.rec");
+            UNLINK("A.rec_50-60.rec.mem");
+        }
+
         void testSplitWrongRange() {
             // Setup DMCP.
             stringstream sstr;
@@ -314,6 +444,61 @@ class SplitTest : public CxxTest::TestSuite,
             dt = NULL;
         }
 
+        /**
+         * This method replays the given split and returns the number of
+         * containers found. TimeStamps are expected to start at rangeBasis
+         * and the SharedMemory segments must match the preceding TimeStamp.
+         */
+        uint32_t countContainers(const string &file, int32_t rangeBasis) {
+            // Stop playback at EOF.
+            const bool AUTO_REWIND = false;
+            // Run player in synchronous mode.
+            const bool THREADING = false;
+            // Construct player.
+            Player player(file, AUTO_REWIND, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING);
+
+            uint32_t numberOfContainers = 0;
+            const uint32_t MAX_ITERATIONS = 1000;
+            uint32_t i = 0;
+
+            core::SharedPointer<core::wrapper::SharedMemory> memClient;
+
+            while (player.hasMoreData() && (i < MAX_ITERATIONS)) {
+                i++;
+                // Get container to be sent.
+                Container nextContainer = player.getNextContainerToBeSent();
+
+                if (nextContainer.getDataType() == Container::TIMESTAMP) {
+                    TimeStamp ts = nextContainer.getData<TimeStamp>();
+                    TS_ASSERT(ts.getSeconds() == rangeBasis);
+                    rangeBasis++;
+                    numberOfContainers++;
+                }
+                else if (nextContainer.getDataType() == Container::SHARED_DATA) {
+                    if (!memClient.isValid()) {
+                        SharedData sd = nextContainer.getData<SharedData>();
+                        memClient = core::wrapper::SharedMemoryFactory::attachToSharedMemory(sd.getName());
+                    }
+
+                    TS_ASSERT(memClient->isValid());
+                    TS_ASSERT(memClient->getSize() == 50);
+                    memClient->lock();
+                        char *c = (char*)(memClient->getSharedMemory());
+                        string s(c);
+
+                        stringstream sstr2;
+                        sstr2 << "Data-" << (rangeBasis-1) << endl;
+
+                        TS_ASSERT(core::StringToolbox::equalsIgnoreCase(s, sstr2.str()));
+                    memClient->unlock();
+
+                    numberOfContainers++;
+                }
+            }
+
+            return numberOfContainers;
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////
         // Below this line the necessary constructor for initializing the pointer variables,
         // and the forbidden copy constructor and assignment operator are declared.
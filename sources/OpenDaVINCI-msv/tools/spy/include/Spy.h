@@ -7,6 +7,8 @@
 #ifndef SPY_H_
 #define SPY_H_
 
+#include <string>
+
 #include "core/base/ConferenceClientModule.h"
 #include "core/base/FIFOQueue.h"
 
@@ -52,8 +54,24 @@ namespace spy {
 
             core::base::ModuleState::MODULE_EXITCODE body();
 
+        private:
+            /**
+             * This method parses the command line for the statistics
+             * mode: --statistics=<seconds> aggregates the containers per
+             * data type and refreshes a table with the given interval
+             * instead of printing every container; --export=<file>
+             * additionally writes the statistics as comma separated
+             * values into the given file.
+             *
+             * @param argc Number of command line arguments.
+             * @param argv Command line arguments.
+             */
+            void parseAdditionalCommandLineParameters(const int &argc, char **argv);
+
         private:
             core::base::FIFOQueue m_fifo;
+            double m_refreshInterval;
+            string m_exportFile;
 
             virtual void setUp();
 
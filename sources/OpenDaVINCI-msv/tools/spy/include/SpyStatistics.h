@@ -0,0 +1,152 @@
+/*
+ * OpenDaVINCI.
+ *
+ * This software is open source. Please see COPYING and AUTHORS for further information.
+ */
+
+#ifndef SPYSTATISTICS_H_
+#define SPYSTATISTICS_H_
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "core/data/Container.h"
+#include "core/data/TimeStamp.h"
+
+namespace spy {
+
+    using namespace std;
+
+    /**
+     * This class aggregates per data type the number of containers,
+     * their payload sizes, and their latencies between sending and
+     * receiving. Rates are computed for the current interval, which
+     * is started by startInterval(), and for the entire runtime.
+     */
+    class SpyStatistics {
+        public:
+            enum {
+                /**
+                 * Payload sizes are counted in buckets of powers of two:
+                 * bucket i contains sizes below 2^(i+4) bytes; the last
+                 * bucket contains all larger sizes.
+                 */
+                NUMBER_OF_SIZE_BUCKETS = 12
+            };
+
+            /**
+             * Constructor.
+             *
+             * @param start Time stamp when the aggregation started.
+             */
+            SpyStatistics(const core::data::TimeStamp &start);
+
+            /**
+             * Copy constructor.
+             *
+             * @param obj Reference to an object of this class.
+             */
+            SpyStatistics(const SpyStatistics &obj);
+
+            /**
+             * Assignment operator.
+             *
+             * @param obj Reference to an object of this class.
+             * @return Reference to this instance.
+             */
+            SpyStatistics& operator=(const SpyStatistics &obj);
+
+            virtual ~SpyStatistics();
+
+            /**
+             * This method adds a received container.
+             *
+             * @param c Container to add.
+             */
+            void update(const core::data::Container &c);
+
+            /**
+             * This method starts a new interval for the rates.
+             *
+             * @param now Time stamp when the new interval starts.
+             */
+            void startInterval(const core::data::TimeStamp &now);
+
+            /**
+             * @param dataType Data type.
+             * @return Number of containers of the given type.
+             */
+            uint32_t getNumberOfContainers(const int32_t &dataType) const;
+
+            /**
+             * @param dataType Data type.
+             * @return Sum of the payload sizes of the given type in bytes.
+             */
+            double getNumberOfBytes(const int32_t &dataType) const;
+
+            /**
+             * @param dataType Data type.
+             * @return Mean latency of the given type in microseconds.
+             */
+            double getMeanLatency(const int32_t &dataType) const;
+
+            /**
+             * @param dataType Data type.
+             * @return Histogram of the payload sizes of the given type.
+             */
+            const vector<uint32_t> getSizeHistogram(const int32_t &dataType) const;
+
+            /**
+             * This method writes a human readable table.
+             *
+             * @param out Stream to write to.
+             * @param now Time stamp to compute the rates for.
+             */
+            void writeTable(ostream &out, const core::data::TimeStamp &now) const;
+
+            /**
+             * This method writes one comma separated line per data type
+             * preceded by a header line.
+             *
+             * @param out Stream to write to.
+             * @param now Time stamp to compute the rates for.
+             */
+            void writeCSV(ostream &out, const core::data::TimeStamp &now) const;
+
+            /**
+             * @param size Payload size in bytes.
+             * @return Index of the histogram bucket for the given size.
+             */
+            static uint32_t getSizeBucket(const uint32_t &size);
+
+        private:
+            /**
+             * Statistics for one data type.
+             */
+            class Entry {
+                public:
+                    Entry();
+
+                    string m_name;
+                    uint32_t m_numberOfContainers;
+                    uint32_t m_numberOfContainersInInterval;
+                    double m_numberOfBytes;
+                    double m_numberOfBytesInInterval;
+                    uint32_t m_minimumSize;
+                    uint32_t m_maximumSize;
+                    double m_sumOfLatencies;
+                    long m_minimumLatency;
+                    long m_maximumLatency;
+                    vector<uint32_t> m_sizeHistogram;
+            };
+
+            core::data::TimeStamp m_start;
+            core::data::TimeStamp m_intervalStart;
+            map<int32_t, Entry> m_entries;
+    };
+
+} // spy
+
+#endif /*SPYSTATISTICS_H_*/
@@ -4,11 +4,16 @@
  * This software is open source. Please see COPYING and AUTHORS for further information.
  */
 
+#include <fstream>
 #include <iostream>
 
+#include "core/StringToolbox.h"
+#include "core/base/CommandLineParser.h"
 #include "core/data/Container.h"
+#include "core/data/TimeStamp.h"
 
 #include "Spy.h"
+#include "SpyStatistics.h"
 
 namespace spy {
 
@@ -18,7 +23,12 @@ namespace spy {
 
     Spy::Spy(const int32_t &argc, char **argv) :
         ConferenceClientModule(argc, argv, "Spy"),
-        m_fifo() {}
+        m_fifo(),
+        m_refreshInterval(0),
+        m_exportFile() {
+        // Parse command line arguments.
+        parseAdditionalCommandLineParameters(argc, argv);
+    }
 
     Spy::~Spy() {}
 
@@ -26,16 +36,74 @@ namespace spy {
 
     void Spy::tearDown() {}
 
+    void Spy::parseAdditionalCommandLineParameters(const int &argc, char **argv) {
+        CommandLineParser cmdParser;
+        cmdParser.addCommandLineArgument("statistics");
+        cmdParser.addCommandLineArgument("export");
+
+        cmdParser.parse(argc, argv);
+
+        CommandLineArgument cmdArgumentSTATISTICS = cmdParser.getCommandLineArgument("statistics");
+        CommandLineArgument cmdArgumentEXPORT = cmdParser.getCommandLineArgument("export");
+
+        if (cmdArgumentSTATISTICS.isSet()) {
+            m_refreshInterval = cmdArgumentSTATISTICS.getValue<double>();
+        }
+
+        if (cmdArgumentEXPORT.isSet()) {
+            m_exportFile = cmdArgumentEXPORT.getValue<string>();
+            core::StringToolbox::trim(m_exportFile);
+
+            // Exporting requires the statistics mode.
+            if (m_refreshInterval <= 0) {
+                m_refreshInterval = 1;
+            }
+        }
+    }
+
     ModuleState::MODULE_EXITCODE Spy::body() {
         // Add FIFOQueue to spy all data.
         addDataStoreFor(m_fifo);
 
+        const bool statisticsMode = (m_refreshInterval > 0);
+        const TimeStamp start;
+        SpyStatistics statistics(start);
+        TimeStamp lastRefresh(start);
+
         while (getModuleState() == ModuleState::RUNNING) {
             while (!m_fifo.isEmpty()) {
                 Container c = m_fifo.leave();
-                
-                cout << c.getSentTimeStamp().getYYYYMMDD_HHMMSSms() << "-->" << c.getReceivedTimeStamp().getYYYYMMDD_HHMMSSms() << " dt = " << (c.getReceivedTimeStamp() - c.getSentTimeStamp()).toString() << " ID = " << c.getDataType() << ": " << c.toString() << endl; 
+
+                if (statisticsMode) {
+                    statistics.update(c);
+                }
+                else {
+                    cout << c.getSentTimeStamp().getYYYYMMDD_HHMMSSms() << "-->" << c.getReceivedTimeStamp().getYYYYMMDD_HHMMSSms() << " dt = " << (c.getReceivedTimeStamp() - c.getSentTimeStamp()).toString() << " ID = " << c.getDataType() << ": " << c.toString() << endl; 
+                }
             }
+
+            if (statisticsMode) {
+                TimeStamp now;
+                if ((now - lastRefresh).toMicroseconds() >= static_cast<long>(m_refreshInterval * 1000000)) {
+                    // Clear the terminal and redraw the table.
+                    cout << "\033[2J\033[H";
+                    statistics.writeTable(cout, now);
+                    cout.flush();
+
+                    if (m_exportFile.size() > 0) {
+                        fstream fout(m_exportFile.c_str(), ios::out | ios::trunc);
+                        statistics.writeCSV(fout, now);
+                    }
+
+                    statistics.startInterval(now);
+                    lastRefresh = now;
+                }
+            }
+        }
+
+        if (statisticsMode && (m_exportFile.size() > 0)) {
+            fstream fout(m_exportFile.c_str(), ios::out | ios::trunc);
+            statistics.writeCSV(fout, TimeStamp());
         }
 
         return ModuleState::OKAY;
@@ -0,0 +1,183 @@
+/*
+ * OpenDaVINCI.
+ *
+ * This software is open source. Please see COPYING and AUTHORS for further information.
+ */
+
+#include <iomanip>
+
+#include "SpyStatistics.h"
+
+namespace spy {
+
+    using namespace std;
+    using namespace core::data;
+
+    SpyStatistics::Entry::Entry() :
+        m_name(),
+        m_numberOfContainers(0),
+        m_numberOfContainersInInterval(0),
+        m_numberOfBytes(0),
+        m_numberOfBytesInInterval(0),
+        m_minimumSize(0),
+        m_maximumSize(0),
+        m_sumOfLatencies(0),
+        m_minimumLatency(0),
+        m_maximumLatency(0),
+        m_sizeHistogram(NUMBER_OF_SIZE_BUCKETS, 0) {}
+
+    SpyStatistics::SpyStatistics(const TimeStamp &start) :
+        m_start(start),
+        m_intervalStart(start),
+        m_entries() {}
+
+    SpyStatistics::SpyStatistics(const SpyStatistics &obj) :
+        m_start(obj.m_start),
+        m_intervalStart(obj.m_intervalStart),
+        m_entries(obj.m_entries) {}
+
+    SpyStatistics& SpyStatistics::operator=(const SpyStatistics &obj) {
+        m_start = obj.m_start;
+        m_intervalStart = obj.m_intervalStart;
+        m_entries = obj.m_entries;
+
+        return *this;
+    }
+
+    SpyStatistics::~SpyStatistics() {}
+
+    uint32_t SpyStatistics::getSizeBucket(const uint32_t &size) {
+        uint32_t bucket = 0;
+        uint32_t limit = 16;
+        while ( (size >= limit) && (bucket < (NUMBER_OF_SIZE_BUCKETS - 1)) ) {
+            limit <<= 1;
+            bucket++;
+        }
+        return bucket;
+    }
+
+    void SpyStatistics::update(const Container &c) {
+        Entry &e = m_entries[c.getDataType()];
+
+        const uint32_t size = c.getSerializedDataSize();
+        const long latency = (c.getReceivedTimeStamp() - c.getSentTimeStamp()).toMicroseconds();
+
+        if (e.m_numberOfContainers == 0) {
+            e.m_name = c.toString();
+            e.m_minimumSize = e.m_maximumSize = size;
+            e.m_minimumLatency = e.m_maximumLatency = latency;
+        }
+
+        e.m_numberOfContainers++;
+        e.m_numberOfContainersInInterval++;
+        e.m_numberOfBytes += size;
+        e.m_numberOfBytesInInterval += size;
+        e.m_minimumSize = (size < e.m_minimumSize) ? size : e.m_minimumSize;
+        e.m_maximumSize = (size > e.m_maximumSize) ? size : e.m_maximumSize;
+        e.m_sumOfLatencies += latency;
+        e.m_minimumLatency = (latency < e.m_minimumLatency) ? latency : e.m_minimumLatency;
+        e.m_maximumLatency = (latency > e.m_maximumLatency) ? latency : e.m_maximumLatency;
+        e.m_sizeHistogram[getSizeBucket(size)]++;
+    }
+
+    void SpyStatistics::startInterval(const TimeStamp &now) {
+        m_intervalStart = now;
+
+        for (map<int32_t, Entry>::iterator it = m_entries.begin(); it != m_entries.end(); ++it) {
+            it->second.m_numberOfContainersInInterval = 0;
+            it->second.m_numberOfBytesInInterval = 0;
+        }
+    }
+
+    uint32_t SpyStatistics::getNumberOfContainers(const int32_t &dataType) const {
+        map<int32_t, Entry>::const_iterator it = m_entries.find(dataType);
+        return (it != m_entries.end()) ? it->second.m_numberOfContainers : 0;
+    }
+
+    double SpyStatistics::getNumberOfBytes(const int32_t &dataType) const {
+        map<int32_t, Entry>::const_iterator it = m_entries.find(dataType);
+        return (it != m_entries.end()) ? it->second.m_numberOfBytes : 0;
+    }
+
+    double SpyStatistics::getMeanLatency(const int32_t &dataType) const {
+        map<int32_t, Entry>::const_iterator it = m_entries.find(dataType);
+        return ( (it != m_entries.end()) && (it->second.m_numberOfContainers > 0) ) ? (it->second.m_sumOfLatencies / it->second.m_numberOfContainers) : 0;
+    }
+
+    const vector<uint32_t> SpyStatistics::getSizeHistogram(const int32_t &dataType) const {
+        map<int32_t, Entry>::const_iterator it = m_entries.find(dataType);
+        return (it != m_entries.end()) ? it->second.m_sizeHistogram : vector<uint32_t>(NUMBER_OF_SIZE_BUCKETS, 0);
+    }
+
+    void SpyStatistics::writeTable(ostream &out, const TimeStamp &now) const {
+        const double interval = (now - m_intervalStart).toMicroseconds() / 1000000.0;
+        const double runtime = (now - m_start).toMicroseconds() / 1000000.0;
+
+        out << "Runtime: " << fixed << setprecision(1) << runtime << "s" << endl;
+        out << setw(5) << "ID" << " "
+            << setw(24) << left << "Datatype" << right
+            << setw(10) << "Count"
+            << setw(10) << "Hz"
+            << setw(10) << "Hz(avg)"
+            << setw(12) << "kB/s"
+            << setw(10) << "Size(min)"
+            << setw(10) << "Size(avg)"
+            << setw(10) << "Size(max)"
+            << setw(12) << "Lat(avg)ms"
+            << setw(12) << "Lat(max)ms" << endl;
+
+        for (map<int32_t, Entry>::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it) {
+            const Entry &e = it->second;
+            out << setw(5) << it->first << " "
+                << setw(24) << left << e.m_name.substr(0, 23) << right
+                << setw(10) << e.m_numberOfContainers
+                << setw(10) << setprecision(1) << ((interval > 0) ? (e.m_numberOfContainersInInterval / interval) : 0)
+                << setw(10) << setprecision(1) << ((runtime > 0) ? (e.m_numberOfContainers / runtime) : 0)
+                << setw(12) << setprecision(2) << ((interval > 0) ? (e.m_numberOfBytesInInterval / interval / 1024.0) : 0)
+                << setw(10) << e.m_minimumSize
+                << setw(10) << setprecision(0) << (e.m_numberOfBytes / e.m_numberOfContainers)
+                << setw(10) << e.m_maximumSize
+                << setw(12) << setprecision(3) << (e.m_sumOfLatencies / e.m_numberOfContainers / 1000.0)
+                << setw(12) << setprecision(3) << (e.m_maximumLatency / 1000.0) << endl;
+        }
+        out.unsetf(ios::floatfield);
+    }
+
+    void SpyStatistics::writeCSV(ostream &out, const TimeStamp &now) const {
+        const double runtime = (now - m_start).toMicroseconds() / 1000000.0;
+
+        out << fixed << setprecision(3);
+        out << "id,datatype,containers,rate_hz,bytes,byte_rate_bps,size_min,size_mean,size_max,latency_min_us,latency_mean_us,latency_max_us";
+        for (uint32_t i = 0; i < NUMBER_OF_SIZE_BUCKETS; i++) {
+            if (i < (NUMBER_OF_SIZE_BUCKETS - 1)) {
+                out << ",size_lt_" << (16u << i);
+            }
+            else {
+                out << ",size_ge_" << (8u << i);
+            }
+        }
+        out << endl;
+
+        for (map<int32_t, Entry>::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it) {
+            const Entry &e = it->second;
+            out << it->first << ","
+                << e.m_name << ","
+                << e.m_numberOfContainers << ","
+                << ((runtime > 0) ? (e.m_numberOfContainers / runtime) : 0) << ","
+                << e.m_numberOfBytes << ","
+                << ((runtime > 0) ? (e.m_numberOfBytes / runtime) : 0) << ","
+                << e.m_minimumSize << ","
+                << (e.m_numberOfBytes / e.m_numberOfContainers) << ","
+                << e.m_maximumSize << ","
+                << e.m_minimumLatency << ","
+                << (e.m_sumOfLatencies / e.m_numberOfContainers) << ","
+                << e.m_maximumLatency;
+            for (uint32_t i = 0; i < NUMBER_OF_SIZE_BUCKETS; i++) {
+                out << "," << e.m_sizeHistogram[i];
+            }
+            out << endl;
+        }
+        out.unsetf(ios::floatfield);
+    }
+
+} // spy
@@ -9,8 +9,14 @@
 
 #include "cxxtest/TestSuite.h"
 
+#include <sstream>
+
+#include "core/data/Container.h"
+#include "core/data/TimeStamp.h"
+
 // Include local header files.
 #include "../include/Spy.h"
+#include "../include/SpyStatistics.h"
 
 using namespace std;
 using namespace core::data;
@@ -71,6 +77,78 @@ class SpyTest : public CxxTest::TestSuite {
             TS_ASSERT(dt != NULL);
         }
 
+        void testSpyStatisticsSizeBuckets() {
+            TS_ASSERT(SpyStatistics::getSizeBucket(0) == 0);
+            TS_ASSERT(SpyStatistics::getSizeBucket(15) == 0);
+            TS_ASSERT(SpyStatistics::getSizeBucket(16) == 1);
+            TS_ASSERT(SpyStatistics::getSizeBucket(31) == 1);
+            TS_ASSERT(SpyStatistics::getSizeBucket(1024) == 7);
+            TS_ASSERT(SpyStatistics::getSizeBucket(16383) == 10);
+            TS_ASSERT(SpyStatistics::getSizeBucket(16384) == 11);
+            TS_ASSERT(SpyStatistics::getSizeBucket(1000000) == (SpyStatistics::NUMBER_OF_SIZE_BUCKETS - 1));
+        }
+
+        void testSpyStatistics() {
+            SpyStatistics statistics(TimeStamp(10, 0));
+
+            for (int32_t i = 0; i < 4; i++) {
+                Container c(Container::TIMESTAMP, TimeStamp(i, 0));
+                c.setSentTimeStamp(TimeStamp(10 + i, 0));
+                // Latencies of 1ms and 3ms alternately.
+                c.setReceivedTimeStamp(TimeStamp(10 + i, (i % 2 == 0) ? 1000 : 3000));
+                statistics.update(c);
+            }
+
+            Container other(Container::USER_DATA_1, TimeStamp());
+            other.setSentTimeStamp(TimeStamp(12, 0));
+            other.setReceivedTimeStamp(TimeStamp(12, 0));
+            statistics.update(other);
+
+            Container reference(Container::TIMESTAMP, TimeStamp(0, 0));
+            const uint32_t size = reference.getSerializedDataSize();
+
+            TS_ASSERT(statistics.getNumberOfContainers(Container::TIMESTAMP) == 4);
+            TS_ASSERT(statistics.getNumberOfContainers(Container::USER_DATA_1) == 1);
+            TS_ASSERT(statistics.getNumberOfContainers(Container::UNDEFINEDDATA) == 0);
+            TS_ASSERT_DELTA(statistics.getMeanLatency(Container::TIMESTAMP), 2000, 1e-5);
+            TS_ASSERT_DELTA(statistics.getMeanLatency(Container::USER_DATA_1), 0, 1e-5);
+            TS_ASSERT(statistics.getSizeHistogram(Container::TIMESTAMP).at(SpyStatistics::getSizeBucket(size)) >= 1);
+
+            uint32_t sum = 0;
+            vector<uint32_t> histogram = statistics.getSizeHistogram(Container::TIMESTAMP);
+            for (uint32_t i = 0; i < histogram.size(); i++) {
+                sum += histogram.at(i);
+            }
+            TS_ASSERT(sum == 4);
+
+            // One header line and one line per data type.
+            stringstream csv;
+            statistics.writeCSV(csv, TimeStamp(14, 0));
+            uint32_t lines = 0;
+            string line;
+            while (getline(csv, line)) {
+                lines++;
+            }
+            TS_ASSERT(lines == 3);
+
+            stringstream table;
+            statistics.writeTable(table, TimeStamp(14, 0));
+            TS_ASSERT(table.str().find("TimeStamp") != string::npos);
+        }
+
+        void testSpyStatisticsInterval() {
+            SpyStatistics statistics(TimeStamp(0, 0));
+
+            Container c(Container::TIMESTAMP, TimeStamp());
+            statistics.update(c);
+            statistics.startInterval(TimeStamp(1, 0));
+            statistics.update(c);
+
+            // Intervals only affect the rates but not the totals.
+            TS_ASSERT(statistics.getNumberOfContainers(Container::TIMESTAMP) == 2);
+            TS_ASSERT_DELTA(statistics.getNumberOfBytes(Container::TIMESTAMP), 2.0 * c.getSerializedDataSize(), 1e-5);
+        }
+
         ////////////////////////////////////////////////////////////////////////////////////
         // Below this line the necessary constructor for initializing the pointer variables,
         // and the forbidden copy constructor and assignment operator are declared.